@@ -0,0 +1,179 @@
+#include "harness.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_MAX_RESULTS 256
+#define BENCH_MAX_REPETITIONS 64
+
+typedef struct {
+    const char* name;
+    char params[48];
+    u64 iterations;
+    f64 median_ns;
+    f64 min_ns;
+    f64 bytes;
+    f64 items;
+} BenchResult;
+
+volatile u32 bench_sink = 0;
+
+static BenchOptions options;
+static BenchResult results[BENCH_MAX_RESULTS];
+static usize result_count = 0;
+
+static f64 now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static f64 time_run(BenchFunc func, anyopaque* context, u64 iterations) {
+    f64 start = now_seconds();
+    func(context, iterations);
+    return now_seconds() - start;
+}
+
+static int compare_f64(const void* a, const void* b) {
+    f64 x = *(const f64*)a, y = *(const f64*)b;
+    return x < y ? -1 : x > y;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [--out FILE] [--filter TEXT] [--min-time SECONDS] [--repetitions N] [--list]\n",
+            program);
+}
+
+i32 Bench_Parse_Options(int argc, char** argv, BenchOptions* result) {
+    result->output = NULL;
+    result->filter = NULL;
+    result->min_time = 0.2;
+    result->repetitions = 5;
+    result->list = false;
+
+    for(int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if(strcmp(arg, "--list") == 0) {
+            result->list = true;
+            continue;
+        }
+
+        if(value == NULL) {
+            usage(argv[0]);
+            return -1;
+        }
+
+        if(strcmp(arg, "--out") == 0) {
+            result->output = value;
+        } else if(strcmp(arg, "--filter") == 0) {
+            result->filter = value;
+        } else if(strcmp(arg, "--min-time") == 0) {
+            result->min_time = atof(value);
+        } else if(strcmp(arg, "--repetitions") == 0) {
+            result->repetitions = atoi(value);
+        } else {
+            usage(argv[0]);
+            return -1;
+        }
+        i++;
+    }
+
+    if(result->min_time <= 0 || result->repetitions == 0 || result->repetitions > BENCH_MAX_REPETITIONS) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    return 0;
+}
+
+void Bench_Begin(const BenchOptions* opts) {
+    options = *opts;
+    result_count = 0;
+}
+
+void Bench_Run(const char* name, const char* params, BenchFunc func, anyopaque* context, f64 bytes, f64 items) {
+    char full[128];
+    snprintf(full, sizeof(full), "%s/%s", name, params);
+    if(options.filter && !strstr(full, options.filter))
+        return;
+
+    if(options.list) {
+        printf("%s\n", full);
+        return;
+    }
+
+    if(result_count >= BENCH_MAX_RESULTS)
+        return;
+
+    // Double the iterations until a run is long enough to scale from, warming caches on the way
+    u64 iterations = 1;
+    f64 elapsed = time_run(func, context, iterations);
+    while(elapsed < options.min_time / 8 && iterations < (1ULL << 40)) {
+        iterations *= 2;
+        elapsed = time_run(func, context, iterations);
+    }
+
+    f64 scaled = iterations * options.min_time / (elapsed > 0 ? elapsed : 1e-9);
+    iterations = scaled < 1 ? 1 : (u64)scaled;
+
+    f64 samples[BENCH_MAX_REPETITIONS];
+    for(usize i = 0; i < options.repetitions; i++)
+        samples[i] = time_run(func, context, iterations) * 1e9 / iterations;
+
+    qsort(samples, options.repetitions, sizeof(f64), compare_f64);
+
+    BenchResult* result = &results[result_count++];
+    result->name = name;
+    snprintf(result->params, sizeof(result->params), "%s", params);
+    result->iterations = iterations;
+    result->median_ns = samples[options.repetitions / 2];
+    result->min_ns = samples[0];
+    result->bytes = bytes;
+    result->items = items;
+
+    fprintf(stderr, "%-36s %12.1f ns/op", full, result->median_ns);
+    if(bytes > 0)
+        fprintf(stderr, " %10.1f MB/s", bytes / result->median_ns * 1e3);
+    fprintf(stderr, " %14.0f items/s\n", items / result->median_ns * 1e9);
+}
+
+i32 Bench_End() {
+    if(options.list)
+        return 0;
+
+    FILE* out = options.output ? fopen(options.output, "w") : stdout;
+    if(!out) {
+        fprintf(stderr, "Could not open %s\n", options.output);
+        return -1;
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"suite\": \"quickgame-host\",\n");
+#ifdef __VERSION__
+    fprintf(out, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    fprintf(out, "  \"min_time\": %g,\n", options.min_time);
+    fprintf(out, "  \"repetitions\": %u,\n", options.repetitions);
+    fprintf(out, "  \"results\": [\n");
+
+    for(usize i = 0; i < result_count; i++) {
+        const BenchResult* r = &results[i];
+        fprintf(out, "    {\"name\": \"%s\", \"params\": \"%s\", \"iterations\": %llu, "
+                     "\"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f, ",
+                r->name, r->params, (unsigned long long)r->iterations, r->median_ns, r->min_ns);
+        if(r->bytes > 0)
+            fprintf(out, "\"mb_per_s\": %.3f, ", r->bytes / r->median_ns * 1e3);
+        fprintf(out, "\"items_per_s\": %.1f}%s\n", r->items / r->median_ns * 1e9, i + 1 < result_count ? "," : "");
+    }
+
+    fprintf(out, "  ]\n}\n");
+
+    if(out != stdout)
+        fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file harness.h
+ * @brief Timing loop and JSON report of the host benchmarks
+ */
+
+#ifndef _BENCH_HARNESS_H_
+#define _BENCH_HARNESS_H_
+
+#include <Types.h>
+
+/**
+ * @brief Runs the measured operation iterations times
+ *
+ * @param context Case data given to Bench_Run
+ * @param iterations Number of operations to run
+ */
+typedef void (*BenchFunc)(anyopaque* context, u64 iterations);
+
+typedef struct {
+    const char* output; // JSON file, stdout when NULL
+    const char* filter; // Only cases whose "name/params" contains this
+    f64 min_time; // Seconds each repetition runs for at least
+    usize repetitions;
+    bool list; // Print case names without running them
+} BenchOptions;
+
+/**
+ * @brief Parses --out, --filter, --min-time, --repetitions and --list
+ *
+ * @return i32 < 0 on a bad argument, after printing the usage
+ */
+i32 Bench_Parse_Options(int argc, char** argv, BenchOptions* options);
+
+/**
+ * @brief Starts a report
+ */
+void Bench_Begin(const BenchOptions* options);
+
+/**
+ * @brief Times a case: the iteration count is calibrated to min_time, then the repetitions are run
+ * and the median is reported along with the fastest one
+ *
+ * @param name Kernel measured
+ * @param params Input size or variant
+ * @param func Operation
+ * @param context Passed to func
+ * @param bytes Bytes processed by one operation, 0 if it does not apply
+ * @param items Items (pixels, tiles, samples, calls) processed by one operation
+ */
+void Bench_Run(const char* name, const char* params, BenchFunc func, anyopaque* context, f64 bytes, f64 items);
+
+/**
+ * @brief Writes the report
+ *
+ * @return i32 < 0 if the output could not be written
+ */
+i32 Bench_End();
+
+/**
+ * @brief Keeps results alive so the compiler can not drop the work producing them
+ */
+extern volatile u32 bench_sink;
+
+#endif
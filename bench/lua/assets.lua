@@ -0,0 +1,19 @@
+-- Assets for the benchmarks, written at startup so no files ship with them
+
+-- Writes a square 32-bit uncompressed TGA, a two color checkerboard
+function write_texture(path, size)
+    local header = string.char(0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        size % 256, math.floor(size / 256), size % 256, math.floor(size / 256), 32, 8)
+
+    local pixels = {}
+    for y = 0, size - 1 do
+        for x = 0, size - 1 do
+            local on = (math.floor(x / 4) + math.floor(y / 4)) % 2 == 0
+            pixels[#pixels + 1] = on and string.char(255, 255, 255, 255) or string.char(64, 64, 64, 255)
+        end
+    end
+
+    local file = assert(io.open(path, "wb"))
+    file:write(header, table.concat(pixels))
+    file:close()
+end
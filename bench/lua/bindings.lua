@@ -0,0 +1,134 @@
+-- Calls per second of each binding, called the way scripts call them: module functions through
+-- their global table, methods through the userdata metatable. Every operation is one call.
+
+-- References for the cost of the loop and of calls that never leave Lua or the Lua C library
+Bench.run("lua", "empty_loop", function(n)
+    for i = 1, n do end
+end, 1)
+
+local function nothing(a, b) return a end
+Bench.run("lua", "lua_function", function(n)
+    for i = 1, n do nothing(i, 2) end
+end, 1)
+
+Bench.run("lua", "math.abs", function(n)
+    for i = 1, n do math.abs(i) end
+end, 1)
+
+-- QuickGame, Input, Color, Timer
+
+Bench.run("QuickGame.running", "", function(n)
+    for i = 1, n do QuickGame.running() end
+end, 1)
+
+Bench.run("Input.update", "", function(n)
+    for i = 1, n do Input.update() end
+end, 1)
+
+Bench.run("Input.button_held", "", function(n)
+    for i = 1, n do Input.button_held(PSP_CROSS) end
+end, 1)
+
+Bench.run("Input.analog_x", "", function(n)
+    for i = 1, n do Input.analog_x() end
+end, 1)
+
+Bench.run("Color.create", "", function(n)
+    for i = 1, n do Color.create(255, 128, 64, 255) end
+end, 1)
+
+local timer = Timer.create()
+Bench.run("Timer:delta", "", function(n)
+    for i = 1, n do timer:delta() end
+end, 1)
+
+-- Transform
+
+Bench.run("Transform.create", "with_gc", function(n)
+    for i = 1, n do Transform.create() end
+end, 1)
+
+local a = Transform.create()
+local b = Transform.create()
+a:set_scale(16, 16)
+b:set_scale(16, 16)
+b:set_position(8, 8)
+
+Bench.run("Transform:set_position", "", function(n)
+    for i = 1, n do a:set_position(i, 4) end
+end, 1)
+
+Bench.run("Transform:set_rotation", "", function(n)
+    for i = 1, n do a:set_rotation(i) end
+end, 1)
+
+a:set_position(0, 0)
+Bench.run("Transform:intersects", "", function(n)
+    for i = 1, n do a:intersects(b) end
+end, 1)
+
+-- Camera
+
+local camera = Camera.create()
+Bench.run("Camera:set_position", "", function(n)
+    for i = 1, n do camera:set_position(i, 4) end
+end, 1)
+
+-- Sprite, through a handle to a texture
+
+write_texture("bench_texture.tga", 16)
+local texture = Texture.load("bench_texture.tga", 0, 0)
+local sprite = Sprite.create(240, 136, 16, 16, texture)
+local other = Sprite.create(248, 140, 16, 16, texture)
+
+Bench.run("Sprite:set_position", "", function(n)
+    for i = 1, n do sprite:set_position(i % 480, 136) end
+end, 1)
+
+Bench.run("Sprite:set_color", "", function(n)
+    local white = Color.create(255, 255, 255, 255)
+    for i = 1, n do sprite:set_color(white) end
+end, 1)
+
+sprite:set_position(240, 136)
+Bench.run("Sprite:intersects", "", function(n)
+    for i = 1, n do sprite:intersects(other) end
+end, 1)
+
+Bench.run("Sprite:draw", "", function(n)
+    Graphics.start_frame()
+    for i = 1, n do sprite:draw() end
+    Graphics.end_frame(false)
+end, 1)
+
+-- Primitive, both argument forms
+
+local red = Color.create(255, 0, 0, 255)
+Bench.run("Primitive.draw_rectangle", "numbers", function(n)
+    Graphics.start_frame()
+    for i = 1, n do Primitive.draw_rectangle(240, 136, 16, 16, red, 0) end
+    Graphics.end_frame(false)
+end, 1)
+
+Bench.run("Primitive.draw_rectangle", "transform", function(n)
+    Graphics.start_frame()
+    for i = 1, n do Primitive.draw_rectangle(a, red) end
+    Graphics.end_frame(false)
+end, 1)
+
+-- Tilemap
+
+local tilemap = Tilemap.create(16, 16, texture, 16, 16)
+Bench.run("Tilemap:set_tile", "", function(n)
+    local white = Color.create(255, 255, 255, 255)
+    for i = 1, n do
+        local idx = i % 256
+        tilemap:set_tile(idx, (idx % 16) * 16, math.floor(idx / 16) * 16, 16, 16, idx, white, 0)
+    end
+end, 1)
+
+Bench.run("Tilemap:build", "16x16", function(n)
+    for i = 1, n do tilemap:build() end
+end, 1)
+
+os.remove("bench_texture.tga")
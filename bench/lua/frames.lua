@@ -0,0 +1,102 @@
+-- Typical frame loops, one operation is one whole frame. items_per_s counts frames.
+
+Bench.run("frame", "empty", function(n)
+    for i = 1, n do
+        Graphics.start_frame()
+        Graphics.clear()
+        Graphics.end_frame(false)
+    end
+end, 1)
+
+Bench.run("frame", "input_poll", function(n)
+    local buttons = { PSP_CROSS, PSP_CIRCLE, PSP_SQUARE, PSP_TRIANGLE, PSP_LEFT, PSP_RIGHT, PSP_UP, PSP_DOWN }
+    for i = 1, n do
+        Input.update()
+        for b = 1, #buttons do
+            Input.button_pressed(buttons[b])
+            Input.button_held(buttons[b])
+        end
+        Input.analog_x()
+        Input.analog_y()
+
+        Graphics.start_frame()
+        Graphics.clear()
+        Graphics.end_frame(false)
+    end
+end, 1)
+
+-- Sprites moved and drawn from Lua tables
+write_texture("bench_texture.tga", 16)
+local texture = Texture.load("bench_texture.tga", 0, 0)
+os.remove("bench_texture.tga")
+
+for _, count in ipairs({ 100, 500 }) do
+    local sprites = {}
+    for i = 1, count do
+        sprites[i] = { sprite = Sprite.create(i % 480, i % 272, 16, 16, texture), x = i % 480, y = i % 272, vx = i % 7 - 3, vy = i % 5 - 2 }
+    end
+
+    Bench.run("frame", "sprites_" .. count, function(n)
+        for f = 1, n do
+            for i = 1, count do
+                local s = sprites[i]
+                s.x = (s.x + s.vx) % 480
+                s.y = (s.y + s.vy) % 272
+                s.sprite:set_position(s.x, s.y)
+            end
+
+            Graphics.start_frame()
+            Graphics.clear()
+            for i = 1, count do
+                sprites[i].sprite:draw()
+            end
+            Graphics.end_frame(false)
+        end
+    end, 1)
+end
+
+-- Objects with methods, a transform each and a collision pass against the first one
+local Mover = {}
+Mover.__index = Mover
+
+function Mover.new(i)
+    local self = setmetatable({ x = i % 480, y = i % 272, vx = i % 7 - 3, vy = i % 5 - 2 }, Mover)
+    self.transform = Transform.create()
+    self.transform:set_scale(8, 8)
+    return self
+end
+
+function Mover:update()
+    self.x = (self.x + self.vx) % 480
+    self.y = (self.y + self.vy) % 272
+    self.transform:set_position(self.x, self.y)
+end
+
+local objects = {}
+for i = 1, 1000 do
+    objects[i] = Mover.new(i)
+end
+local color = Color.create(64, 160, 255, 255)
+
+Bench.run("frame", "objects_1000", function(n)
+    for f = 1, n do
+        Input.update()
+
+        local hits = 0
+        local player = objects[1].transform
+        for i = 1, #objects do
+            local o = objects[i]
+            o:update()
+            if o.transform:intersects(player) then
+                hits = hits + 1
+            end
+        end
+
+        Graphics.start_frame()
+        Graphics.clear()
+        for i = 1, #objects do
+            Primitive.draw_rectangle(objects[i].transform, color)
+        end
+        Graphics.end_frame(false)
+    end
+end, 1)
@@ -0,0 +1,102 @@
+-- Timing loop and JSON report of the Lua benchmarks, the same measurements as bench/harness.c:
+-- the iteration count is calibrated to min_time, then the repetitions run and the median is kept.
+--
+-- Options come after the script: --out <file> --filter <text> --min-time <s> --repetitions <n> --list
+
+Bench = {
+    min_time = 0.2,
+    repetitions = 5,
+    filter = nil,
+    output = nil,
+    list = false,
+    results = {},
+}
+
+local i = 1
+while arg and arg[i] do
+    local option, value = arg[i], arg[i + 1]
+    if option == "--out" then Bench.output = value
+    elseif option == "--filter" then Bench.filter = value
+    elseif option == "--min-time" then Bench.min_time = tonumber(value)
+    elseif option == "--repetitions" then Bench.repetitions = math.max(1, math.floor(tonumber(value)))
+    elseif option == "--list" then Bench.list = true; i = i - 1
+    else error("Unknown option " .. tostring(option)) end
+    i = i + 2
+end
+
+local timer = Timer.create()
+
+-- Seconds taken by fn(iterations)
+local function measure(fn, iterations)
+    timer:reset()
+    fn(iterations)
+    return timer:delta()
+end
+
+-- fn(iterations) runs the operation iterations times, items is the number of binding calls in one operation
+function Bench.run(name, params, fn, items)
+    local full = name .. "/" .. params
+    if Bench.filter and not string.find(full, Bench.filter, 1, true) then
+        return
+    end
+    if Bench.list then
+        io.stdout:write(full, "\n")
+        return
+    end
+
+    -- Keep garbage from earlier cases out of this one
+    collectgarbage("collect")
+
+    local iterations = 1
+    local elapsed = measure(fn, iterations)
+    while elapsed < Bench.min_time / 8 do
+        iterations = iterations * 2
+        elapsed = measure(fn, iterations)
+    end
+    iterations = math.max(1, math.ceil(iterations * Bench.min_time / elapsed))
+
+    local samples = {}
+    for r = 1, Bench.repetitions do
+        samples[r] = measure(fn, iterations) / iterations
+    end
+    table.sort(samples)
+
+    local median = samples[math.floor((#samples + 1) / 2)]
+    local result = {
+        name = name,
+        params = params,
+        iterations = iterations,
+        ns_per_op = median * 1e9,
+        min_ns_per_op = samples[1] * 1e9,
+        items_per_s = median > 0 and (items or 1) / median or 0,
+    }
+    Bench.results[#Bench.results + 1] = result
+
+    io.stderr:write(string.format("%-44s %12.1f ns/op %14.0f calls/s\n", full, result.ns_per_op, result.items_per_s))
+end
+
+-- Writes the results as JSON, to --out or stdout
+function Bench.report(suite)
+    if Bench.list then
+        return
+    end
+
+    local lines = {}
+    for _, r in ipairs(Bench.results) do
+        lines[#lines + 1] = string.format(
+            '    {"name": "%s", "params": "%s", "iterations": %d, "ns_per_op": %.3f, "min_ns_per_op": %.3f, "items_per_s": %.1f}',
+            r.name, r.params, r.iterations, r.ns_per_op, r.min_ns_per_op, r.items_per_s)
+    end
+
+    local json = string.format('{\n  "suite": "%s",\n  "lua": "%s",\n  "min_time": %g,\n  "repetitions": %d,\n  "results": [\n%s\n  ]\n}\n',
+        suite, _VERSION, Bench.min_time, Bench.repetitions, table.concat(lines, ",\n"))
+
+    if Bench.output then
+        local file = assert(io.open(Bench.output, "w"))
+        file:write(json)
+        file:close()
+    else
+        io.stdout:write(json)
+    end
+end
+
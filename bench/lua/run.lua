@@ -0,0 +1,11 @@
+-- Lua binding benchmarks, run with the host interpreter:
+--   qglua bench/lua/run.lua [--out results.json] [--filter text] [--min-time s] [--repetitions n] [--list]
+
+local dir = arg and arg[0] and string.match(arg[0], "(.*[/\\])") or ""
+
+dofile(dir .. "harness.lua")
+dofile(dir .. "assets.lua")
+dofile(dir .. "bindings.lua")
+dofile(dir .. "frames.lua")
+
+Bench.report("quickgame-lua")
@@ -0,0 +1,538 @@
+#include <QuickGame.h>
+#include "osl_sound/oslib.h"
+#include "harness.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * Engine internals measured here that have no public declaration
+ */
+void swizzle_fast(u8* out, const u8* in, const u32 width, const u32 height);
+void copy_texture_data(void* dest, const void* src, const int pW, const int width, const int height);
+void oslDecodeWav(unsigned int i, void* buf, unsigned int length);
+
+// Mirrors OSL_ADGlobals in src/osl_sound/bgm.c
+typedef struct {
+    const unsigned char* data;
+    int last_sample;
+    int last_index;
+} BenchADGlobals;
+
+short* oslDecodeADMono(BenchADGlobals* ad, short* dst, const unsigned char* src, unsigned int len, unsigned int samples, unsigned int streaming);
+
+#define AUDIO_BUFFER_SAMPLES 512
+
+static u32 rng_state = 0x12345678;
+
+static u32 rng() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static f32 rng_range(f32 min, f32 max) {
+    return min + (rng() & 0xFFFF) / 65535.0f * (max - min);
+}
+
+static u8* random_bytes(usize size) {
+    u8* data = malloc(size);
+    for(usize i = 0; i < size; i++)
+        data[i] = rng();
+    return data;
+}
+
+/*
+ * Textures
+ */
+
+typedef struct {
+    u8* in;
+    u8* out;
+    u32 width, height, pow2_width;
+} TextureCase;
+
+static void run_swizzle(anyopaque* context, u64 iterations) {
+    TextureCase* c = context;
+    for(u64 i = 0; i < iterations; i++)
+        swizzle_fast(c->out, c->in, c->width * 4, c->height);
+    bench_sink += c->out[0];
+}
+
+static void run_copy(anyopaque* context, u64 iterations) {
+    TextureCase* c = context;
+    for(u64 i = 0; i < iterations; i++)
+        copy_texture_data(c->out, c->in, c->pow2_width, c->width, c->height);
+    bench_sink += c->out[0];
+}
+
+static void bench_textures() {
+    // Swizzling works on the power of two copy, in blocks of 16 bytes by 8 rows
+    static const u32 swizzle_sizes[] = { 32, 128, 256, 512 };
+    for(usize i = 0; i < sizeof(swizzle_sizes) / sizeof(u32); i++) {
+        u32 size = swizzle_sizes[i];
+        TextureCase c = { random_bytes(size * size * 4), malloc(size * size * 4), size, size, size };
+
+        char params[32];
+        snprintf(params, sizeof(params), "%ux%u", size, size);
+        Bench_Run("swizzle_fast", params, run_swizzle, &c, size * size * 4.0, size * size);
+
+        free(c.in);
+        free(c.out);
+    }
+
+    // Image sizes as loaded, padded out to the power of two width
+    static const u32 copy_sizes[][3] = { { 30, 30, 32 }, { 100, 100, 128 }, { 300, 200, 512 }, { 480, 272, 512 } };
+    for(usize i = 0; i < sizeof(copy_sizes) / sizeof(copy_sizes[0]); i++) {
+        u32 w = copy_sizes[i][0], h = copy_sizes[i][1], p = copy_sizes[i][2];
+        TextureCase c = { random_bytes(w * h * 4), malloc(p * p * 4), w, h, p };
+
+        char params[32];
+        snprintf(params, sizeof(params), "%ux%u", w, h);
+        Bench_Run("copy_texture_data", params, run_copy, &c, w * h * 4.0, w * h);
+
+        free(c.in);
+        free(c.out);
+    }
+}
+
+/*
+ * Tilemaps and atlases
+ */
+
+static QGTexture_t fake_texture(u32 width, u32 height) {
+    QGTexture_t texture = QuickGame_Allocate(sizeof(QGTexture));
+    texture->width = texture->pWidth = width;
+    texture->height = texture->pHeight = height;
+    return texture;
+}
+
+static void run_tilemap_build(anyopaque* context, u64 iterations) {
+    QGTilemap_t tilemap = context;
+    for(u64 i = 0; i < iterations; i++)
+        QuickGame_Tilemap_Build(tilemap);
+    bench_sink += ((u8*)tilemap->mesh->data)[0];
+}
+
+static void bench_tilemaps() {
+    QGTexture_t texture = fake_texture(256, 256);
+    QGTextureAtlas atlas = { 16, 16 };
+
+    // Indices are 16 bit, 4 vertices per tile keeps a map under 16384 tiles
+    static const u32 sizes[] = { 16, 32, 64 };
+    for(usize i = 0; i < sizeof(sizes) / sizeof(u32); i++) {
+        u32 size = sizes[i];
+        QGTilemap_t tilemap = QuickGame_Tilemap_Create(atlas, texture, (QGVector2){ size, size });
+        for(u32 t = 0; t < size * size; t++) {
+            QGTile* tile = &tilemap->tile_array[t];
+            tile->position.x = (t % size) * 16 + 8;
+            tile->position.y = (t / size) * 16 + 8;
+            tile->scale.x = 16;
+            tile->scale.y = 16;
+            tile->atlas_idx = rng() % 256;
+            tile->color.color = 0xFFFFFFFF;
+        }
+
+        char params[32];
+        snprintf(params, sizeof(params), "%ux%u", size, size);
+        Bench_Run("QuickGame_Tilemap_Build", params, run_tilemap_build, tilemap, 0, size * size);
+
+        QuickGame_Tilemap_Destroy(&tilemap);
+    }
+
+    QuickGame_Destroy(texture);
+}
+
+#define CALLS_PER_OP 1024
+
+static void run_index_coords(anyopaque* context, u64 iterations) {
+    QGTextureAtlas* atlas = context;
+    usize count = atlas->x * atlas->y;
+    f32 buf[8];
+    f32 sum = 0;
+
+    for(u64 i = 0; i < iterations; i++) {
+        for(usize idx = 0; idx < CALLS_PER_OP; idx++) {
+            QuickGame_Atlas_Index_Coords(*atlas, buf, idx % count);
+            sum += buf[0];
+        }
+    }
+    bench_sink += (u32)sum;
+}
+
+static void bench_atlas() {
+    static const QGTextureAtlas atlases[] = { { 4, 4 }, { 16, 16 } };
+    for(usize i = 0; i < sizeof(atlases) / sizeof(atlases[0]); i++) {
+        QGTextureAtlas atlas = atlases[i];
+
+        char params[32];
+        snprintf(params, sizeof(params), "%.0fx%.0f", atlas.x, atlas.y);
+        Bench_Run("QuickGame_Atlas_Index_Coords", params, run_index_coords, &atlas, 0, CALLS_PER_OP);
+    }
+}
+
+/*
+ * Collision
+ */
+
+typedef struct {
+    QGTransform2D a[CALLS_PER_OP];
+    QGTransform2D b[CALLS_PER_OP];
+} IntersectCase;
+
+static void run_intersect(anyopaque* context, u64 iterations) {
+    IntersectCase* c = context;
+    u32 hits = 0;
+    for(u64 i = 0; i < iterations; i++) {
+        for(usize j = 0; j < CALLS_PER_OP; j++)
+            hits += QuickGame_Intersect_Transform(c->a[j], c->b[j]);
+    }
+    bench_sink += hits;
+}
+
+static void bench_intersect() {
+    IntersectCase* c = malloc(sizeof(IntersectCase));
+
+    // Sprites spread over the screen: mostly misses, like a broad set of pair tests
+    for(usize j = 0; j < CALLS_PER_OP; j++) {
+        c->a[j] = (QGTransform2D){ { rng_range(0, 480), rng_range(0, 272) }, 0, { rng_range(8, 64), rng_range(8, 64) } };
+        c->b[j] = (QGTransform2D){ { rng_range(0, 480), rng_range(0, 272) }, 0, { rng_range(8, 64), rng_range(8, 64) } };
+    }
+    Bench_Run("QuickGame_Intersect_Transform", "scattered", run_intersect, c, 0, CALLS_PER_OP);
+
+    // Neighbours: about half overlap, so the branch pattern is unpredictable
+    for(usize j = 0; j < CALLS_PER_OP; j++) {
+        c->b[j] = c->a[j];
+        c->b[j].position.x += rng_range(-c->a[j].scale.x, c->a[j].scale.x);
+        c->b[j].position.y += rng_range(-c->a[j].scale.y, c->a[j].scale.y);
+    }
+    Bench_Run("QuickGame_Intersect_Transform", "neighbours", run_intersect, c, 0, CALLS_PER_OP);
+
+    free(c);
+}
+
+/*
+ * Netcode
+ */
+
+typedef struct {
+    u8* base; // NULL for a full snapshot
+    u8* current;
+    u8* encoded;
+    u8* decoded;
+    usize size;
+    i32 length;
+} DeltaCase;
+
+static void run_delta_encode(anyopaque* context, u64 iterations) {
+    DeltaCase* c = context;
+    for(u64 i = 0; i < iterations; i++)
+        c->length = QuickGame_Net_Delta_Encode(c->base, c->current, c->size, c->encoded, c->size + c->size / 128 + 1);
+    bench_sink += c->length;
+}
+
+static void run_delta_decode(anyopaque* context, u64 iterations) {
+    DeltaCase* c = context;
+    for(u64 i = 0; i < iterations; i++)
+        QuickGame_Net_Delta_Decode(c->base, c->encoded, c->length, c->decoded, c->size);
+    bench_sink += c->decoded[0];
+}
+
+typedef struct {
+    QGNet_t server;
+    QGNet_t client;
+    u8* state;
+    usize size;
+} SnapshotCase;
+
+// A client snapshot to the server and its answer, a few bytes of state change each way
+static void run_snapshot(anyopaque* context, u64 iterations) {
+    SnapshotCase* c = context;
+    for(u64 i = 0; i < iterations; i++) {
+        c->state[rng() % c->size]++;
+        QuickGame_Net_Send(c->client);
+        QuickGame_Net_Update(c->server);
+        QuickGame_Net_Send(c->server);
+        QuickGame_Net_Update(c->client);
+    }
+    bench_sink += c->client->peers[0].received;
+}
+
+static void bench_net() {
+    static const usize sizes[] = { 64, QG_NET_SNAPSHOT_MAX };
+    static const char* patterns[] = { "full", "sparse", "dense" };
+
+    for(usize i = 0; i < sizeof(sizes) / sizeof(usize); i++) {
+        usize size = sizes[i];
+        DeltaCase c = { random_bytes(size), random_bytes(size), malloc(size + size / 128 + 1), malloc(size), size, 0 };
+        u8* base = c.base;
+
+        for(usize p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+            // Sparse: one byte in 16 changed since the baseline, like a few moving entities
+            c.base = p == 0 ? NULL : base;
+            for(usize k = 0; k < size; k++)
+                c.current[k] = p == 1 && rng() % 16 != 0 ? base[k] : rng();
+
+            c.length = QuickGame_Net_Delta_Encode(c.base, c.current, size, c.encoded, size + size / 128 + 1);
+
+            char params[32];
+            snprintf(params, sizeof(params), "%s_%u", patterns[p], size);
+            Bench_Run("QuickGame_Net_Delta_Encode", params, run_delta_encode, &c, size, 1);
+            Bench_Run("QuickGame_Net_Delta_Decode", params, run_delta_decode, &c, size, 1);
+        }
+
+        free(base);
+        free(c.current);
+        free(c.encoded);
+        free(c.decoded);
+    }
+
+    // Both ends on loopback, ticking once a second so only the measured sends go out
+    QGNet_t server = QuickGame_Net_Create(0, 1);
+    QGNet_t client = QuickGame_Net_Create(0, 1);
+    QGNetAddress address;
+    if(!server || !client || QuickGame_Net_Address("127.0.0.1", server->port, &address) < 0) {
+        fprintf(stderr, "Could not open loopback endpoints\n");
+        QuickGame_Net_Destroy(&server);
+        QuickGame_Net_Destroy(&client);
+        return;
+    }
+
+    SnapshotCase c = { server, client, random_bytes(QG_NET_SNAPSHOT_MAX), QG_NET_SNAPSHOT_MAX };
+    u8* server_state = random_bytes(QG_NET_SNAPSHOT_MAX);
+    QuickGame_Net_Register(client, c.state, c.size, QG_NET_BLOCK_RAW);
+    QuickGame_Net_Register(server, server_state, c.size, QG_NET_BLOCK_RAW);
+    QuickGame_Net_Set_Timeout(server, 0xFFFFFFFF);
+    QuickGame_Net_Set_Timeout(client, 0xFFFFFFFF);
+    QuickGame_Net_Accept(server, true);
+    QuickGame_Net_Connect(client, &address);
+
+    char params[32];
+    snprintf(params, sizeof(params), "loopback_%u", c.size);
+    Bench_Run("QuickGame_Net_Send", params, run_snapshot, &c, c.size * 2.0, 2);
+
+    QuickGame_Net_Destroy(&server);
+    QuickGame_Net_Destroy(&client);
+    free(server_state);
+    free(c.state);
+}
+
+/*
+ * Audio decoding
+ */
+
+static u8* make_wav(u32 rate, u16 channels, u32 seconds, usize* size) {
+    u32 data_size = rate * channels * 2 * seconds;
+    *size = 44 + data_size;
+
+    u8* wav = malloc(*size);
+    memcpy(wav, "RIFF", 4);
+    *(u32*)(wav + 4) = 36 + data_size;
+    memcpy(wav + 8, "WAVEfmt ", 8);
+    *(u32*)(wav + 16) = 16;
+    *(u16*)(wav + 20) = 1;
+    *(u16*)(wav + 22) = channels;
+    *(u32*)(wav + 24) = rate;
+    *(u32*)(wav + 28) = rate * channels * 2;
+    *(u16*)(wav + 32) = channels * 2;
+    *(u16*)(wav + 34) = 16;
+    memcpy(wav + 36, "data", 4);
+    *(u32*)(wav + 40) = data_size;
+
+    for(u32 i = 0; i < data_size; i++)
+        wav[44 + i] = rng();
+
+    return wav;
+}
+
+static int rewind_sound(OSL_SOUND* sound, int voice) {
+    sound->playSound(sound);
+    return 1;
+}
+
+// Binds a sound to a voice the way oslPlaySound does, without starting the channel thread
+static void attach_voice(int voice, OSL_SOUND* sound) {
+    OSL_AUDIO_VOICE* v = &osl_audioVoices[voice];
+    v->numSamples = AUDIO_BUFFER_SAMPLES;
+    v->data = sound->data;
+    v->format = sound->format;
+    v->size = sound->size;
+    v->divider = sound->divider;
+    v->mono = sound->mono;
+    v->dataplus = sound->dataplus;
+    v->isStreamed = sound->isStreamed;
+    v->sound = sound;
+
+    sound->endCallback = rewind_sound;
+    sound->playSound(sound);
+}
+
+static void run_wav(anyopaque* context, u64 iterations) {
+    u8* buffer = context;
+    for(u64 i = 0; i < iterations; i++)
+        oslDecodeWav(0, buffer, AUDIO_BUFFER_SAMPLES);
+    bench_sink += buffer[0];
+}
+
+static void bench_wav() {
+    static const struct { u32 rate; u16 channels; const char* name; } formats[] = {
+        { 44100, 2, "44k_stereo" },
+        { 22050, 1, "22k_mono" },
+    };
+
+    u8* buffer = malloc(AUDIO_BUFFER_SAMPLES * 4);
+
+    for(usize i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        usize size;
+        u8* wav = make_wav(formats[i].rate, formats[i].channels, 2, &size);
+
+        OSL_VIRTUALFILENAME file = { "ram:/bench.wav", wav, size, &VF_MEMORY };
+        oslAddVirtualFileList(&file, 1);
+
+        for(int stream = 0; stream < 2; stream++) {
+            OSL_SOUND* sound = oslLoadSoundFileWAV(file.name, stream ? OSL_FMT_STREAM : OSL_FMT_NONE);
+            if(!sound) {
+                fprintf(stderr, "Could not load %s\n", formats[i].name);
+                continue;
+            }
+
+            attach_voice(0, sound);
+
+            char params[48];
+            snprintf(params, sizeof(params), "%s%s", formats[i].name, stream ? "_stream" : "");
+            Bench_Run("oslDecodeWav", params, run_wav, buffer, AUDIO_BUFFER_SAMPLES * 4.0, AUDIO_BUFFER_SAMPLES);
+
+            osl_audioVoices[0].sound = NULL;
+            oslDeleteSound(sound);
+        }
+
+        oslRemoveVirtualFileList(&file, 1);
+        free(wav);
+    }
+
+    free(buffer);
+}
+
+typedef struct {
+    BenchADGlobals ad;
+    u8* adpcm;
+    usize size;
+    short* out;
+    u32 divider;
+} AdpcmCase;
+
+static void run_adpcm(anyopaque* context, u64 iterations) {
+    AdpcmCase* c = context;
+
+    // Same arguments as the BGM audio callback for one buffer
+    u32 length = AUDIO_BUFFER_SAMPLES >> (c->divider + 1);
+    for(u64 i = 0; i < iterations; i++) {
+        if(c->ad.data + length > c->adpcm + c->size)
+            c->ad.data = c->adpcm;
+        oslDecodeADMono(&c->ad, c->out, c->ad.data, length << 1, 1 << c->divider, 0);
+    }
+    bench_sink += c->out[0];
+}
+
+static void bench_adpcm() {
+    static const struct { u32 divider; const char* name; } rates[] = {
+        { 0, "44k" },
+        { 1, "22k" },
+        { 2, "11k" },
+    };
+
+    for(usize i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        AdpcmCase c = { 0 };
+        c.size = 256 * 1024;
+        c.adpcm = random_bytes(c.size);
+        c.out = calloc(AUDIO_BUFFER_SAMPLES * 2, sizeof(short));
+        c.divider = rates[i].divider;
+        c.ad.data = c.adpcm;
+
+        f64 decoded = (AUDIO_BUFFER_SAMPLES >> (c.divider + 1)) << 1;
+        Bench_Run("oslDecodeADMono", rates[i].name, run_adpcm, &c, decoded * (1 << c.divider) * sizeof(short), decoded);
+
+        free(c.adpcm);
+        free(c.out);
+    }
+}
+
+/*
+ * Virtual files
+ */
+
+typedef struct {
+    VIRTUAL_FILE* file;
+    u8* buffer;
+    usize chunk;
+} ReadCase;
+
+static void run_read(anyopaque* context, u64 iterations) {
+    ReadCase* c = context;
+    for(u64 i = 0; i < iterations; i++) {
+        if(VirtualFileRead(c->buffer, 1, c->chunk, c->file) < (int)c->chunk)
+            VirtualFileSeek(c->file, 0, SEEK_SET);
+    }
+    bench_sink += c->buffer[0];
+}
+
+static void bench_virtual_files() {
+    const usize size = 4 * 1024 * 1024;
+    u8* data = random_bytes(size);
+
+    char path[] = "/tmp/qgbenchXXXXXX";
+    int fd = mkstemp(path);
+    if(fd < 0 || write(fd, data, size) != (ssize_t)size) {
+        fprintf(stderr, "Could not write %s\n", path);
+        free(data);
+        return;
+    }
+    close(fd);
+
+    static const usize chunks[] = { 64, 512, 4096, 65536 };
+    u8* buffer = malloc(65536);
+
+    for(usize i = 0; i < sizeof(chunks) / sizeof(usize); i++) {
+        ReadCase c = { VirtualFileOpen(data, size, VF_MEMORY, VF_O_READ), buffer, chunks[i] };
+
+        char params[32];
+        snprintf(params, sizeof(params), "memory_%u", chunks[i]);
+        Bench_Run("VirtualFileRead", params, run_read, &c, chunks[i], 1);
+        VirtualFileClose(c.file);
+
+        c.file = VirtualFileOpen(path, 0, VF_FILE, VF_O_READ);
+        if(c.file) {
+            snprintf(params, sizeof(params), "file_%u", chunks[i]);
+            Bench_Run("VirtualFileRead", params, run_read, &c, chunks[i], 1);
+            VirtualFileClose(c.file);
+        }
+    }
+
+    unlink(path);
+    free(buffer);
+    free(data);
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if(Bench_Parse_Options(argc, argv, &options) < 0)
+        return 1;
+
+    VirtualFileInit();
+    oslInitAudio();
+
+    Bench_Begin(&options);
+
+    bench_textures();
+    bench_tilemaps();
+    bench_atlas();
+    bench_intersect();
+    bench_net();
+    bench_wav();
+    bench_adpcm();
+    bench_virtual_files();
+
+    return Bench_End() < 0 ? 1 : 0;
+}
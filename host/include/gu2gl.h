@@ -0,0 +1,88 @@
+/**
+ * Host shim of gu2gl -- the GL-style wrappers map onto the shimmed sceGu calls,
+ * matrices are ignored. VRAM allocation is done from the host EDRAM block.
+ */
+#ifndef _HOST_GU2GL_H_
+#define _HOST_GU2GL_H_
+
+#include <pspgu.h>
+#include <pspgum.h>
+#include <pspdisplay.h>
+#include <pspge.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GL_PI 3.14159265358979f
+
+#define GL_DEPTH_TEST GU_DEPTH_TEST
+#define GL_BLEND GU_BLEND
+#define GL_TEXTURE_2D GU_TEXTURE_2D
+#define GL_ALPHA_TEST GU_ALPHA_TEST
+#define GL_SCISSOR_TEST GU_SCISSOR_TEST
+#define GL_CULL_FACE GU_CULL_FACE
+#define GL_CCW GU_CCW
+#define GL_CW GU_CW
+#define GL_PROJECTION 0
+#define GL_VIEW 1
+#define GL_MODEL 2
+#define GL_TFX_MODULATE GU_TFX_MODULATE
+#define GL_TFX_REPLACE GU_TFX_REPLACE
+#define GL_TCC_RGB GU_TCC_RGB
+#define GL_TCC_RGBA GU_TCC_RGBA
+#define GL_NEAREST GU_NEAREST
+#define GL_LINEAR GU_LINEAR
+#define GL_REPEAT GU_REPEAT
+#define GL_CLAMP GU_CLAMP
+#define GL_INDEX_16BIT GU_INDEX_16BIT
+#define GL_VERTEX_32BITF GU_VERTEX_32BITF
+#define GL_TEXTURE_32BITF GU_TEXTURE_32BITF
+#define GL_COLOR_8888 GU_COLOR_8888
+#define GL_TRANSFORM_3D GU_TRANSFORM_3D
+#define GL_TRANSFORM_2D GU_TRANSFORM_2D
+#define GL_TRIANGLES GU_TRIANGLES
+#define GL_LINE_STRIP GU_LINE_STRIP
+#define GL_COLOR_BUFFER_BIT GU_COLOR_BUFFER_BIT
+#define GL_DEPTH_BUFFER_BIT GU_DEPTH_BUFFER_BIT
+#define GL_STENCIL_BUFFER_BIT GU_STENCIL_BUFFER_BIT
+
+#define glEnable sceGuEnable
+#define glDisable sceGuDisable
+#define glBlendFunc sceGuBlendFunc
+#define glFrontFace sceGuFrontFace
+#define glColor sceGuColor
+#define glClearColor sceGuClearColor
+#define glClear sceGuClear
+#define glTexMode sceGuTexMode
+#define glTexFunc sceGuTexFunc
+#define glTexFilter sceGuTexFilter
+#define glTexWrap sceGuTexWrap
+#define glTexImage sceGuTexImage
+#define glDepthFunc sceGuDepthFunc
+#define glDepthMask sceGuDepthMask
+#define glAlphaFunc sceGuAlphaFunc
+
+void glMatrixMode(int mode);
+void glLoadIdentity(void);
+void glOrtho(float left, float right, float bottom, float top, float near, float far);
+void gluTranslate(const ScePspFVector3* v);
+void gluScale(const ScePspFVector3* v);
+void gluRotateX(float angle);
+void gluRotateY(float angle);
+void gluRotateZ(float angle);
+void glDrawElements(int prim, int vtype, int count, const void* indices, const void* vertices);
+
+void guglInit(void* list);
+void guglTerm(void);
+void guglStartFrame(void* list, int dialog);
+void guglSwapBuffers(int vsync, int dialog);
+
+void* getStaticVramBuffer(unsigned int width, unsigned int height, unsigned int psm);
+void* getStaticVramTexture(unsigned int width, unsigned int height, unsigned int psm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef _HOST_PSPAUDIO_H_
+#define _HOST_PSPAUDIO_H_
+
+#include <psptypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PSP_AUDIO_VOLUME_MAX 0x8000
+#define PSP_AUDIO_CHANNEL_MAX 8
+#define PSP_AUDIO_NEXT_CHANNEL (-1)
+#define PSP_AUDIO_SAMPLE_MIN 64
+#define PSP_AUDIO_SAMPLE_MAX 65472
+#define PSP_AUDIO_FORMAT_STEREO 0
+#define PSP_AUDIO_FORMAT_MONO 0x10
+
+int sceAudioChReserve(int channel, int samplecount, int format);
+int sceAudioChRelease(int channel);
+int sceAudioOutputPannedBlocking(int channel, int leftvol, int rightvol, void* buffer);
+int sceAudioChangeChannelConfig(int channel, int format);
+int sceAudioChangeChannelVolume(int channel, int leftvol, int rightvol);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
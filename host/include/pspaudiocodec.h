@@ -0,0 +1,6 @@
+#ifndef _HOST_PSPAUDIOCODEC_H_
+#define _HOST_PSPAUDIOCODEC_H_
+
+#include <psptypes.h>
+
+#endif
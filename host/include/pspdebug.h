@@ -0,0 +1,21 @@
+#ifndef _HOST_PSPDEBUG_H_
+#define _HOST_PSPDEBUG_H_
+
+#include <psptypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The debug screen prints to stdout
+void pspDebugScreenInit(void);
+void pspDebugScreenSetXY(int x, int y);
+int pspDebugScreenPrintf(const char* format, ...) __attribute__((format(printf, 1, 2)));
+void pspDebugScreenEnableBackColor(int enable);
+void pspDebugScreenClear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef _HOST_PSPDISPLAY_H_
+#define _HOST_PSPDISPLAY_H_
+
+#include <psptypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PSP_DISPLAY_SETBUF_IMMEDIATE 0
+#define PSP_DISPLAY_SETBUF_NEXTFRAME 1
+
+#define PSP_DISPLAY_PIXEL_FORMAT_565 0
+#define PSP_DISPLAY_PIXEL_FORMAT_5551 1
+#define PSP_DISPLAY_PIXEL_FORMAT_4444 2
+#define PSP_DISPLAY_PIXEL_FORMAT_8888 3
+
+int sceDisplayWaitVblankStart(void);
+int sceDisplaySetFrameBuf(void* topaddr, int bufferwidth, int pixelformat, int sync);
+unsigned int sceDisplayGetVcount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef _HOST_PSPGE_H_
+#define _HOST_PSPGE_H_
+
+#include <psptypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// EDRAM is an ordinary 2 MiB block on the host
+void* sceGeEdramGetAddr(void);
+unsigned int sceGeEdramGetSize(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
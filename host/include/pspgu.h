@@ -0,0 +1,141 @@
+#ifndef _HOST_PSPGU_H_
+#define _HOST_PSPGU_H_
+
+#include <psptypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GU_PSM_5650 0
+#define GU_PSM_5551 1
+#define GU_PSM_4444 2
+#define GU_PSM_8888 3
+
+#define GU_TEXTURE_32BITF (3)
+#define GU_COLOR_8888 (7 << 2)
+#define GU_VERTEX_32BITF (3 << 7)
+#define GU_INDEX_16BIT (2 << 11)
+#define GU_TRANSFORM_3D (0 << 23)
+#define GU_TRANSFORM_2D (1 << 23)
+
+#define GU_POINTS 0
+#define GU_LINES 1
+#define GU_LINE_STRIP 2
+#define GU_TRIANGLES 3
+#define GU_TRIANGLE_STRIP 4
+#define GU_TRIANGLE_FAN 5
+#define GU_SPRITES 6
+
+#define GU_ALPHA_TEST 0
+#define GU_DEPTH_TEST 1
+#define GU_SCISSOR_TEST 2
+#define GU_STENCIL_TEST 3
+#define GU_BLEND 4
+#define GU_CULL_FACE 5
+#define GU_DITHER 6
+#define GU_TEXTURE_2D 9
+#define GU_LIGHTING 10
+#define GU_CLIP_PLANES 15
+
+#define GU_NEVER 0
+#define GU_ALWAYS 1
+#define GU_EQUAL 2
+#define GU_NOTEQUAL 3
+#define GU_LESS 4
+#define GU_LEQUAL 5
+#define GU_GREATER 6
+#define GU_GEQUAL 7
+
+#define GU_ADD 0
+#define GU_SRC_COLOR 0
+#define GU_SRC_ALPHA 2
+#define GU_ONE_MINUS_SRC_ALPHA 3
+#define GU_FIX 10
+
+#define GU_CW 1
+#define GU_CCW 0
+#define GU_FLAT 0
+#define GU_SMOOTH 1
+#define GU_FALSE 0
+#define GU_TRUE 1
+
+#define GU_AMBIENT 1
+#define GU_DIFFUSE 2
+#define GU_SPECULAR 4
+
+#define GU_TFX_MODULATE 0
+#define GU_TFX_DECAL 1
+#define GU_TFX_BLEND 2
+#define GU_TFX_REPLACE 3
+#define GU_TFX_ADD 4
+#define GU_TCC_RGB 0
+#define GU_TCC_RGBA 1
+
+#define GU_NEAREST 0
+#define GU_LINEAR 1
+#define GU_REPEAT 0
+#define GU_CLAMP 1
+
+#define GU_COLOR_BUFFER_BIT 1
+#define GU_STENCIL_BUFFER_BIT 2
+#define GU_DEPTH_BUFFER_BIT 4
+
+#define GU_DIRECT 0
+#define GU_CALL 1
+#define GU_SEND 2
+
+#define GU_SYNC_FINISH 0
+#define GU_SYNC_WAIT 0
+
+void sceGuInit(void);
+void sceGuTerm(void);
+void sceGuStart(int cid, void* list);
+int sceGuFinish(void);
+int sceGuSync(int mode, int what);
+void* sceGuSwapBuffers(void);
+int sceGuDisplay(int state);
+void* sceGuGetMemory(int size);
+
+void sceGuDrawBuffer(int psm, void* fbp, int fbw);
+void sceGuDispBuffer(int width, int height, void* dispbp, int dispbw);
+void sceGuDepthBuffer(void* zbp, int zbw);
+void sceGuDrawBufferList(int psm, void* fbp, int fbw);
+void sceGuOffset(unsigned int x, unsigned int y);
+void sceGuViewport(int cx, int cy, int width, int height);
+void sceGuDepthRange(int near, int far);
+void sceGuScissor(int x, int y, int w, int h);
+
+void sceGuEnable(int state);
+void sceGuDisable(int state);
+void sceGuDepthFunc(int function);
+void sceGuDepthMask(int mask);
+void sceGuFrontFace(int order);
+void sceGuShadeModel(int mode);
+void sceGuAlphaFunc(int func, int value, int mask);
+void sceGuBlendFunc(int op, int src, int dest, unsigned int srcfix, unsigned int destfix);
+void sceGuColor(unsigned int color);
+void sceGuModelColor(unsigned int emissive, unsigned int ambient, unsigned int diffuse, unsigned int specular);
+void sceGuColorMaterial(int components);
+void sceGuAmbient(unsigned int color);
+void sceGuSetDither(const ScePspIMatrix4* matrix);
+void sceGuClearColor(unsigned int color);
+void sceGuClearDepth(unsigned int depth);
+void sceGuClear(int flags);
+
+void sceGuTexFlush(void);
+void sceGuTexMode(int tpsm, int maxmips, int a2, int swizzle);
+void sceGuTexFunc(int tfx, int tcc);
+void sceGuTexFilter(int min, int mag);
+void sceGuTexWrap(int u, int v);
+void sceGuTexImage(int mipmap, int width, int height, int tbw, const void* tbp);
+
+void sceGuDrawArray(int prim, int vtype, int count, const void* indices, const void* vertices);
+
+void guSwapBuffersBehaviour(int behaviour);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef _HOST_PSPGUM_H_
+#define _HOST_PSPGUM_H_
+
+#include <psptypes.h>
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef _HOST_PSPHPRM_H_
+#define _HOST_PSPHPRM_H_
+
+#include <psptypes.h>
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef _HOST_PSPIOFILEMGR_H_
+#define _HOST_PSPIOFILEMGR_H_
+
+#include <psptypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PSP_O_RDONLY 0x0001
+#define PSP_O_WRONLY 0x0002
+#define PSP_O_RDWR (PSP_O_RDONLY | PSP_O_WRONLY)
+#define PSP_O_NBLOCK 0x0004
+#define PSP_O_APPEND 0x0100
+#define PSP_O_CREAT 0x0200
+#define PSP_O_TRUNC 0x0400
+#define PSP_O_EXCL 0x0800
+
+#define PSP_SEEK_SET 0
+#define PSP_SEEK_CUR 1
+#define PSP_SEEK_END 2
+
+typedef struct {
+    unsigned short year, month, day, hour, minute, second;
+    unsigned int microsecond;
+} ScePspDateTime;
+
+// The SDK names the times st_ctime, st_atime and st_mtime, which glibc defines as macros
+typedef struct SceIoStat {
+    int st_mode;
+    unsigned int st_attr;
+    SceOff st_size;
+    ScePspDateTime sce_st_ctime;
+    ScePspDateTime sce_st_atime;
+    ScePspDateTime sce_st_mtime;
+    unsigned int st_private[6];
+} SceIoStat;
+
+SceUID sceIoOpen(const char* file, int flags, int mode);
+int sceIoClose(SceUID fd);
+int sceIoRead(SceUID fd, void* data, SceSize size);
+int sceIoWrite(SceUID fd, const void* data, SceSize size);
+SceOff sceIoLseek(SceUID fd, SceOff offset, int whence);
+int sceIoLseek32(SceUID fd, int offset, int whence);
+int sceIoGetstat(const char* file, SceIoStat* stat);
+int sceIoRemove(const char* file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
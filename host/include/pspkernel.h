@@ -0,0 +1,28 @@
+#ifndef _HOST_PSPKERNEL_H_
+#define _HOST_PSPKERNEL_H_
+
+#include <psptypes.h>
+#include <pspthreadman.h>
+#include <pspiofilemgr.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PSP_MODULE_INFO(name, attributes, major_version, minor_version)
+#define PSP_MAIN_THREAD_ATTR(attr)
+#define PSP_HEAP_SIZE_KB(size_kb)
+
+int sceKernelRegisterExitCallback(int cbid);
+void sceKernelExitGame(void);
+
+void sceKernelDcacheWritebackAll(void);
+void sceKernelDcacheWritebackInvalidateAll(void);
+void sceKernelDcacheWritebackRange(const void* p, unsigned int size);
+void sceKernelDcacheWritebackInvalidateRange(const void* p, unsigned int size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef _HOST_PSPMPEG_H_
+#define _HOST_PSPMPEG_H_
+
+#include <psptypes.h>
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef _HOST_PSPPOWER_H_
+#define _HOST_PSPPOWER_H_
+
+#include <psptypes.h>
+
+#endif
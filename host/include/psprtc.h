@@ -0,0 +1,17 @@
+#ifndef _HOST_PSPRTC_H_
+#define _HOST_PSPRTC_H_
+
+#include <psptypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int sceRtcGetCurrentTick(u64* tick);
+u32 sceRtcGetTickResolution(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef _HOST_PSPSDK_H_
+#define _HOST_PSPSDK_H_
+
+#include <psptypes.h>
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef _HOST_PSPTHREADMAN_H_
+#define _HOST_PSPTHREADMAN_H_
+
+#include <psptypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define THREAD_ATTR_USER 0x80000000
+#define THREAD_ATTR_VFPU 0x00004000
+#define PSP_THREAD_ATTR_USER THREAD_ATTR_USER
+#define PSP_THREAD_ATTR_VFPU THREAD_ATTR_VFPU
+
+typedef int (*SceKernelThreadEntry)(SceSize args, void* argp);
+typedef int (*SceKernelCallbackFunction)(int arg1, int arg2, void* arg);
+
+SceUID sceKernelCreateThread(const char* name, SceKernelThreadEntry entry, int priority, int stackSize, SceUInt attr, void* option);
+int sceKernelStartThread(SceUID thid, SceSize arglen, void* argp);
+int sceKernelWaitThreadEnd(SceUID thid, SceUInt* timeout);
+int sceKernelDeleteThread(SceUID thid);
+int sceKernelTerminateDeleteThread(SceUID thid);
+int sceKernelExitDeleteThread(int status);
+int sceKernelGetThreadId(void);
+int sceKernelDelayThread(SceUInt delay);
+int sceKernelSleepThread(void);
+int sceKernelSleepThreadCB(void);
+
+SceUID sceKernelCreateCallback(const char* name, SceKernelCallbackFunction func, void* arg);
+
+SceUID sceKernelCreateSema(const char* name, SceUInt attr, int initVal, int maxVal, void* option);
+int sceKernelDeleteSema(SceUID semaid);
+int sceKernelSignalSema(SceUID semaid, int signal);
+int sceKernelWaitSema(SceUID semaid, int signal, SceUInt* timeout);
+int sceKernelPollSema(SceUID semaid, int signal);
+
+SceInt64 sceKernelGetSystemTimeWide(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,37 @@
+/**
+ * Host shim of the PSP SDK headers -- only what QuickGame uses, implemented in host/psp_shim.c
+ */
+#ifndef _HOST_PSPTYPES_H_
+#define _HOST_PSPTYPES_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+typedef int SceUID;
+typedef unsigned int SceSize;
+typedef int SceSSize;
+typedef uint32_t SceUInt;
+typedef int32_t SceInt;
+typedef uint32_t SceUInt32;
+typedef int32_t SceInt32;
+typedef uint64_t SceUInt64;
+typedef int64_t SceInt64;
+typedef int64_t SceOff;
+typedef void SceVoid;
+
+typedef struct { float x, y, z; } ScePspFVector3;
+typedef struct { float x, y, z, w; } ScePspFVector4;
+typedef struct { int x, y, z, w; } ScePspIVector4;
+typedef struct { ScePspFVector4 x, y, z, w; } ScePspFMatrix4;
+typedef struct { ScePspIVector4 x, y, z, w; } ScePspIMatrix4;
+
+#endif
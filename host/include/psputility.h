@@ -0,0 +1,6 @@
+#ifndef _HOST_PSPUTILITY_H_
+#define _HOST_PSPUTILITY_H_
+
+#include <psptypes.h>
+
+#endif
@@ -0,0 +1,616 @@
+/**
+ * Host implementation of the PSP SDK calls QuickGame makes, so the engine builds and runs headless on
+ * Linux for benchmarks and tests. Rendering calls do nothing, EDRAM is a plain memory block, threads and
+ * semaphores map to pthreads, file IO to POSIX and audio output blocks for the duration of the buffer
+ * like the hardware does. Set QG_HOST_VSYNC=1 to have sceDisplayWaitVblankStart wait for a 59.94 Hz vblank.
+ */
+#include <pspkernel.h>
+#include <pspthreadman.h>
+#include <pspiofilemgr.h>
+#include <psprtc.h>
+#include <pspdisplay.h>
+#include <pspge.h>
+#include <pspgu.h>
+#include <pspctrl.h>
+#include <pspaudio.h>
+#include <pspdebug.h>
+#include <gu2gl.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define HOST_EDRAM_SIZE (2 * 1024 * 1024)
+#define HOST_GU_MEMORY_SIZE (1024 * 1024)
+#define HOST_MAX_THREADS 64
+#define HOST_MAX_SEMAS 64
+#define HOST_ERROR_WAIT_TIMEOUT ((int)0x800201A8)
+
+static u8 edram[HOST_EDRAM_SIZE] __attribute__((aligned(64)));
+static u32 vram_offset = 0;
+
+static u64 now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+/*
+ * Threads
+ */
+
+typedef struct {
+    bool used;
+    bool started;
+    SceKernelThreadEntry entry;
+    pthread_t thread;
+    SceSize args;
+    void* argp;
+} HostThread;
+
+static HostThread threads[HOST_MAX_THREADS];
+static pthread_mutex_t threads_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void* thread_main(void* data) {
+    HostThread* thread = data;
+    int status = thread->entry(thread->args, thread->argp);
+    return (void*)(intptr_t)status;
+}
+
+SceUID sceKernelCreateThread(const char* name, SceKernelThreadEntry entry, int priority, int stackSize, SceUInt attr, void* option) {
+    pthread_mutex_lock(&threads_lock);
+    for(int i = 0; i < HOST_MAX_THREADS; i++) {
+        if(threads[i].used)
+            continue;
+
+        memset(&threads[i], 0, sizeof(HostThread));
+        threads[i].used = true;
+        threads[i].entry = entry;
+        pthread_mutex_unlock(&threads_lock);
+        return i + 1;
+    }
+    pthread_mutex_unlock(&threads_lock);
+    return -1;
+}
+
+static HostThread* get_thread(SceUID thid) {
+    if(thid < 1 || thid > HOST_MAX_THREADS || !threads[thid - 1].used)
+        return NULL;
+    return &threads[thid - 1];
+}
+
+int sceKernelStartThread(SceUID thid, SceSize arglen, void* argp) {
+    HostThread* thread = get_thread(thid);
+    if(!thread || thread->started)
+        return -1;
+
+    // The kernel copies the arguments onto the new thread's stack
+    thread->args = arglen;
+    thread->argp = NULL;
+    if(arglen > 0 && argp) {
+        thread->argp = malloc(arglen);
+        memcpy(thread->argp, argp, arglen);
+    }
+
+    if(pthread_create(&thread->thread, NULL, thread_main, thread) != 0)
+        return -1;
+
+    thread->started = true;
+    return 0;
+}
+
+int sceKernelWaitThreadEnd(SceUID thid, SceUInt* timeout) {
+    HostThread* thread = get_thread(thid);
+    if(!thread || !thread->started)
+        return -1;
+
+    void* status;
+    pthread_join(thread->thread, &status);
+    thread->started = false;
+    return (int)(intptr_t)status;
+}
+
+int sceKernelDeleteThread(SceUID thid) {
+    HostThread* thread = get_thread(thid);
+    if(!thread)
+        return -1;
+
+    if(thread->started)
+        pthread_detach(thread->thread);
+
+    pthread_mutex_lock(&threads_lock);
+    free(thread->argp);
+    thread->used = false;
+    pthread_mutex_unlock(&threads_lock);
+    return 0;
+}
+
+int sceKernelTerminateDeleteThread(SceUID thid) {
+    HostThread* thread = get_thread(thid);
+    if(thread && thread->started)
+        pthread_cancel(thread->thread);
+
+    return sceKernelDeleteThread(thid);
+}
+
+int sceKernelExitDeleteThread(int status) {
+    // Nobody joins a thread that deletes itself, free its slot now
+    pthread_t self = pthread_self();
+    pthread_mutex_lock(&threads_lock);
+    for(int i = 0; i < HOST_MAX_THREADS; i++) {
+        if(threads[i].used && threads[i].started && pthread_equal(threads[i].thread, self)) {
+            pthread_detach(self);
+            free(threads[i].argp);
+            threads[i].used = false;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&threads_lock);
+
+    pthread_exit((void*)(intptr_t)status);
+}
+
+int sceKernelGetThreadId(void) {
+    pthread_t self = pthread_self();
+    for(int i = 0; i < HOST_MAX_THREADS; i++) {
+        if(threads[i].used && threads[i].started && pthread_equal(threads[i].thread, self))
+            return i + 1;
+    }
+    return 0;
+}
+
+int sceKernelDelayThread(SceUInt delay) {
+    usleep(delay);
+    return 0;
+}
+
+int sceKernelSleepThread(void) {
+    while(true)
+        pause();
+    return 0;
+}
+
+int sceKernelSleepThreadCB(void) {
+    return sceKernelSleepThread();
+}
+
+SceUID sceKernelCreateCallback(const char* name, SceKernelCallbackFunction func, void* arg) {
+    return 1;
+}
+
+int sceKernelRegisterExitCallback(int cbid) {
+    return 0;
+}
+
+void sceKernelExitGame(void) {
+    fflush(stdout);
+    exit(0);
+}
+
+SceInt64 sceKernelGetSystemTimeWide(void) {
+    return now_us();
+}
+
+void sceKernelDcacheWritebackAll(void) {}
+void sceKernelDcacheWritebackInvalidateAll(void) {}
+void sceKernelDcacheWritebackRange(const void* p, unsigned int size) {}
+void sceKernelDcacheWritebackInvalidateRange(const void* p, unsigned int size) {}
+
+/*
+ * Semaphores
+ */
+
+typedef struct {
+    bool used;
+    int count;
+    int max;
+    pthread_mutex_t lock;
+    pthread_cond_t signal;
+} HostSema;
+
+static HostSema semas[HOST_MAX_SEMAS];
+
+static HostSema* get_sema(SceUID semaid) {
+    if(semaid < 1 || semaid > HOST_MAX_SEMAS || !semas[semaid - 1].used)
+        return NULL;
+    return &semas[semaid - 1];
+}
+
+SceUID sceKernelCreateSema(const char* name, SceUInt attr, int initVal, int maxVal, void* option) {
+    pthread_mutex_lock(&threads_lock);
+    for(int i = 0; i < HOST_MAX_SEMAS; i++) {
+        if(semas[i].used)
+            continue;
+
+        semas[i].used = true;
+        semas[i].count = initVal;
+        semas[i].max = maxVal;
+        pthread_mutex_init(&semas[i].lock, NULL);
+        pthread_cond_init(&semas[i].signal, NULL);
+        pthread_mutex_unlock(&threads_lock);
+        return i + 1;
+    }
+    pthread_mutex_unlock(&threads_lock);
+    return -1;
+}
+
+int sceKernelDeleteSema(SceUID semaid) {
+    HostSema* sema = get_sema(semaid);
+    if(!sema)
+        return -1;
+
+    pthread_mutex_destroy(&sema->lock);
+    pthread_cond_destroy(&sema->signal);
+    sema->used = false;
+    return 0;
+}
+
+int sceKernelSignalSema(SceUID semaid, int signal) {
+    HostSema* sema = get_sema(semaid);
+    if(!sema)
+        return -1;
+
+    pthread_mutex_lock(&sema->lock);
+    sema->count += signal;
+    if(sema->count > sema->max)
+        sema->count = sema->max;
+    pthread_cond_broadcast(&sema->signal);
+    pthread_mutex_unlock(&sema->lock);
+    return 0;
+}
+
+int sceKernelWaitSema(SceUID semaid, int signal, SceUInt* timeout) {
+    HostSema* sema = get_sema(semaid);
+    if(!sema)
+        return -1;
+
+    struct timespec deadline;
+    if(timeout) {
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += *timeout / 1000000;
+        deadline.tv_nsec += (long)(*timeout % 1000000) * 1000;
+        if(deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+    }
+
+    pthread_mutex_lock(&sema->lock);
+    while(sema->count < signal) {
+        if(!timeout) {
+            pthread_cond_wait(&sema->signal, &sema->lock);
+        } else if(pthread_cond_timedwait(&sema->signal, &sema->lock, &deadline) == ETIMEDOUT) {
+            pthread_mutex_unlock(&sema->lock);
+            *timeout = 0;
+            return HOST_ERROR_WAIT_TIMEOUT;
+        }
+    }
+    sema->count -= signal;
+    pthread_mutex_unlock(&sema->lock);
+    return 0;
+}
+
+int sceKernelPollSema(SceUID semaid, int signal) {
+    HostSema* sema = get_sema(semaid);
+    if(!sema)
+        return -1;
+
+    pthread_mutex_lock(&sema->lock);
+    int result = -1;
+    if(sema->count >= signal) {
+        sema->count -= signal;
+        result = 0;
+    }
+    pthread_mutex_unlock(&sema->lock);
+    return result;
+}
+
+/*
+ * File IO
+ */
+
+SceUID sceIoOpen(const char* file, int flags, int mode) {
+    int posix = 0;
+    if((flags & PSP_O_RDWR) == PSP_O_RDWR)
+        posix = O_RDWR;
+    else if(flags & PSP_O_WRONLY)
+        posix = O_WRONLY;
+    else
+        posix = O_RDONLY;
+
+    if(flags & PSP_O_APPEND)
+        posix |= O_APPEND;
+    if(flags & PSP_O_CREAT)
+        posix |= O_CREAT;
+    if(flags & PSP_O_TRUNC)
+        posix |= O_TRUNC;
+    if(flags & PSP_O_EXCL)
+        posix |= O_EXCL;
+
+    // Device prefixes such as "umd0:/" or "ms0:/" have no meaning here
+    const char* colon = strstr(file, ":/");
+    if(colon)
+        file = colon + 2;
+
+    int fd = open(file, posix, mode);
+    return fd < 0 ? -errno : fd;
+}
+
+int sceIoClose(SceUID fd) {
+    return close(fd);
+}
+
+int sceIoRead(SceUID fd, void* data, SceSize size) {
+    return read(fd, data, size);
+}
+
+int sceIoWrite(SceUID fd, const void* data, SceSize size) {
+    return write(fd, data, size);
+}
+
+SceOff sceIoLseek(SceUID fd, SceOff offset, int whence) {
+    return lseek(fd, offset, whence == PSP_SEEK_END ? SEEK_END : whence == PSP_SEEK_CUR ? SEEK_CUR : SEEK_SET);
+}
+
+int sceIoLseek32(SceUID fd, int offset, int whence) {
+    return (int)sceIoLseek(fd, offset, whence);
+}
+
+int sceIoGetstat(const char* file, SceIoStat* stat_out) {
+    const char* colon = strstr(file, ":/");
+    if(colon)
+        file = colon + 2;
+
+    struct stat st;
+    if(stat(file, &st) < 0)
+        return -errno;
+
+    memset(stat_out, 0, sizeof(SceIoStat));
+    stat_out->st_mode = st.st_mode;
+    stat_out->st_size = st.st_size;
+    return 0;
+}
+
+int sceIoRemove(const char* file) {
+    return unlink(file);
+}
+
+/*
+ * Clock and display
+ */
+
+int sceRtcGetCurrentTick(u64* tick) {
+    *tick = now_us();
+    return 0;
+}
+
+u32 sceRtcGetTickResolution(void) {
+    return 1000000;
+}
+
+static unsigned int vcount = 0;
+
+int sceDisplayWaitVblankStart(void) {
+    static int vsync = -1;
+    if(vsync < 0) {
+        const char* env = getenv("QG_HOST_VSYNC");
+        vsync = env != NULL && atoi(env) != 0;
+    }
+
+    if(vsync) {
+        const u64 period = 16683;
+        u64 now = now_us();
+        usleep(period - now % period);
+    }
+
+    vcount++;
+    return 0;
+}
+
+int sceDisplaySetFrameBuf(void* topaddr, int bufferwidth, int pixelformat, int sync) {
+    return 0;
+}
+
+unsigned int sceDisplayGetVcount(void) {
+    return vcount;
+}
+
+void* sceGeEdramGetAddr(void) {
+    return edram;
+}
+
+unsigned int sceGeEdramGetSize(void) {
+    return HOST_EDRAM_SIZE;
+}
+
+/*
+ * GU -- commands are dropped, only memory handed out for display lists is real
+ */
+
+static u8 gu_memory[HOST_GU_MEMORY_SIZE] __attribute__((aligned(16)));
+static u32 gu_offset = 0;
+
+void sceGuInit(void) {}
+void sceGuTerm(void) {}
+
+void sceGuStart(int cid, void* list) {
+    gu_offset = 0;
+}
+
+int sceGuFinish(void) { return 0; }
+int sceGuSync(int mode, int what) { return 0; }
+void* sceGuSwapBuffers(void) { return NULL; }
+int sceGuDisplay(int state) { return 0; }
+
+void* sceGuGetMemory(int size) {
+    size = (size + 15) & ~15;
+    if(gu_offset + size > HOST_GU_MEMORY_SIZE)
+        gu_offset = 0;
+
+    void* result = gu_memory + gu_offset;
+    gu_offset += size;
+    return result;
+}
+
+void sceGuDrawBuffer(int psm, void* fbp, int fbw) {}
+void sceGuDispBuffer(int width, int height, void* dispbp, int dispbw) {}
+void sceGuDepthBuffer(void* zbp, int zbw) {}
+void sceGuDrawBufferList(int psm, void* fbp, int fbw) {}
+void sceGuOffset(unsigned int x, unsigned int y) {}
+void sceGuViewport(int cx, int cy, int width, int height) {}
+void sceGuDepthRange(int near, int far) {}
+void sceGuScissor(int x, int y, int w, int h) {}
+void sceGuEnable(int state) {}
+void sceGuDisable(int state) {}
+void sceGuDepthFunc(int function) {}
+void sceGuDepthMask(int mask) {}
+void sceGuFrontFace(int order) {}
+void sceGuShadeModel(int mode) {}
+void sceGuAlphaFunc(int func, int value, int mask) {}
+void sceGuBlendFunc(int op, int src, int dest, unsigned int srcfix, unsigned int destfix) {}
+void sceGuColor(unsigned int color) {}
+void sceGuModelColor(unsigned int emissive, unsigned int ambient, unsigned int diffuse, unsigned int specular) {}
+void sceGuColorMaterial(int components) {}
+void sceGuAmbient(unsigned int color) {}
+void sceGuSetDither(const ScePspIMatrix4* matrix) {}
+void sceGuClearColor(unsigned int color) {}
+void sceGuClearDepth(unsigned int depth) {}
+void sceGuClear(int flags) {}
+void sceGuTexFlush(void) {}
+void sceGuTexMode(int tpsm, int maxmips, int a2, int swizzle) {}
+void sceGuTexFunc(int tfx, int tcc) {}
+void sceGuTexFilter(int min, int mag) {}
+void sceGuTexWrap(int u, int v) {}
+void sceGuTexImage(int mipmap, int width, int height, int tbw, const void* tbp) {}
+void sceGuDrawArray(int prim, int vtype, int count, const void* indices, const void* vertices) {}
+void guSwapBuffersBehaviour(int behaviour) {}
+
+void glMatrixMode(int mode) {}
+void glLoadIdentity(void) {}
+void glOrtho(float left, float right, float bottom, float top, float near, float far) {}
+void gluTranslate(const ScePspFVector3* v) {}
+void gluScale(const ScePspFVector3* v) {}
+void gluRotateX(float angle) {}
+void gluRotateY(float angle) {}
+void gluRotateZ(float angle) {}
+void glDrawElements(int prim, int vtype, int count, const void* indices, const void* vertices) {}
+
+void guglInit(void* list) {}
+void guglTerm(void) {}
+void guglStartFrame(void* list, int dialog) {
+    gu_offset = 0;
+}
+void guglSwapBuffers(int vsync, int dialog) {
+    if(vsync)
+        sceDisplayWaitVblankStart();
+}
+
+static u32 vram_size(unsigned int width, unsigned int height, unsigned int psm) {
+    return width * height * (psm == GU_PSM_8888 ? 4 : 2);
+}
+
+// Like gu2gl: buffers are offsets into EDRAM, textures are addresses
+void* getStaticVramBuffer(unsigned int width, unsigned int height, unsigned int psm) {
+    u32 size = vram_size(width, height, psm);
+    if(vram_offset + size > HOST_EDRAM_SIZE)
+        return NULL;
+
+    void* result = (void*)(uintptr_t)vram_offset;
+    vram_offset += size;
+    return result;
+}
+
+void* getStaticVramTexture(unsigned int width, unsigned int height, unsigned int psm) {
+    u32 size = vram_size(width, height, psm);
+    if(vram_offset + size > HOST_EDRAM_SIZE)
+        return NULL;
+
+    void* result = edram + vram_offset;
+    vram_offset += size;
+    return result;
+}
+
+/*
+ * Controller -- nothing is pressed
+ */
+
+int sceCtrlSetSamplingCycle(int cycle) { return 0; }
+int sceCtrlSetSamplingMode(int mode) { return 0; }
+
+int sceCtrlPeekBufferPositive(SceCtrlData* pad_data, int count) {
+    memset(pad_data, 0, sizeof(SceCtrlData) * count);
+    for(int i = 0; i < count; i++) {
+        pad_data[i].TimeStamp = (unsigned int)now_us();
+        pad_data[i].Lx = 128;
+        pad_data[i].Ly = 128;
+    }
+    return count;
+}
+
+int sceCtrlReadBufferPositive(SceCtrlData* pad_data, int count) {
+    return sceCtrlPeekBufferPositive(pad_data, count);
+}
+
+/*
+ * Audio -- output blocks for as long as the hardware would take to play the buffer
+ */
+
+static int audio_samples[PSP_AUDIO_CHANNEL_MAX];
+static bool audio_reserved[PSP_AUDIO_CHANNEL_MAX];
+
+int sceAudioChReserve(int channel, int samplecount, int format) {
+    if(channel == PSP_AUDIO_NEXT_CHANNEL) {
+        for(channel = 0; channel < PSP_AUDIO_CHANNEL_MAX && audio_reserved[channel]; channel++);
+    }
+
+    if(channel < 0 || channel >= PSP_AUDIO_CHANNEL_MAX || audio_reserved[channel])
+        return -1;
+
+    audio_reserved[channel] = true;
+    audio_samples[channel] = samplecount;
+    return channel;
+}
+
+int sceAudioChRelease(int channel) {
+    if(channel < 0 || channel >= PSP_AUDIO_CHANNEL_MAX)
+        return -1;
+
+    audio_reserved[channel] = false;
+    return 0;
+}
+
+int sceAudioOutputPannedBlocking(int channel, int leftvol, int rightvol, void* buffer) {
+    if(channel < 0 || channel >= PSP_AUDIO_CHANNEL_MAX)
+        return -1;
+
+    usleep((u64)audio_samples[channel] * 1000000ULL / 44100);
+    return audio_samples[channel];
+}
+
+int sceAudioChangeChannelConfig(int channel, int format) { return 0; }
+int sceAudioChangeChannelVolume(int channel, int leftvol, int rightvol) { return 0; }
+
+/*
+ * Debug screen
+ */
+
+void pspDebugScreenInit(void) {}
+void pspDebugScreenSetXY(int x, int y) {}
+void pspDebugScreenEnableBackColor(int enable) {}
+void pspDebugScreenClear(void) {}
+
+int pspDebugScreenPrintf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int result = vprintf(format, args);
+    va_end(args);
+    return result;
+}
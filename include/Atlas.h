@@ -0,0 +1,68 @@
+/**
+ * @file Atlas.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief
+ * @version 1.0
+ * @date 2022-10-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef _ATLAS_INCLUDED_H_
+#define _ATLAS_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates an atlas and precomputes the texture coordinates of every tile
+ *
+ * @param texture Texture the atlas refers to -- not owned by the atlas
+ * @param info Layout of the atlas (columns, rows, margin and padding in pixels)
+ * @return QGAtlas_t Atlas or NULL on failure
+ */
+QGAtlas_t QuickGame_Atlas_Create(QGTexture_t texture, QGAtlasInfo info);
+
+/**
+ * @brief Creates an atlas from a legacy texture atlas size
+ *
+ * @param texture Texture the atlas refers to -- not owned by the atlas
+ * @param atlas Number of tiles across and down
+ * @return QGAtlas_t Atlas or NULL on failure
+ */
+QGAtlas_t QuickGame_Atlas_Create_Alt(QGTexture_t texture, QGTextureAtlas atlas);
+
+/**
+ * @brief Destroys an atlas
+ *
+ * @param atlas Atlas to destroy -- also gets set to null.
+ */
+void QuickGame_Atlas_Destroy(QGAtlas_t* atlas);
+
+/**
+ * @brief Gets the precomputed texture coordinates of a tile
+ *
+ * @param atlas Atlas to use
+ * @param idx Index of the tile, wraps around when out of range
+ * @return const f32* QG_ATLAS_UV_STRIDE floats (u0, v0, u1, v1) or NULL on failure
+ */
+const f32* QuickGame_Atlas_UV(const QGAtlas_t atlas, usize idx);
+
+/**
+ * @brief Gets quad texture coordinates of a tile in the same layout as QuickGame_Atlas_Index_Coords
+ *
+ * @param atlas Atlas to use
+ * @param buf Buffer of 8 floats to fill with the coordinates
+ * @param idx Index of the tile
+ */
+void QuickGame_Atlas_Get_Coords(const QGAtlas_t atlas, f32* buf, const usize idx);
+
+#if __cplusplus
+};
+#endif
+
+#endif
@@ -19,13 +19,14 @@ extern "C" {
 #endif
 
 /**
- * @brief Initializes the audio subsystem
+ * @brief Initializes the audio subsystem, does nothing if it is already initialized.
+ * Loading the first clip calls it, so calling it up front is only needed to move the cost.
  * 
  */
 void QuickGame_Audio_Init();
 
 /**
- * @brief Terminates the audio subsystem
+ * @brief Terminates the audio subsystem if it was initialized
  * 
  */
 void QuickGame_Audio_Terminate();
@@ -40,6 +41,17 @@ void QuickGame_Audio_Terminate();
  */
 QGAudioClip_t QuickGame_Audio_Load(const char* filename, bool looping, bool streaming);
 
+/**
+ * @brief Loads an audio clip from a file already read to memory, without touching the disk
+ * 
+ * @param filename File name, its extension picks the format (.wav or .bgm)
+ * @param data Contents of the file, can be freed once this returns
+ * @param size Size of data in bytes
+ * @param looping Whether or not the audio is looping
+ * @return QGAudioClip_t Result audio clip or NULL on failure
+ */
+QGAudioClip_t QuickGame_Audio_Load_Memory(const char* filename, const u8* data, usize size, bool looping);
+
 /**
  * @brief Audio Destroy
  * 
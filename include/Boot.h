@@ -0,0 +1,94 @@
+/**
+ * @file Boot.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Startup phase timing and the splash frame
+ * @version 1.0
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef _BOOT_INCLUDED_H_
+#define _BOOT_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_BOOT_PHASES_MAX 32
+
+/**
+ * @brief A timed startup phase, times are in microseconds since the boot clock started.
+ * Lazily initialized subsystems record their phase when first used.
+ */
+typedef struct {
+    const char* name;
+    u64 start;
+    u64 duration;
+} QGBootPhase;
+
+/**
+ * @brief Draws the splash frame, called between a clear and the first present.
+ * Only graphics are initialized at that point.
+ */
+typedef void (*QGSplashCallback)(void);
+
+/**
+ * @brief Starts the boot clock, does nothing if it is already running.
+ * QuickGame_Init() starts it, call this first thing in main() to include earlier work.
+ *
+ */
+void QuickGame_Boot_Start();
+
+/**
+ * @brief Gets the time since the boot clock started, starting it if needed
+ *
+ * @return u64 Microseconds
+ */
+u64 QuickGame_Boot_Time();
+
+/**
+ * @brief Records a phase that ran from start until now. Phases past QG_BOOT_PHASES_MAX are dropped.
+ *
+ * @param name Name of the phase -- must outlive the boot stats, a string literal
+ * @param start Start of the phase from QuickGame_Boot_Time()
+ */
+void QuickGame_Boot_Phase(const char* name, u64 start);
+
+/**
+ * @brief Gets the recorded phases in the order they finished
+ *
+ * @param count Number of phases
+ * @return const QGBootPhase* Phases
+ */
+const QGBootPhase* QuickGame_Boot_Phases(usize* count);
+
+/**
+ * @brief Gets the time to the first presented frame
+ *
+ * @return u64 Microseconds or 0 if no frame was presented during boot
+ */
+u64 QuickGame_Boot_First_Frame();
+
+/**
+ * @brief Sets the function drawing the splash frame, must be called before QuickGame_Init()
+ *
+ * @param splash Splash callback or NULL to present a cleared frame
+ */
+void QuickGame_Boot_Set_Splash(QGSplashCallback splash);
+
+/**
+ * @brief Presents the splash frame and records it as the first frame. Called by QuickGame_Init()
+ * right after graphics, before the other subsystems.
+ *
+ */
+void QuickGame_Boot_Splash();
+
+#if __cplusplus
+};
+#endif
+
+#endif
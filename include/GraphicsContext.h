@@ -18,12 +18,89 @@
 extern "C" {
 #endif
 
+/**
+ * GE vertex format flags, same values as GU_TEXTURE_32BITF, GU_COLOR_8888, GU_VERTEX_32BITF and GU_INDEX_16BIT
+ */
+#define QG_VFMT_TEXTURE_32BITF (3 << 0)
+#define QG_VFMT_COLOR_8888 (7 << 2)
+#define QG_VFMT_VERTEX_32BITF (3 << 7)
+#define QG_VFMT_INDEX_16BIT (2 << 11)
+
+/**
+ * Framebuffer pixel formats, same values as GU_PSM_5650, GU_PSM_5551, GU_PSM_4444 and GU_PSM_8888
+ */
+#define QG_PSM_5650 0
+#define QG_PSM_5551 1
+#define QG_PSM_4444 2
+#define QG_PSM_8888 3
+
+typedef enum {
+    QG_VSYNC_OFF = 0,
+    QG_VSYNC_ON = 1,
+    QG_VSYNC_ADAPTIVE = 2
+} QGVsyncMode;
+
+/**
+ * @brief Display setup passed at initialization.
+ * 16-bit formats halve framebuffer bandwidth and are dithered. With 3 buffers frames are queued
+ * for the next vblank and the CPU only waits when it gets two frames ahead -- three 32-bit buffers
+ * leave little VRAM for textures.
+ * Adaptive vsync waits for vblank when a frame is early and swaps immediately (tearing) when it is late.
+ */
+typedef struct {
+    u32 format;
+    u8 buffer_count;
+    u8 vsync;
+} QGDisplayConfig;
+
+/**
+ * @brief Per-frame culling counters
+ * 
+ */
+typedef struct {
+    usize drawn;
+    usize culled;
+} QGCullStats;
+
+/**
+ * @brief Draw categories of the coverage estimate
+ * 
+ */
+typedef enum {
+    QG_COVERAGE_SPRITE = 0,
+    QG_COVERAGE_TILEMAP = 1,
+    QG_COVERAGE_PRIMITIVE = 2,
+    QG_COVERAGE_CATEGORIES = 3
+} QGCoverageCategory;
+
+/**
+ * @brief Per-frame CPU estimate of the pixels each draw category covers, from on-screen bounds
+ * 
+ */
+typedef struct {
+    f32 pixels[QG_COVERAGE_CATEGORIES];
+    f32 overdraw; // Total covered pixels over the screen's pixels
+} QGCoverageStats;
+
+/**
+ * @brief Added per covering draw in overdraw mode (0xAABBGGRR), a pixel saturates to white after 8 layers
+ */
+#define QG_OVERDRAW_INCREMENT 0xFF081020
+
 /**
  * @brief Initializes the graphics context
  * 
  */
 void QuickGame_Graphics_Init();
 
+/**
+ * @brief Initializes the graphics context with a display configuration
+ * 
+ * @param config Framebuffer format, buffer count (2 or 3) and vsync mode
+ * @return i32 < 0 on failure (invalid configuration)
+ */
+i32 QuickGame_Graphics_Init_Alt(const QGDisplayConfig* config);
+
 /**
  * @brief Terminates the graphics context
  * 
@@ -44,6 +121,28 @@ void QuickGame_Graphics_Set_Dialog_Mode(bool mode);
  */
 void QuickGame_Graphics_Set_Wireframe_Mode(bool mode);
 
+/**
+ * @brief Sets overdraw mode -- every draw adds QG_OVERDRAW_INCREMENT to the pixels it covers instead of its
+ * colors, turning the frame into a heatmap of how many times each pixel was written. Clear to black to read it.
+ * 
+ * @param mode Draw in overdraw mode?
+ */
+void QuickGame_Graphics_Set_Overdraw_Mode(bool mode);
+
+/**
+ * @brief Sets whether draws add their estimated on-screen area to the coverage stats
+ * 
+ * @param mode Estimate coverage?
+ */
+void QuickGame_Graphics_Set_Coverage_Estimate(bool mode);
+
+/**
+ * @brief Tells whether coverage is being estimated
+ * 
+ * @return true Draws should report their coverage
+ */
+bool QuickGame_Graphics_Coverage_Enabled();
+
 /**
  * @brief Starts a new frame
  * 
@@ -53,7 +152,7 @@ void QuickGame_Graphics_Start_Frame();
 /**
  * @brief Ends the frame and draws to screen
  * 
- * @param vsync Whether or not to VSync?
+ * @param vsync Whether or not to VSync? When true the configured vsync mode is used.
  */
 void QuickGame_Graphics_End_Frame(bool vsync);
 
@@ -99,6 +198,99 @@ void QuickGame_Graphics_Set_Camera(QGCamera2D* camera);
  */
 void QuickGame_Graphics_Unset_Camera();
 
+/**
+ * @brief Gets the camera currently tracked
+ * 
+ * @return QGCamera2D* Camera or NULL if none is set
+ */
+QGCamera2D* QuickGame_Graphics_Get_Camera();
+
+/**
+ * @brief Gets the world-space rectangle the screen covers this frame, set by StartFrame() from the camera (rotation included)
+ * 
+ * @param min Bottom-left corner of the rectangle
+ * @param max Top-right corner of the rectangle
+ */
+void QuickGame_Graphics_Get_View_Rect(QGVector2* min, QGVector2* max);
+
+/**
+ * @brief Tests a centered, possibly rotated transform against the view rectangle
+ * 
+ * @param transform Position, Rotation, Size
+ * @return true Transform may be on screen
+ * @return false Transform is entirely off screen
+ */
+bool QuickGame_Graphics_Visible(QGTransform2D transform);
+
+/**
+ * @brief Tests a transform against the view rectangle, for meshes that do not span the unit square
+ * 
+ * @param transform Position, Rotation, Size
+ * @param extent Half extents of the mesh in units of the scale, 0.5 for the unit square
+ * @return true Transform may be on screen
+ * @return false Transform is entirely off screen
+ */
+bool QuickGame_Graphics_Visible_Extent(QGTransform2D transform, QGVector2 extent);
+
+/**
+ * @brief Tests a transform against the view rectangle and counts it in the stats when culled
+ * 
+ * @param transform Position, Rotation, Size
+ * @return true Transform is off screen and should not be drawn
+ * @return false Transform should be drawn
+ */
+bool QuickGame_Graphics_Cull(QGTransform2D transform);
+
+/**
+ * @brief Culls a transform like QuickGame_Graphics_Cull(), with the half extents of its mesh
+ * 
+ * @param transform Position, Rotation, Size
+ * @param extent Half extents of the mesh in units of the scale, 0.5 for the unit square
+ * @return true Transform is off screen and should not be drawn
+ * @return false Transform should be drawn
+ */
+bool QuickGame_Graphics_Cull_Extent(QGTransform2D transform, QGVector2 extent);
+
+/**
+ * @brief Gets the culling counters of the previous frame
+ * 
+ * @return QGCullStats Meshes drawn and objects culled
+ */
+QGCullStats QuickGame_Graphics_Get_Cull_Stats();
+
+/**
+ * @brief Adds the on-screen area of a centered, possibly rotated transform to the coverage estimate.
+ * Does nothing unless the estimate is enabled.
+ * 
+ * @param category QGCoverageCategory of the draw
+ * @param transform Position, Rotation, Size
+ */
+void QuickGame_Graphics_Estimate_Coverage(u8 category, QGTransform2D transform);
+
+/**
+ * @brief Adds the on-screen area of a transform to the coverage estimate, with the half extents of its mesh
+ * 
+ * @param category QGCoverageCategory of the draw
+ * @param transform Position, Rotation, Size
+ * @param extent Half extents of the mesh in units of the scale, 0.5 for the unit square
+ */
+void QuickGame_Graphics_Estimate_Coverage_Extent(u8 category, QGTransform2D transform, QGVector2 extent);
+
+/**
+ * @brief Adds covered pixels to the coverage estimate. Does nothing unless the estimate is enabled.
+ * 
+ * @param category QGCoverageCategory of the draw
+ * @param pixels Pixels covered
+ */
+void QuickGame_Graphics_Add_Coverage(u8 category, f32 pixels);
+
+/**
+ * @brief Gets the coverage estimate of the previous frame
+ * 
+ * @return QGCoverageStats Covered pixels per category
+ */
+QGCoverageStats QuickGame_Graphics_Get_Coverage_Stats();
+
 /**
  * @brief Destroys a Graphics Mesh and sets pointer to NULL.
  * 
@@ -113,6 +305,24 @@ void QuickGame_Graphics_Destroy_Mesh(QGVMesh_t* mesh);
  */
 void QuickGame_Graphics_Draw_Mesh(QGVMesh_t mesh);
 
+/**
+ * @brief Draws a range of the indices of a Graphics Mesh
+ * 
+ * @param mesh Mesh to draw
+ * @param first First index to draw
+ * @param count Number of indices to draw
+ */
+void QuickGame_Graphics_Draw_Mesh_Range(QGVMesh_t mesh, usize first, usize count);
+
+/**
+ * @brief Draws a Graphics Mesh with a vertex format known ahead of time, skipping the vertex type lookup.
+ * Formats without texture coordinates unbind the texture.
+ * 
+ * @param mesh Mesh to draw
+ * @param format Combination of QG_VFMT flags matching the mesh vertices
+ */
+void QuickGame_Graphics_Draw_Mesh_Format(QGVMesh_t mesh, u32 format);
+
 #if __cplusplus
 };
 #endif
@@ -0,0 +1,138 @@
+/**
+ * @file Handle.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Generational handles to textures, meshes, sprites and audio clips
+ * @version 1.0
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef _HANDLE_INCLUDED_H_
+#define _HANDLE_INCLUDED_H_
+
+#include <Types.h>
+#include <Sprite.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Handle layout, most significant first: type (2 bits) | generation (14) | slot index (16)
+ * Generations start at 1, so a valid handle is never QG_NULL_HANDLE.
+ */
+typedef u32 QGHandle;
+
+#define QG_NULL_HANDLE 0
+#define QG_HANDLE_INDEX_BITS 16
+#define QG_HANDLE_GENERATION_BITS 14
+#define QG_HANDLE_TYPE_SHIFT (QG_HANDLE_INDEX_BITS + QG_HANDLE_GENERATION_BITS)
+
+typedef enum {
+    QG_HANDLE_TEXTURE = 0,
+    QG_HANDLE_MESH = 1,
+    QG_HANDLE_SPRITE = 2,
+    QG_HANDLE_CLIP = 3,
+    QG_HANDLE_TYPES = 4
+} QGHandleType;
+
+/**
+ * @brief Registers a resource in the table of its type, holding one reference. Resource pointers
+ * are kept packed, so the table can be walked without gaps, and a resource can be moved with Relocate.
+ *
+ * @param type QGHandleType of the resource
+ * @param resource Resource to register
+ * @return QGHandle Handle or QG_NULL_HANDLE on failure
+ */
+QGHandle QuickGame_Handle_Create(u8 type, anyopaque* resource);
+
+/**
+ * @brief Looks up a resource in O(1)
+ *
+ * @param handle Handle
+ * @param type Expected QGHandleType
+ * @return anyopaque* Resource or NULL if the handle is stale or of another type
+ */
+anyopaque* QuickGame_Handle_Get(QGHandle handle, u8 type);
+
+/**
+ * @brief Tells whether a handle still refers to a resource
+ *
+ * @param handle Handle
+ * @return true The resource is registered
+ */
+bool QuickGame_Handle_Valid(QGHandle handle);
+
+/**
+ * @brief Adds a reference to a resource, for objects that use it through its pointer
+ *
+ * @param handle Handle
+ * @return i32 < 0 if the handle is stale or the resource has too many references
+ */
+i32 QuickGame_Handle_Retain(QGHandle handle);
+
+/**
+ * @brief Unregisters a resource without destroying it, whatever its references -- the handle and its copies become stale
+ *
+ * @param handle Handle
+ * @return anyopaque* Resource or NULL if the handle was already stale
+ */
+anyopaque* QuickGame_Handle_Release(QGHandle handle);
+
+/**
+ * @brief Drops a reference to a resource. The last one unregisters the resource and destroys
+ * it with the destroy function of its type, until then the handle stays valid.
+ *
+ * @param handle Handle, nothing happens if it is stale
+ */
+void QuickGame_Handle_Destroy(QGHandle handle);
+
+/**
+ * @brief Points a handle at a resource that moved
+ *
+ * @param handle Handle
+ * @param resource New address of the resource
+ * @return i32 < 0 if the handle is stale
+ */
+i32 QuickGame_Handle_Relocate(QGHandle handle, anyopaque* resource);
+
+/**
+ * @brief Gets the number of resources registered with a type
+ *
+ * @param type QGHandleType
+ * @return usize Number of resources
+ */
+usize QuickGame_Handle_Count(u8 type);
+
+/**
+ * @brief Gets a resource by its place in the packed table, order changes when resources are released
+ *
+ * @param type QGHandleType
+ * @param idx Index below QuickGame_Handle_Count()
+ * @return anyopaque* Resource or NULL if out of range
+ */
+anyopaque* QuickGame_Handle_At(u8 type, usize idx);
+
+/**
+ * @brief Frees the tables, every handle becomes stale. Resources are not destroyed.
+ *
+ */
+void QuickGame_Handle_Terminate();
+
+/**
+ * @brief Typed lookups, NULL if the handle is stale or of another type
+ *
+ * @param handle Handle
+ */
+QGTexture_t QuickGame_Handle_Get_Texture(QGHandle handle);
+QGVMesh_t QuickGame_Handle_Get_Mesh(QGHandle handle);
+QGSprite_t QuickGame_Handle_Get_Sprite(QGHandle handle);
+QGAudioClip_t QuickGame_Handle_Get_Clip(QGHandle handle);
+
+#if __cplusplus
+};
+#endif
+
+#endif
@@ -19,6 +19,15 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Pad state of one frame of a replay
+ * 
+ */
+typedef struct {
+    u32 buttons; // PSP CTRL buttons held
+    u8 lx, ly; // Analog stick, 128 is centered
+} QGInputFrame;
+
 /**
  * @brief Initialize the input system -- does not need termination
  * 
@@ -72,6 +81,23 @@ f32 QuickGame_Analog_X();
  */
 f32 QuickGame_Analog_Y();
 
+/**
+ * @brief Replays recorded pad states instead of reading the pad, one frame per QuickGame_Input_Update()
+ * 
+ * @param frames Pad states -- must outlive the replay, NULL to stop replaying
+ * @param count Number of frames
+ * @param loop Start over after the last frame, otherwise the pad is read again
+ */
+void QuickGame_Input_Replay(const QGInputFrame* frames, usize count, bool loop);
+
+/**
+ * @brief Is a replay running?
+ * 
+ * @return true Input comes from a replay
+ * @return false Input comes from the pad
+ */
+bool QuickGame_Input_Replaying();
+
 #if __cplusplus
 };
 #endif
@@ -0,0 +1,95 @@
+/**
+ * @file Jobs.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Worker pool running jobs while the main thread waits on the GPU or vsync
+ * @version 1.0
+ * @date 2022-10-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef _JOBS_INCLUDED_H_
+#define _JOBS_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_MAX_JOB_WORKERS 4
+#define QG_JOB_QUEUE_SIZE 256
+
+/**
+ * PSP has one core -- a worker runs below the main thread's priority, so it only gets the CPU
+ * while the main thread blocks (GE sync, vsync, file reads).
+ */
+#ifdef __PSP__
+#define QG_DEFAULT_JOB_WORKERS 1
+#else
+#define QG_DEFAULT_JOB_WORKERS 2
+#endif
+
+typedef void (*QGJobFunc)(anyopaque* data);
+
+typedef struct {
+    QGJobFunc func;
+    anyopaque* data;
+    QGJobCounter* counter;
+    QGJobCounter* dependency;
+} QGJob;
+
+/**
+ * @brief Starts the worker pool
+ *
+ * @param workers Number of worker threads, 0 for QG_DEFAULT_JOB_WORKERS
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Jobs_Init(usize workers);
+
+/**
+ * @brief Runs the remaining jobs and stops the worker pool
+ *
+ */
+void QuickGame_Jobs_Terminate();
+
+/**
+ * @brief Queues a job. Without a running pool the job runs immediately.
+ *
+ * @param func Function to run
+ * @param data User data passed to func
+ * @param counter Counter incremented now and decremented when the job finishes -- may be NULL
+ * @param dependency Job only starts once this counter is zero -- may be NULL
+ * @return i32 < 0 if the queue is full (or, without a pool, the dependency is not done)
+ */
+i32 QuickGame_Jobs_Submit(QGJobFunc func, anyopaque* data, QGJobCounter* counter, QGJobCounter* dependency);
+
+/**
+ * @brief Runs one ready job on the calling thread
+ *
+ * @return true A job was run
+ * @return false No job was ready
+ */
+bool QuickGame_Jobs_Help();
+
+/**
+ * @brief Waits until a counter reaches zero, running ready jobs on the calling thread meanwhile
+ *
+ * @param counter Counter to wait on
+ */
+void QuickGame_Jobs_Wait(QGJobCounter* counter);
+
+/**
+ * @brief Tells whether all jobs of a counter are done without waiting
+ *
+ * @param counter Counter to check
+ * @return true Every job submitted with the counter finished
+ */
+bool QuickGame_Jobs_Done(const QGJobCounter* counter);
+
+#if __cplusplus
+};
+#endif
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * @file LayeredMap.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Multi-layer tilemaps with parallax
+ * @version 1.0
+ * @date 2022-10-23
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef _LAYERED_MAP_INCLUDED_H_
+#define _LAYERED_MAP_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_MAX_MAP_LAYERS 8
+
+typedef struct {
+    QGTilemap_t tilemap;
+    QGVector2 parallax;
+    bool visible;
+    f32* row_bounds;
+} QGMapLayer;
+
+typedef struct {
+    QGAtlas_t atlas;
+    QGVector2 size;
+    QGMapLayer layers[QG_MAX_MAP_LAYERS];
+    usize layer_count;
+} QGLayeredMap;
+
+typedef QGLayeredMap *QGLayeredMap_t;
+
+/**
+ * @brief Creates a layered map, every layer is a tilemap of the same size sharing one atlas
+ *
+ * @param atlas Atlas shared by the layers -- not owned by the map
+ * @param size Size of each layer in tiles
+ * @param layer_count Number of layers, drawn from 0 (back) to layer_count - 1 (front)
+ * @return QGLayeredMap_t Layered map or NULL on failure
+ */
+QGLayeredMap_t QuickGame_Layered_Map_Create(QGAtlas_t atlas, QGVector2 size, usize layer_count);
+
+/**
+ * @brief Gets the tilemap of a layer to edit its tiles
+ *
+ * @param map Layered map
+ * @param layer Layer index
+ * @return QGTilemap_t Tilemap or NULL if out of range
+ */
+QGTilemap_t QuickGame_Layered_Map_Get_Layer(QGLayeredMap_t map, usize layer);
+
+/**
+ * @brief Sets how fast a layer scrolls with the camera
+ *
+ * @param map Layered map
+ * @param layer Layer index
+ * @param parallax 1 moves with the world, 0 stays fixed on screen, 0.5 scrolls at half speed
+ */
+void QuickGame_Layered_Map_Set_Parallax(QGLayeredMap_t map, usize layer, QGVector2 parallax);
+
+/**
+ * @brief Shows or hides a layer
+ *
+ * @param map Layered map
+ * @param layer Layer index
+ * @param visible Whether the layer is drawn
+ */
+void QuickGame_Layered_Map_Set_Visible(QGLayeredMap_t map, usize layer, bool visible);
+
+/**
+ * @brief Sets a tile of a layer without rebuilding it
+ *
+ * @param map Layered map
+ * @param layer Layer index
+ * @param x Column of the tile
+ * @param y Row of the tile
+ * @param tile New tile
+ */
+void QuickGame_Layered_Map_Set_Tile(QGLayeredMap_t map, usize layer, usize x, usize y, QGTile tile);
+
+/**
+ * @brief Builds every layer and its culling bounds
+ *
+ * @param map Layered map
+ */
+void QuickGame_Layered_Map_Build(QGLayeredMap_t map);
+
+/**
+ * @brief Draws the visible rows of every visible layer, binding the texture once per run of layers sharing it
+ * Layer tilemaps are positioned and scaled by their transform, rotation is ignored.
+ *
+ * @param map Layered map
+ */
+void QuickGame_Layered_Map_Draw(QGLayeredMap_t map);
+
+/**
+ * @brief Destroys a layered map
+ *
+ * @param map Layered map to destroy -- also gets set to null.
+ */
+void QuickGame_Layered_Map_Destroy(QGLayeredMap_t* map);
+
+#if __cplusplus
+};
+#endif
+
+#endif
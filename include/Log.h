@@ -0,0 +1,142 @@
+/**
+ * @file Log.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Leveled, categorized logging with a background writer and an on-screen console
+ * @version 1.0
+ * @date 2022-11-02
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * A message is formatted straight into a slot of a fixed ring buffer, so logging costs one
+ * vsnprintf and never blocks or allocates. A low priority thread drains the ring to a file and
+ * to the console lines, it only gets the CPU while the game waits on the GE or vsync. When the
+ * ring is full new messages are dropped and counted.
+ */
+
+#ifndef _LOG_INCLUDED_H_
+#define _LOG_INCLUDED_H_
+
+#include <Types.h>
+#include <stdarg.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_LOG_RING_SIZE 256 // Power of two
+#define QG_LOG_MESSAGE_MAX 120 // Including the terminator, longer messages are cut
+#define QG_LOG_CONSOLE_LINES_MAX 34 // 8 pixel lines on a 272 pixel screen
+#define QG_LOG_CONSOLE_COLUMNS 60 // 8 pixel glyphs on a 480 pixel screen
+
+typedef enum {
+    QG_LOG_TRACE = 0,
+    QG_LOG_DEBUG = 1,
+    QG_LOG_INFO = 2,
+    QG_LOG_WARN = 3,
+    QG_LOG_ERROR = 4,
+    QG_LOG_OFF = 5 // Only for QuickGame_Log_Set_Level()
+} QGLogLevel;
+
+typedef enum {
+    QG_LOG_CORE = 0,
+    QG_LOG_GRAPHICS = 1,
+    QG_LOG_AUDIO = 2,
+    QG_LOG_INPUT = 3,
+    QG_LOG_ASSET = 4,
+    QG_LOG_NET = 5,
+    QG_LOG_SCRIPT = 6,
+    QG_LOG_GAME = 7,
+    QG_LOG_CATEGORY_COUNT
+} QGLogCategory;
+
+#define QG_LOG_ALL_CATEGORIES ((1u << QG_LOG_CATEGORY_COUNT) - 1)
+
+/**
+ * @brief Starts the writer thread. Messages logged before this wait in the ring.
+ *
+ * @param filename File the messages are appended to, NULL for stdout
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Log_Init(const char* filename);
+
+/**
+ * @brief Writes the remaining messages, stops the writer and hides the console
+ *
+ */
+void QuickGame_Log_Terminate();
+
+/**
+ * @brief Sets the lowest level that is recorded, QG_LOG_INFO by default
+ *
+ * @param level Level, QG_LOG_OFF records nothing
+ */
+void QuickGame_Log_Set_Level(u8 level);
+
+/**
+ * @brief Sets which categories are recorded, all of them by default
+ *
+ * @param mask Bit (1 << category) per recorded category
+ */
+void QuickGame_Log_Set_Categories(u32 mask);
+
+/**
+ * @brief Checks whether a message would be recorded, to skip building expensive arguments
+ *
+ * @param level Level
+ * @param category Category
+ * @return true The message would be recorded
+ */
+bool QuickGame_Log_Enabled(u8 level, u8 category);
+
+/**
+ * @brief Records a message. Safe from any thread, never blocks.
+ *
+ * @param level Level
+ * @param category Category
+ * @param format printf format
+ */
+void QuickGame_Log(u8 level, u8 category, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+/**
+ * @brief Records a message from a va_list
+ *
+ * @param level Level
+ * @param category Category
+ * @param format printf format
+ * @param args Arguments
+ */
+void QuickGame_Log_V(u8 level, u8 category, const char* format, va_list args);
+
+/**
+ * @brief Waits until the writer has written every message recorded so far
+ *
+ */
+void QuickGame_Log_Flush();
+
+/**
+ * @brief Gets how many messages were dropped because the ring was full
+ *
+ * @return u32 Dropped messages
+ */
+u32 QuickGame_Log_Dropped();
+
+/**
+ * @brief Shows the latest messages as a console drawn by QuickGame_Log_Draw_Console()
+ *
+ * @param font Font with a 16x16 grid of ASCII glyphs -- not owned by the console, NULL hides it
+ * @param lines Number of lines shown, at most QG_LOG_CONSOLE_LINES_MAX
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Log_Set_Console(QGTexture_t font, usize lines);
+
+/**
+ * @brief Draws the console over the frame in a single draw call, does nothing when it is hidden
+ *
+ */
+void QuickGame_Log_Draw_Console();
+
+#if __cplusplus
+};
+#endif
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * @file Manifest.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Asset manifests loaded in the background with progress reporting
+ * @version 1.0
+ * @date 2022-10-29
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * Manifests (.qgm) are text files with one asset per line, words separated by spaces, # starts a comment:
+ *  - texture <name> <path> [flip] [vram] [mask]
+ *  - sound <name> <path> [loop] [stream]
+ *  - map <name> <path> <texture name> <atlas columns> <atlas rows> <chunk budget in bytes>
+ *  - script <name> <path>
+ *
+ * Files are read one at a time in disc order (UMD sector, then path) to avoid seeks, each read
+ * followed by its decode on the job workers. Assets become available as each finishes, a map as
+ * soon as its texture is ready.
+ */
+
+#ifndef _MANIFEST_INCLUDED_H_
+#define _MANIFEST_INCLUDED_H_
+
+#include <Types.h>
+#include <World.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_ASSET_NAME_MAX 32
+#define QG_ASSET_PATH_MAX 128
+
+/**
+ * Reads queued ahead of the finished assets, bounds the memory held by file contents
+ */
+#define QG_MANIFEST_IN_FLIGHT 4
+
+typedef enum {
+    QG_ASSET_TEXTURE = 0,
+    QG_ASSET_SOUND = 1,
+    QG_ASSET_MAP = 2,
+    QG_ASSET_SCRIPT = 3
+} QGAssetType;
+
+typedef enum {
+    QG_ASSET_PENDING = 0,
+    QG_ASSET_LOADING = 1,
+    QG_ASSET_DECODED = 2,
+    QG_ASSET_READY = 3,
+    QG_ASSET_FAILED = 4
+} QGAssetState;
+
+typedef enum {
+    QG_ASSET_FLIP = 1,
+    QG_ASSET_VRAM = 2,
+    QG_ASSET_MASK = 4,
+    QG_ASSET_LOOP = 8,
+    QG_ASSET_STREAM = 16
+} QGAssetOption;
+
+/**
+ * @brief An asset of a manifest. Loaded resources belong to the manifest unless taken.
+ */
+typedef struct {
+    u8 type;
+    u8 options;
+    volatile u32 state;
+    char name[QG_ASSET_NAME_MAX];
+    char path[QG_ASSET_PATH_MAX];
+    char dependency[QG_ASSET_NAME_MAX]; // Texture of a map
+    QGAtlasInfo atlas;
+    usize budget;
+    u32 sector; // Start of the file on disc, 0 when unknown
+
+    u8* data; // File contents, kept for scripts
+    usize size;
+    union {
+        QGTexture_t texture;
+        QGAudioClip_t clip;
+        QGWorld_t world;
+    };
+    QGAtlas_t map_atlas;
+
+    QGJobCounter read;
+    QGJobCounter decode;
+} QGAsset;
+
+/**
+ * @brief Called on the main thread each time an asset is ready or failed
+ *
+ * @param asset Asset that finished
+ * @param done Number of finished assets, including failed ones
+ * @param total Number of assets in the manifest
+ * @param user User data given to Start
+ */
+typedef void (*QGManifestCallback)(const QGAsset* asset, usize done, usize total, anyopaque* user);
+
+typedef struct {
+    QGAsset* assets;
+    usize count;
+    usize* order; // Assets that need a read, in read order
+    usize reads;
+    usize submitted;
+    usize done;
+    usize failed;
+    bool started;
+    QGManifestCallback callback;
+    anyopaque* user;
+} QGManifest;
+
+typedef QGManifest *QGManifest_t;
+
+/**
+ * @brief Parses a manifest file, nothing is loaded yet
+ *
+ * @param filename Manifest file
+ * @return QGManifest_t Manifest or NULL on failure (unreadable file, unknown asset type, bad line)
+ */
+QGManifest_t QuickGame_Manifest_Load(const char* filename);
+
+/**
+ * @brief Orders the reads and starts loading in the background
+ *
+ * @param manifest Manifest
+ * @param callback Progress callback -- may be NULL
+ * @param user User data passed to callback
+ * @return i32 < 0 if the manifest was already started
+ */
+i32 QuickGame_Manifest_Start(QGManifest_t manifest, QGManifestCallback callback, anyopaque* user);
+
+/**
+ * @brief Finishes decoded assets, queues more reads and reports progress. Call once per frame
+ * while drawing the loading screen, the workers decode while the main thread waits on vsync.
+ *
+ * @param manifest Manifest
+ */
+void QuickGame_Manifest_Update(QGManifest_t manifest);
+
+/**
+ * @brief Loads everything before returning, updating on the calling thread
+ *
+ * @param manifest Manifest, started if needed
+ */
+void QuickGame_Manifest_Wait(QGManifest_t manifest);
+
+/**
+ * @brief Gets the fraction of finished assets
+ *
+ * @param manifest Manifest
+ * @return f32 Progress in [0, 1]
+ */
+f32 QuickGame_Manifest_Progress(QGManifest_t manifest);
+
+/**
+ * @brief Tells whether every asset is ready or failed
+ *
+ * @param manifest Manifest
+ * @return true Loading is over
+ */
+bool QuickGame_Manifest_Done(QGManifest_t manifest);
+
+/**
+ * @brief Finds an asset by name
+ *
+ * @param manifest Manifest
+ * @param name Asset name
+ * @return QGAsset* Asset or NULL if there is none with that name
+ */
+QGAsset* QuickGame_Manifest_Find(QGManifest_t manifest, const char* name);
+
+/**
+ * @brief Typed lookups, NULL until the asset is ready and after it was taken
+ *
+ * @param manifest Manifest
+ * @param name Asset name
+ */
+QGTexture_t QuickGame_Manifest_Get_Texture(QGManifest_t manifest, const char* name);
+QGAudioClip_t QuickGame_Manifest_Get_Clip(QGManifest_t manifest, const char* name);
+QGWorld_t QuickGame_Manifest_Get_World(QGManifest_t manifest, const char* name);
+
+/**
+ * @brief Gets the contents of a script
+ *
+ * @param manifest Manifest
+ * @param name Asset name
+ * @param size Size of the contents in bytes
+ * @return const u8* Contents or NULL until the script is ready
+ */
+const u8* QuickGame_Manifest_Get_Data(QGManifest_t manifest, const char* name, usize* size);
+
+/**
+ * @brief Takes a ready texture or sound out of the manifest, the caller destroys it.
+ * Take textures once the maps using them are ready, maps fail without their texture.
+ *
+ * @param manifest Manifest
+ * @param name Asset name
+ * @return anyopaque* QGTexture_t or QGAudioClip_t, NULL if not ready or already taken
+ */
+anyopaque* QuickGame_Manifest_Take(QGManifest_t manifest, const char* name);
+
+/**
+ * @brief Waits for running jobs and destroys a manifest with the assets it still owns
+ *
+ * @param manifest Manifest to destroy -- also gets set to null.
+ */
+void QuickGame_Manifest_Destroy(QGManifest_t* manifest);
+
+#if __cplusplus
+};
+#endif
+
+#endif
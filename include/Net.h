@@ -0,0 +1,293 @@
+/**
+ * @file Net.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief UDP netcode with fixed tick snapshots, delta compressed against the last acked snapshot
+ * @version 1.0
+ * @date 2022-10-30
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * Both ends register the same state blocks in the same order. Each tick the registered blocks are
+ * copied into a snapshot and sent to every peer, XORed with the last snapshot that peer acked and
+ * run-length encoded, so unchanged state costs a couple of bytes. Every packet acks the newest
+ * snapshot received, there is no resending: a lost snapshot is replaced by the next one.
+ * Received snapshots go to an interpolation buffer played back a few ticks in the past.
+ */
+
+#ifndef _NET_INCLUDED_H_
+#define _NET_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_NET_MAX_PEERS 4
+#define QG_NET_MAX_BLOCKS 16
+#define QG_NET_SNAPSHOT_MAX 512
+
+/**
+ * Snapshots kept per peer, both sent (delta baselines) and received (baselines and interpolation).
+ * A power of two, at 20 ticks per second this covers 1.6 seconds of lost acks.
+ */
+#define QG_NET_HISTORY 32
+
+/**
+ * Largest datagram sent, under the Ethernet MTU so nothing gets fragmented
+ */
+#define QG_NET_PACKET_MAX 1200
+
+#define QG_NET_DEFAULT_TIMEOUT_MS 5000
+#define QG_NET_DEFAULT_INTERP_TICKS 2
+
+typedef enum {
+    QG_NET_BLOCK_RAW = 0, // Copied from the nearest snapshot
+    QG_NET_BLOCK_F32 = 1  // Array of f32, interpolated between snapshots
+} QGNetBlockType;
+
+typedef enum {
+    QG_NET_PEER_FREE = 0,
+    QG_NET_PEER_CONNECTING = 1, // Added with Connect, nothing received yet
+    QG_NET_PEER_CONNECTED = 2
+} QGNetPeerState;
+
+/**
+ * @brief IPv4 address and port, both in host byte order
+ */
+typedef struct {
+    u32 ip;
+    u16 port;
+} QGNetAddress;
+
+typedef struct {
+    anyopaque* data;
+    u16 offset;
+    u16 size;
+    u8 type;
+} QGNetBlock;
+
+typedef struct {
+    u32 tick; // 0 when the slot is empty
+    u32 arrival; // Milliseconds, received snapshots only
+    u8 data[QG_NET_SNAPSHOT_MAX];
+} QGNetSnapshot;
+
+typedef struct {
+    f32 rtt; // Smoothed round trip time in milliseconds
+    f32 rtt_variance;
+    f32 bytes_in_per_second;
+    f32 bytes_out_per_second;
+    u64 bytes_in;
+    u64 bytes_out;
+    u32 packets_in;
+    u32 packets_out;
+    u32 packets_lost; // Ticks skipped in the received sequence
+    u32 packets_dropped; // Malformed, stale or missing their baseline
+    u32 full_snapshots; // Sent without a baseline
+} QGNetStats;
+
+typedef struct {
+    u8 state;
+    QGNetAddress address;
+    u32 acked; // Newest of our ticks the peer received, baseline of the next delta, 0 for none
+    u32 received; // Newest tick received from the peer
+    u32 last_heard; // Milliseconds
+    u32 echo_time; // Peer's send time of the newest packet, echoed back for RTT
+    u32 echo_arrival;
+    u32 window_start;
+    u32 window_in;
+    u32 window_out;
+    QGNetStats stats;
+    QGNetSnapshot history[QG_NET_HISTORY];
+} QGNetPeer;
+
+typedef struct {
+    i32 socket;
+    u16 port;
+    bool accept;
+    u32 tick;
+    u32 tick_rate;
+    u32 tick_ms;
+    u32 next_tick; // Milliseconds
+    u32 timeout_ms;
+    u32 interp_ticks;
+    u32 start;
+    QGNetBlock blocks[QG_NET_MAX_BLOCKS];
+    usize block_count;
+    usize snapshot_size;
+    QGNetSnapshot history[QG_NET_HISTORY];
+    QGNetPeer peers[QG_NET_MAX_PEERS];
+} QGNet;
+
+typedef QGNet *QGNet_t;
+
+/**
+ * @brief Brings up networking. On PSP loads the network modules and connects to the access point
+ * of a network configuration, blocking until an address is obtained. Does nothing on other hosts.
+ *
+ * @param config Network configuration index from the system settings, starting at 1
+ * @param timeout_ms Time to wait for the access point
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Net_Init(i32 config, u32 timeout_ms);
+
+/**
+ * @brief Disconnects from the access point and unloads the network modules
+ *
+ */
+void QuickGame_Net_Terminate();
+
+/**
+ * @brief Parses a dotted IPv4 address
+ *
+ * @param ip Address such as "192.168.1.20"
+ * @param port Port
+ * @param address Parsed address
+ * @return i32 < 0 if ip is not a dotted IPv4 address
+ */
+i32 QuickGame_Net_Address(const char* ip, u16 port, QGNetAddress* address);
+
+/**
+ * @brief Opens a non-blocking UDP endpoint
+ *
+ * @param port Port to bind, 0 for any
+ * @param tick_rate Snapshots sent per second
+ * @return QGNet_t Endpoint or NULL on failure
+ */
+QGNet_t QuickGame_Net_Create(u16 port, u32 tick_rate);
+
+/**
+ * @brief Registers game state sent every tick. Register the same blocks in the same order on every end.
+ *
+ * @param net Endpoint
+ * @param data State, read on every tick and written by QuickGame_Net_Read()
+ * @param size Size in bytes
+ * @param type QGNetBlockType, QG_NET_BLOCK_F32 sizes must be a multiple of 4
+ * @return i32 Block index or < 0 if there are QG_NET_MAX_BLOCKS blocks or the snapshot gets over QG_NET_SNAPSHOT_MAX
+ */
+i32 QuickGame_Net_Register(QGNet_t net, anyopaque* data, usize size, u8 type);
+
+/**
+ * @brief Lets unknown senders become peers, for the hosting end
+ *
+ * @param net Endpoint
+ * @param accept Accept new peers
+ */
+void QuickGame_Net_Accept(QGNet_t net, bool accept);
+
+/**
+ * @brief Adds a peer, snapshots are sent to it from the next tick
+ *
+ * @param net Endpoint
+ * @param address Peer address
+ * @return i32 Peer index or < 0 if there are QG_NET_MAX_PEERS peers
+ */
+i32 QuickGame_Net_Connect(QGNet_t net, const QGNetAddress* address);
+
+/**
+ * @brief Removes a peer
+ *
+ * @param net Endpoint
+ * @param peer Peer index
+ */
+void QuickGame_Net_Disconnect(QGNet_t net, i32 peer);
+
+/**
+ * @brief Receives pending packets, then sends a snapshot if a tick elapsed. Peers that
+ * were not heard from for the timeout are removed. Call once per frame.
+ *
+ * @param net Endpoint
+ * @return i32 1 if a snapshot was sent. Ticks missed during a long frame are skipped, not sent one by one.
+ */
+i32 QuickGame_Net_Update(QGNet_t net);
+
+/**
+ * @brief Takes a snapshot and sends it to every peer now, outside of the tick schedule
+ *
+ * @param net Endpoint
+ */
+void QuickGame_Net_Send(QGNet_t net);
+
+/**
+ * @brief Reads a block of a peer's state, interpolated at interp_ticks behind the newest snapshot.
+ * F32 blocks are blended between the two snapshots around that time, raw blocks come from the older one.
+ *
+ * @param net Endpoint
+ * @param peer Peer index
+ * @param block Block index
+ * @param out Destination, the size of the block -- may be the registered data
+ * @return i32 < 0 if nothing was received from the peer yet
+ */
+i32 QuickGame_Net_Read(QGNet_t net, i32 peer, i32 block, anyopaque* out);
+
+/**
+ * @brief Sets how far behind the newest snapshot reads play back. More ticks hide more jitter and loss.
+ *
+ * @param net Endpoint
+ * @param ticks Ticks of delay
+ */
+void QuickGame_Net_Set_Interpolation(QGNet_t net, u32 ticks);
+
+/**
+ * @brief Sets the time after which a silent peer is removed
+ *
+ * @param net Endpoint
+ * @param timeout_ms Milliseconds
+ */
+void QuickGame_Net_Set_Timeout(QGNet_t net, u32 timeout_ms);
+
+/**
+ * @brief Gets a peer
+ *
+ * @param net Endpoint
+ * @param peer Peer index
+ * @return QGNetPeer* Peer or NULL if the slot is free
+ */
+QGNetPeer* QuickGame_Net_Peer(QGNet_t net, i32 peer);
+
+/**
+ * @brief Gets the round trip time, bandwidth and loss of a peer
+ *
+ * @param net Endpoint
+ * @param peer Peer index
+ * @return const QGNetStats* Stats or NULL if the slot is free
+ */
+const QGNetStats* QuickGame_Net_Stats(QGNet_t net, i32 peer);
+
+/**
+ * @brief Closes the endpoint
+ *
+ * @param net Endpoint to destroy -- also gets set to null.
+ */
+void QuickGame_Net_Destroy(QGNet_t* net);
+
+/**
+ * @brief Encodes current as its XOR with base, zero runs and literal runs prefixed by a length byte
+ *
+ * @param base Baseline, NULL for all zero
+ * @param current State to encode
+ * @param size Size of both in bytes
+ * @param out Encoded bytes
+ * @param capacity Size of out, size + size / 128 + 1 always fits
+ * @return i32 Encoded size or < 0 if out is too small
+ */
+i32 QuickGame_Net_Delta_Encode(const u8* base, const u8* current, usize size, u8* out, usize capacity);
+
+/**
+ * @brief Decodes a delta produced by QuickGame_Net_Delta_Encode()
+ *
+ * @param base Baseline, NULL for all zero
+ * @param in Encoded bytes
+ * @param length Encoded size
+ * @param out Decoded state, may not alias base
+ * @param size Size of base and out
+ * @return i32 < 0 if the delta is malformed or does not decode to size bytes
+ */
+i32 QuickGame_Net_Delta_Decode(const u8* base, const u8* in, usize length, u8* out, usize size);
+
+#if __cplusplus
+};
+#endif
+
+#endif
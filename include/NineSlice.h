@@ -0,0 +1,99 @@
+/**
+ * @file NineSlice.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Scalable panels with fixed size borders drawn as one mesh
+ * @version 1.0
+ * @date 2022-10-27
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef _NINE_SLICE_INCLUDED_H_
+#define _NINE_SLICE_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Border sizes in texels, drawn at one pixel per texel. Bottom is on the (u0, v0) side of the region.
+ */
+typedef struct {
+    f32 left, bottom, right, top;
+} QGInsets;
+
+/**
+ * @brief Texture region split in a 3x3 grid -- corners keep their size, edges stretch along
+ * one axis and the center along both. Drawn as 16 vertices and 54 indices.
+ * transform.scale is the size in pixels, the mesh is rebuilt only when it changes.
+ */
+typedef struct {
+    QGTransform2D transform;
+    i32 layer;
+    QGColor color;
+    QGTexture_t texture;
+    QGVMesh_t mesh;
+    f32 uv[QG_ATLAS_UV_STRIDE];
+    QGInsets insets;
+    QGVector2 built_size;
+} QGNineSlice;
+
+typedef QGNineSlice *QGNineSlice_t;
+
+/**
+ * @brief Creates a nine-slice from a region of a texture
+ *
+ * @param position Center of the panel
+ * @param size Size of the panel in pixels
+ * @param texture Texture to use
+ * @param x Left of the region in pixels
+ * @param y Top of the region in pixels
+ * @param w Width of the region in pixels
+ * @param h Height of the region in pixels
+ * @param insets Border sizes in texels
+ * @return QGNineSlice_t Nine-slice or NULL on failure
+ */
+QGNineSlice_t QuickGame_Nine_Slice_Create(QGVector2 position, QGVector2 size, QGTexture_t texture, f32 x, f32 y, f32 w, f32 h, QGInsets insets);
+
+/**
+ * @brief Creates a nine-slice from a tile of an atlas
+ *
+ * @param position Center of the panel
+ * @param size Size of the panel in pixels
+ * @param atlas Atlas to take the tile from, its texture is used
+ * @param idx Index of the tile in the atlas
+ * @param insets Border sizes in texels
+ * @return QGNineSlice_t Nine-slice or NULL on failure
+ */
+QGNineSlice_t QuickGame_Nine_Slice_Create_Atlas(QGVector2 position, QGVector2 size, QGAtlas_t atlas, usize idx, QGInsets insets);
+
+/**
+ * @brief Rebuilds the vertex positions if the size changed since the last build.
+ * Borders shrink evenly when the panel is smaller than them.
+ *
+ * @param slice Nine-slice
+ */
+void QuickGame_Nine_Slice_Update(QGNineSlice_t slice);
+
+/**
+ * @brief Draws a nine-slice, updating it first. Off screen panels are culled.
+ *
+ * @param slice Nine-slice to draw
+ */
+void QuickGame_Nine_Slice_Draw(QGNineSlice_t slice);
+
+/**
+ * @brief Destroys a nine-slice
+ *
+ * @param slice Nine-slice to destroy -- also gets set to null.
+ */
+void QuickGame_Nine_Slice_Destroy(QGNineSlice_t* slice);
+
+#if __cplusplus
+};
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file Path.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Grid pathfinding over tilemap collision data
+ * @version 1.0
+ * @date 2022-10-24
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef _PATH_INCLUDED_H_
+#define _PATH_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_PATH_NO_DIRECTION 0xFF
+
+/**
+ * @brief Pathfinder over the tiles of a tilemap, a tile is blocked when collide is set.
+ * Tile (x, y) is tile_array[x + y * size.x]. Diagonal moves never cut blocked corners.
+ * All scratch memory is allocated once at creation.
+ */
+typedef struct {
+    QGTilemap_t tilemap;
+    u32 width, height;
+    u8* walkable;
+
+    u32* heap;
+    u32* heap_index;
+    u32 heap_count;
+    f32* g;
+    f32* f;
+    u32* parent;
+    u16* stamp;
+    u16* closed;
+    u16 generation;
+
+    f32* flow_cost;
+    u8* flow;
+    i32 flow_goal_x, flow_goal_y;
+    bool flow_valid;
+} QGPathfinder;
+
+typedef QGPathfinder *QGPathfinder_t;
+
+/**
+ * @brief Creates a pathfinder for a tilemap and reads its collision data
+ *
+ * @param tilemap Tilemap to navigate -- must outlive the pathfinder
+ * @return QGPathfinder_t Pathfinder or NULL on failure
+ */
+QGPathfinder_t QuickGame_Path_Create(QGTilemap_t tilemap);
+
+/**
+ * @brief Re-reads the collision data of a single tile, invalidating cached results only if it changed
+ *
+ * @param pathfinder Pathfinder
+ * @param x Column of the tile
+ * @param y Row of the tile
+ */
+void QuickGame_Path_Update_Tile(QGPathfinder_t pathfinder, usize x, usize y);
+
+/**
+ * @brief Re-reads the collision data of every tile
+ *
+ * @param pathfinder Pathfinder
+ */
+void QuickGame_Path_Refresh(QGPathfinder_t pathfinder);
+
+/**
+ * @brief Finds a path with A* and jump point search
+ *
+ * @param pathfinder Pathfinder
+ * @param start Start tile
+ * @param goal Goal tile
+ * @param out Waypoints from the first jump point to the goal, consecutive waypoints are joined by straight or diagonal lines
+ * @param max Maximum number of waypoints to write
+ * @return i32 Number of waypoints in the full path (may exceed max), 0 if start is the goal, < 0 if there is no path
+ */
+i32 QuickGame_Path_Find(QGPathfinder_t pathfinder, QGVector2 start, QGVector2 goal, QGVector2* out, usize max);
+
+/**
+ * @brief Builds a flow field towards a goal for many agents, does nothing if the cached field is still valid
+ *
+ * @param pathfinder Pathfinder
+ * @param goal Goal tile
+ * @return i32 < 0 on failure, 0 on success
+ */
+i32 QuickGame_Path_Flow_Build(QGPathfinder_t pathfinder, QGVector2 goal);
+
+/**
+ * @brief Gets the step to take from a tile to follow the flow field
+ *
+ * @param pathfinder Pathfinder
+ * @param tile Tile the agent is on
+ * @return QGVector2 Step in tiles (each component -1, 0 or 1), zero at the goal or when unreachable
+ */
+QGVector2 QuickGame_Path_Flow_Direction(QGPathfinder_t pathfinder, QGVector2 tile);
+
+/**
+ * @brief Destroys a pathfinder
+ *
+ * @param pathfinder Pathfinder to destroy -- also gets set to null.
+ */
+void QuickGame_Path_Destroy(QGPathfinder_t* pathfinder);
+
+#if __cplusplus
+};
+#endif
+
+#endif
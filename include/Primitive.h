@@ -21,7 +21,13 @@ extern "C" {
 #endif
 
 /**
- * @brief Initialize Primitive Drawings
+ * Half width of the triangle mesh in units of the scale, its base is wider than the unit square
+ */
+#define QG_TRIANGLE_HALF_WIDTH 0.70f
+
+/**
+ * @brief Initialize Primitive Drawings, does nothing if they are already initialized.
+ * Drawing or queueing the first primitive calls it.
  * 
  * returns int < 0 on failure.
  */
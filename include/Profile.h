@@ -0,0 +1,100 @@
+/**
+ * @file Profile.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Frame time and per-subsystem profiling for performance runs
+ * @version 1.0
+ * @date 2022-10-31
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * A run records a fixed number of frames. Every frame stores its total time and the time spent
+ * inside each section, so the report gives percentiles of both. Input and presentation are timed by
+ * the engine, games add their own sections. Nothing is recorded outside of a run.
+ */
+
+#ifndef _PROFILE_INCLUDED_H_
+#define _PROFILE_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_PROFILE_SECTIONS_MAX 16
+
+/**
+ * @brief Sections timed by the engine, registered by QuickGame_Profile_Start()
+ */
+typedef enum {
+    QG_PROFILE_INPUT = 0, // QuickGame_Input_Update()
+    QG_PROFILE_PRESENT = 1 // QuickGame_Graphics_End_Frame(), GPU sync, vsync and swap
+} QGProfileBuiltin;
+
+/**
+ * @brief Starts a run, the first frame starts now. A previous run is discarded.
+ *
+ * @param scenario Name written to the report -- must outlive the run, a string literal
+ * @param frames Number of frames to record
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Profile_Start(const char* scenario, usize frames);
+
+/**
+ * @brief Ends the run and frees the recorded frames
+ *
+ */
+void QuickGame_Profile_Stop();
+
+/**
+ * @brief Registers a section, or finds it if the name is already registered
+ *
+ * @param name Section name -- must outlive the run, a string literal
+ * @return i32 Section index or < 0 if there is no run or QG_PROFILE_SECTIONS_MAX sections
+ */
+i32 QuickGame_Profile_Section(const char* name);
+
+/**
+ * @brief Starts timing a section. A section can be entered several times per frame, the times add up.
+ *
+ * @param section Section index
+ */
+void QuickGame_Profile_Begin(i32 section);
+
+/**
+ * @brief Stops timing a section
+ *
+ * @param section Section index
+ */
+void QuickGame_Profile_End(i32 section);
+
+/**
+ * @brief Ends the current frame and starts the next one. Call once per frame, after presenting.
+ *
+ * @return true The run recorded all of its frames
+ * @return false The run needs more frames, or there is no run
+ */
+bool QuickGame_Profile_Frame();
+
+/**
+ * @brief Gets a percentile of the recorded frames
+ *
+ * @param section Section index, -1 for the whole frame
+ * @param percentile Percentile in [0, 100]
+ * @return f32 Milliseconds, 0 if nothing was recorded
+ */
+f32 QuickGame_Profile_Percentile(i32 section, f32 percentile);
+
+/**
+ * @brief Writes the frame and section percentiles of the run as JSON
+ *
+ * @param filename File to write, NULL for stdout
+ * @return i32 < 0 if the report could not be written
+ */
+i32 QuickGame_Profile_Report(const char* filename);
+
+#if __cplusplus
+};
+#endif
+
+#endif
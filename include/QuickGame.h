@@ -12,27 +12,49 @@
 #ifndef _QUICKGAME_INCLUDED_H_
 #define _QUICKGAME_INCLUDED_H_
 
+#include <Atlas.h>
 #include <Audio.h>
+#include <Boot.h>
 #include <GraphicsContext.h>
+#include <Handle.h>
 #include <Input.h>
+#include <Jobs.h>
+#include <LayeredMap.h>
+#include <Log.h>
+#include <Manifest.h>
+#include <Net.h>
+#include <NineSlice.h>
+#include <Path.h>
 #include <Primitive.h>
+#include <Profile.h>
+#include <RenderQueue.h>
 #include <Sprite.h>
 #include <Texture.h>
 #include <Tilemap.h>
 #include <Timer.h>
 #include <Types.h>
+#include <World.h>
 
 #if __cplusplus
 extern "C" {
 #endif
 
 /**
- * @brief Initializes the game engine
+ * @brief Initializes the game engine. Graphics come up first and a splash frame is presented
+ * before input and workers, audio and primitives initialize on first use. Each phase is timed, see Boot.h.
  * @return < 0 on failure, 0 on success
  * 
  */
 i32 QuickGame_Init();
 
+/**
+ * @brief Initializes the game engine with a display configuration
+ * @param config Framebuffer format, buffer count and vsync mode
+ * @return < 0 on failure, 0 on success
+ * 
+ */
+i32 QuickGame_Init_Alt(const QGDisplayConfig* config);
+
 /**
  * @brief 
  * 
@@ -9,6 +9,8 @@
  * 
  */
 #include <QuickGame.h>
+#include <functional>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 #include <string.h>
@@ -23,6 +25,17 @@ inline auto init() -> void {
         throw std::runtime_error("Failed to initialize!");
 }
 
+/**
+ * @brief Initializes the game engine with a display configuration
+ * 
+ * @param config Framebuffer format, buffer count and vsync mode
+ * @throw Throws a runtime error exception on failure
+ */
+inline auto init(const QGDisplayConfig& config) -> void {
+    if(QuickGame_Init_Alt(&config) < 0)
+        throw std::runtime_error("Failed to initialize!");
+}
+
 /**
  * @brief Tells whether the game is running
  * 
@@ -47,6 +60,64 @@ inline auto request_exit() noexcept -> void {
     QuickGame_Request_Exit();
 } 
 
+namespace Boot {
+/**
+ * @brief Starts the boot clock, does nothing if it is already running
+ * 
+ */
+inline auto start() noexcept -> void {
+    QuickGame_Boot_Start();
+}
+
+/**
+ * @brief Gets the time since the boot clock started
+ * 
+ * @return u64 Microseconds
+ */
+inline auto time() noexcept -> u64 {
+    return QuickGame_Boot_Time();
+}
+
+/**
+ * @brief Records a phase that ran from start until now
+ * 
+ * @param name Name of the phase -- a string literal
+ * @param start Start of the phase from time()
+ */
+inline auto phase(const char* name, u64 start) noexcept -> void {
+    QuickGame_Boot_Phase(name, start);
+}
+
+/**
+ * @brief Gets the recorded phases in the order they finished
+ * 
+ * @return std::vector<QGBootPhase> Phases
+ */
+inline auto phases() -> std::vector<QGBootPhase> {
+    usize count = 0;
+    const QGBootPhase* p = QuickGame_Boot_Phases(&count);
+    return std::vector<QGBootPhase>(p, p + count);
+}
+
+/**
+ * @brief Gets the time to the first presented frame
+ * 
+ * @return u64 Microseconds or 0 if no frame was presented during boot
+ */
+inline auto first_frame() noexcept -> u64 {
+    return QuickGame_Boot_First_Frame();
+}
+
+/**
+ * @brief Sets the function drawing the splash frame, must be called before init()
+ * 
+ * @param splash Splash callback or nullptr to present a cleared frame
+ */
+inline auto set_splash(QGSplashCallback splash) noexcept -> void {
+    QuickGame_Boot_Set_Splash(splash);
+}
+}
+
 /**
  * MEMORY ALLOCATION
  * TO OVERRIDE THESE FUNCTIONS
@@ -83,6 +154,8 @@ inline auto destroy(anyopaque* src) -> void {
     return QuickGame_Destroy(src);
 }
 
+class Manifest;
+
 namespace Graphics{
 /**
  * @brief Initializes the graphics context
@@ -119,6 +192,24 @@ inline auto set_wireframe_mode(const bool&& mode) noexcept -> void {
     QuickGame_Graphics_Set_Wireframe_Mode(mode);
 }
 
+/**
+ * @brief Sets overdraw mode, drawing a heatmap of how many times each pixel is written
+ * 
+ * @param mode Draw in overdraw mode?
+ */
+inline auto set_overdraw_mode(const bool&& mode) noexcept -> void {
+    QuickGame_Graphics_Set_Overdraw_Mode(mode);
+}
+
+/**
+ * @brief Sets whether draws estimate the pixels they cover
+ * 
+ * @param mode Estimate coverage?
+ */
+inline auto set_coverage_estimate(const bool&& mode) noexcept -> void {
+    QuickGame_Graphics_Set_Coverage_Estimate(mode);
+}
+
 /**
  * @brief Starts a new frame
  * 
@@ -178,39 +269,120 @@ inline auto unset_camera() {
     QuickGame_Graphics_Unset_Camera();
 }
 
+/**
+ * @brief Gets the culling counters of the previous frame
+ * 
+ */
+inline auto cull_stats() noexcept -> QGCullStats {
+    return QuickGame_Graphics_Get_Cull_Stats();
+}
+
+/**
+ * @brief Gets the coverage estimate of the previous frame
+ * 
+ */
+inline auto coverage_stats() noexcept -> QGCoverageStats {
+    return QuickGame_Graphics_Get_Coverage_Stats();
+}
+
+/**
+ * @brief Tests a transform against the camera's view
+ * 
+ * @param transform Position, Rotation, Size
+ */
+inline auto visible(QGTransform2D transform) noexcept -> bool {
+    return QuickGame_Graphics_Visible(transform);
+}
+
+/**
+ * @brief Tests a transform against the camera's view, for meshes that do not span the unit square
+ * 
+ * @param transform Position, Rotation, Size
+ * @param extent Half extents of the mesh in units of the scale
+ */
+inline auto visible(QGTransform2D transform, QGVector2 extent) noexcept -> bool {
+    return QuickGame_Graphics_Visible_Extent(transform, extent);
+}
+
+/**
+ * @brief Compile time description of a vertex layout, specialized for each QuickGame vertex type
+ */
+template<typename VertexT>
+struct VertexTraits;
+
+template<>
+struct VertexTraits<QGTexturedVertex> {
+    static constexpr u8 type = QG_VERTEX_TYPE_TEXTURED;
+    static constexpr u32 format = QG_VFMT_TEXTURE_32BITF | QG_VFMT_VERTEX_32BITF | QG_VFMT_INDEX_16BIT;
+};
+
+template<>
+struct VertexTraits<QGColoredVertex> {
+    static constexpr u8 type = QG_VERTEX_TYPE_COLORED;
+    static constexpr u32 format = QG_VFMT_COLOR_8888 | QG_VFMT_VERTEX_32BITF | QG_VFMT_INDEX_16BIT;
+};
+
+template<>
+struct VertexTraits<QGFullVertex> {
+    static constexpr u8 type = QG_VERTEX_TYPE_FULL;
+    static constexpr u32 format = QG_VFMT_TEXTURE_32BITF | QG_VFMT_COLOR_8888 | QG_VFMT_VERTEX_32BITF | QG_VFMT_INDEX_16BIT;
+};
+
+template<>
+struct VertexTraits<QGSimpleVertex> {
+    static constexpr u8 type = QG_VERTEX_TYPE_SIMPLE;
+    static constexpr u32 format = QG_VFMT_VERTEX_32BITF | QG_VFMT_INDEX_16BIT;
+};
+
+template<typename VertexT>
 class Mesh {
     public:
-    Mesh() : ir(NULL) {}
+    using Traits = VertexTraits<VertexT>;
+    static constexpr usize stride = sizeof(VertexT);
+
+    Mesh() noexcept : ir(nullptr) {}
 
     /**
      * @brief Construct a new Mesh object
      * 
-     * @param type Vertex Type
      * @param vcount Vertex Count
      * @param icount Index Count
      */
-    Mesh(const u8 type, const usize vcount, const usize icount) : ir(NULL) {
-        create_mesh(type, vcount, icount);
+    Mesh(const usize vcount, const usize icount) : ir(nullptr) {
+        create_mesh(vcount, icount);
     }
 
-    virtual ~Mesh() {
+    ~Mesh() {
         delete_data();
     }
 
+    Mesh(const Mesh&) = delete;
+    Mesh& operator=(const Mesh&) = delete;
+
+    Mesh(Mesh&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    Mesh& operator=(Mesh&& other) noexcept {
+        if(this != &other) {
+            delete_data();
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
     /**
-     * @brief Create a mesh
+     * @brief Create a mesh, replacing any previous data
      * 
-     * @param type Vertex Type
      * @param vcount Vertex Count
      * @param icount Index Count
      */
-    inline auto create_mesh(const u8 type, const usize vcount, const usize icount) -> void {
-        if(ir != NULL) 
-            delete_data();
-        else 
-            ir = QuickGame_Graphics_Create_Mesh(type, vcount, icount);
+    inline auto create_mesh(const usize vcount, const usize icount) -> void {
+        delete_data();
+        ir = QuickGame_Graphics_Create_Mesh(Traits::type, vcount, icount);
         
-        if(ir == NULL)
+        if(ir == nullptr)
             throw std::runtime_error("Mesh creation failed!");
     }
 
@@ -222,36 +394,28 @@ class Mesh {
      * @param indices Index data
      * @param icount Index Count
      */
-    inline auto add_data(const void* verts, size_t vcount, const u16* indices, size_t icount) -> void {
-        if(verts == nullptr || indices == nullptr)
+    inline auto add_data(const VertexT* verts, size_t vcount, const u16* indices, size_t icount) -> void {
+        if(ir == nullptr || verts == nullptr || indices == nullptr)
             throw std::runtime_error("Mesh data null!");
 
-        int size = 0;
-        switch(ir->type) {
-            case QG_VERTEX_TYPE_COLORED:
-                size = sizeof(QGColoredVertex);
-                break;
-            case QG_VERTEX_TYPE_FULL:
-                size = sizeof(QGFullVertex);
-                break;
-            case QG_VERTEX_TYPE_TEXTURED:
-                size = sizeof(QGTexturedVertex);
-                break;
-            case QG_VERTEX_TYPE_SIMPLE:
-                size = sizeof(QGSimpleVertex);
-                break;
-        }         
-
-        memcpy(ir->data, verts, vcount * size);
+        memcpy(ir->data, verts, vcount * stride);
         memcpy(ir->indices, indices, icount * sizeof(u16));
     }
 
+    /**
+     * @brief Gets the vertices to fill in place
+     * 
+     */
+    inline auto vertices() noexcept -> VertexT* {
+        return ir != nullptr ? static_cast<VertexT*>(ir->data) : nullptr;
+    }
+
     /**
      * @brief Draws the mesh
      * 
      */
     inline auto draw() noexcept -> void {
-        QuickGame_Graphics_Draw_Mesh(ir);
+        QuickGame_Graphics_Draw_Mesh_Format(ir, Traits::format);
     }
 
     /**
@@ -294,6 +458,40 @@ class Texture {
                 throw std::runtime_error("Could not load texture!");
         }
 
+        /**
+         * @brief Creates a dynamic texture written through a staging buffer
+         * 
+         * @param width Width in pixels
+         * @param height Height in pixels
+         * @param vram Whether the texture should be stored in VRAM
+         */
+        Texture(const u32 width, const u32 height, const bool vram) {
+            ir = QuickGame_Texture_Create_Dynamic(width, height, vram);
+            if(ir == nullptr)
+                throw std::runtime_error("Could not create texture!");
+        }
+
+        /**
+         * @brief Staging pixels of a dynamic texture, rows are pWidth pixels apart
+         * 
+         * @return u32* Pixels or nullptr if the texture is not dynamic
+         */
+        inline auto staging() noexcept -> u32* {
+            return QuickGame_Texture_Staging(ir);
+        }
+
+        /**
+         * @brief Copies a rectangle of the staging buffer to the texture
+         * 
+         * @param x Left of the rectangle in pixels
+         * @param y Top of the rectangle in pixels
+         * @param w Width of the rectangle in pixels
+         * @param h Height of the rectangle in pixels
+         */
+        inline auto update_rect(u32 x, u32 y, u32 w, u32 h) noexcept -> void {
+            QuickGame_Texture_Update_Rect(ir, x, y, w, h);
+        }
+
         /**
          * @brief Texture to bind to the graphics engine
          * 
@@ -311,16 +509,100 @@ class Texture {
             QuickGame_Texture_Unbind();
         }
 
-        virtual ~Texture() {
+        /**
+         * @brief How the texture uses its alpha channel
+         * 
+         * @return u8 QG_ALPHA_OPAQUE, QG_ALPHA_CUTOUT or QG_ALPHA_BLEND
+         */
+        inline auto alpha_mode() const noexcept -> u8 {
+            return ir->alpha_mode;
+        }
+
+        ~Texture() {
             QuickGame_Texture_Destroy(&ir);
         }
 
+        Texture(const Texture&) = delete;
+        Texture& operator=(const Texture&) = delete;
+
+        Texture(Texture&& other) noexcept : ir(other.ir) {
+            other.ir = nullptr;
+        }
+
+        Texture& operator=(Texture&& other) noexcept {
+            if(this != &other) {
+                QuickGame_Texture_Destroy(&ir);
+                ir = other.ir;
+                other.ir = nullptr;
+            }
+            return *this;
+        }
+
         friend class Sprite;
+        friend class Atlas;
+        friend class NineSlice;
+        friend class QuickGame::Manifest;
 
     protected:
+    explicit Texture(QGTexture_t texture) noexcept : ir(texture) {}
+
     QGTexture_t ir;
 };
 
+class Atlas {
+    public:
+
+    /**
+     * @brief Creates an atlas and precomputes the texture coordinates of every tile
+     * 
+     * @param texture Texture the atlas refers to -- must outlive the atlas
+     * @param info Layout of the atlas (columns, rows, margin and padding in pixels)
+     */
+    Atlas(Texture& texture, const QGAtlasInfo info) {
+        ir = QuickGame_Atlas_Create(texture.ir, info);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not create atlas!");
+    }
+
+    ~Atlas() {
+        QuickGame_Atlas_Destroy(&ir);
+    }
+
+    Atlas(const Atlas&) = delete;
+    Atlas& operator=(const Atlas&) = delete;
+
+    Atlas(Atlas&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    Atlas& operator=(Atlas&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Atlas_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Gets the precomputed texture coordinates of a tile
+     * 
+     * @param idx Index of the tile
+     * @return const f32* (u0, v0, u1, v1)
+     */
+    inline auto uv(usize idx) const noexcept -> const f32* {
+        return QuickGame_Atlas_UV(ir, idx);
+    }
+
+    friend class Tilemap;
+    friend class LayeredMap;
+    friend class World;
+    friend class NineSlice;
+
+    protected:
+    QGAtlas_t ir;
+};
+
 class Tilemap {
     public:
 
@@ -335,10 +617,38 @@ class Tilemap {
     Tilemap(QGTextureAtlas texture_atlas, QGTexture_t texture, QGVector2 size) {
         ir = QuickGame_Tilemap_Create(texture_atlas, texture, size);
     }
+
+    /**
+     * @brief Create a tilemap from a shared atlas
+     * 
+     * @param atlas Atlas to use -- must outlive the tilemap
+     * @param size Size of tile map
+     */
+    Tilemap(Atlas& atlas, QGVector2 size) {
+        ir = QuickGame_Tilemap_Create_Alt(atlas.ir, size);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not create tilemap!");
+    }
     ~Tilemap() {
         QuickGame_Tilemap_Destroy(&ir);
     }
 
+    Tilemap(const Tilemap&) = delete;
+    Tilemap& operator=(const Tilemap&) = delete;
+
+    Tilemap(Tilemap&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    Tilemap& operator=(Tilemap&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Tilemap_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
     inline auto intersects(QGTransform2D transform) noexcept -> bool {
         return QuickGame_Tilemap_Intersects(ir, transform);
     }
@@ -350,97 +660,539 @@ class Tilemap {
     inline auto build() noexcept -> void {
         QuickGame_Tilemap_Build(ir);
     }
+
+    /**
+     * @brief Builds into a back mesh swapped in at a later frame start
+     * 
+     * @param tiles_per_frame 0 to build on a worker, otherwise tiles built per frame
+     */
+    inline auto build_async(usize tiles_per_frame = 0) -> void {
+        if(QuickGame_Tilemap_Build_Async(ir, tiles_per_frame) < 0)
+            throw std::runtime_error("Could not start tilemap build!");
+    }
+
+    inline auto build_pending() noexcept -> bool {
+        return QuickGame_Tilemap_Build_Pending(ir);
+    }
+
+    /**
+     * @brief Sets a single tile without rebuilding the whole map
+     * 
+     * @param x Column of the tile
+     * @param y Row of the tile
+     * @param tile New tile
+     */
+    inline auto set_tile(usize x, usize y, QGTile tile) noexcept -> void {
+        QuickGame_Tilemap_Set_Tile(ir, x, y, tile);
+    }
+
+    /**
+     * @brief Adds a tile animation -- tiles using base_idx cycle through the frames
+     * 
+     * @param base_idx Atlas index that marks animated tiles
+     * @param frames Atlas indices to display
+     * @param frame_duration Time per frame in seconds
+     */
+    inline auto add_animation(usize base_idx, const std::vector<usize>& frames, f32 frame_duration) -> void {
+        if(QuickGame_Tilemap_Add_Animation(ir, base_idx, frames.data(), frames.size(), frame_duration) < 0)
+            throw std::runtime_error("Could not add tile animation!");
+    }
+
+    /**
+     * @brief Advances tile animations
+     * 
+     * @param dt Time since the last update in seconds
+     */
+    inline auto animate(f32 dt) noexcept -> void {
+        QuickGame_Tilemap_Animate(ir, dt);
+    }
     inline auto draw() noexcept -> void {
         QuickGame_Tilemap_Draw(ir);
     }
 
+    friend class Pathfinder;
+    friend class RenderQueue;
+
     protected:
     QGTilemap_t ir;
 };
 
-class Sprite {
+class LayeredMap {
     public:
-    QGTransform2D transform;
-    i32 layer;
-    QGColor color;
 
     /**
-     * @brief Creates a sprite
+     * @brief Creates a layered map sharing one atlas
      * 
-     * @param position Position for sprite
-     * @param size Size of sprite
-     * @param texture Texture to use
-     * @return Sprite Sprite result or NULL if failed
+     * @param atlas Atlas shared by the layers -- must outlive the map
+     * @param size Size of each layer in tiles
+     * @param layer_count Number of layers, drawn back to front
      */
-    Sprite(const QGVector2 position, const QGVector2 size, Texture* texture) {
-        transform = {position, 0, size};
-        layer = 0;
-        color.color = 0xFFFFFFFF;
+    LayeredMap(Atlas& atlas, QGVector2 size, usize layer_count) {
+        ir = QuickGame_Layered_Map_Create(atlas.ir, size, layer_count);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not create layered map!");
+    }
 
-        ir = QuickGame_Sprite_Create(position, size, texture->ir);
+    ~LayeredMap() {
+        QuickGame_Layered_Map_Destroy(&ir);
+    }
 
-        if(ir == NULL)
-            throw std::runtime_error("Could not make sprite!");
+    LayeredMap(const LayeredMap&) = delete;
+    LayeredMap& operator=(const LayeredMap&) = delete;
+
+    LayeredMap(LayeredMap&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
     }
 
-    /**
-     * @brief Creates a sprite and loads a texture. This texture is owned by the sprite and destroyed on sprite destroy.
-     * 
-     * @param position Position for sprite
-     * @param size Size of sprite
-     * @param tex_info Information about the texture to load
-     * @return QGSprite_t Sprite result or NULL if failed
-     */
-    Sprite(const QGVector2&& position, const QGVector2&& size, const QGTexInfo tex_info) {
-        transform = {position, 0, size};
-        layer = 0;
-        color.color = 0xFFFFFFFF;
+    LayeredMap& operator=(LayeredMap&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Layered_Map_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
 
-        ir = QuickGame_Sprite_Create_Contained(position.x, position.y, size.x, size.y, tex_info);
+    inline auto layer(usize idx) noexcept -> QGTilemap_t {
+        return QuickGame_Layered_Map_Get_Layer(ir, idx);
+    }
 
-        if(ir == NULL)
-            throw std::runtime_error("Could not make sprite!");
+    inline auto set_parallax(usize idx, QGVector2 parallax) noexcept -> void {
+        QuickGame_Layered_Map_Set_Parallax(ir, idx, parallax);
     }
 
-    virtual ~Sprite() {
-        QuickGame_Sprite_Destroy(&ir);
+    inline auto set_visible(usize idx, bool visible) noexcept -> void {
+        QuickGame_Layered_Map_Set_Visible(ir, idx, visible);
     }
 
-    inline auto draw() noexcept -> void{
-        if(ir == nullptr)
-            return;
+    inline auto set_tile(usize idx, usize x, usize y, QGTile tile) noexcept -> void {
+        QuickGame_Layered_Map_Set_Tile(ir, idx, x, y, tile);
+    }
 
-        ir->transform = transform;
-        ir->layer = layer;
+    inline auto build() noexcept -> void {
+        QuickGame_Layered_Map_Build(ir);
+    }
 
-        QuickGame_Sprite_Draw(ir);
+    inline auto draw() noexcept -> void {
+        QuickGame_Layered_Map_Draw(ir);
     }
 
-    inline auto draw_flipped(uint8_t flip) noexcept -> void {
-        if(ir == nullptr)
-            return;
+    protected:
+    QGLayeredMap_t ir;
+};
 
-        ir->transform = transform;
-        ir->layer = layer;
+class World {
+    public:
 
-        QuickGame_Sprite_Draw_Flipped(ir, flip);
+    /**
+     * @brief Opens a streaming world file
+     * 
+     * @param filename World file to open
+     * @param atlas Atlas used to draw the tiles -- must outlive the world
+     * @param budget Maximum number of bytes used by resident chunks
+     */
+    World(const char* filename, Atlas& atlas, usize budget) {
+        ir = QuickGame_World_Load(filename, atlas.ir, budget);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not load world!");
     }
-    
-    inline auto intersects(Sprite& other) noexcept -> bool {
-        return QuickGame_Sprite_Intersects(ir, other.ir);
+
+    ~World() {
+        QuickGame_World_Destroy(&ir);
     }
 
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
 
+    World(World&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
 
-    inline auto intersection(Sprite& other) noexcept -> int {
+    World& operator=(World&& other) noexcept {
+        if(this != &other) {
+            QuickGame_World_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Pages chunks around the camera
+     * 
+     * @param camera Camera to page around
+     */
+    inline auto update(const QGCamera2D& camera) noexcept -> void {
+        QuickGame_World_Update(ir, &camera);
+    }
+
+    inline auto draw() noexcept -> void {
+        QuickGame_World_Draw(ir);
+    }
+
+    inline auto cell(i32 x, i32 y) noexcept -> u16 {
+        return QuickGame_World_Get_Cell(ir, x, y);
+    }
+
+    protected:
+    QGWorld_t ir;
+};
+
+class Pathfinder {
+    public:
+
+    /**
+     * @brief Creates a pathfinder over a tilemap's collision data
+     * 
+     * @param tilemap Tilemap to navigate -- must outlive the pathfinder
+     */
+    Pathfinder(Tilemap& tilemap) {
+        ir = QuickGame_Path_Create(tilemap.ir);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not create pathfinder!");
+    }
+
+    ~Pathfinder() {
+        QuickGame_Path_Destroy(&ir);
+    }
+
+    Pathfinder(const Pathfinder&) = delete;
+    Pathfinder& operator=(const Pathfinder&) = delete;
+
+    Pathfinder(Pathfinder&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    Pathfinder& operator=(Pathfinder&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Path_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
+    inline auto update_tile(usize x, usize y) noexcept -> void {
+        QuickGame_Path_Update_Tile(ir, x, y);
+    }
+
+    inline auto refresh() noexcept -> void {
+        QuickGame_Path_Refresh(ir);
+    }
+
+    /**
+     * @brief Finds a path between two tiles
+     * 
+     * @param start Start tile
+     * @param goal Goal tile
+     * @param path Waypoints after the start, empty if there is no path
+     * @return Whether a path exists
+     */
+    inline auto find(QGVector2 start, QGVector2 goal, std::vector<QGVector2>& path) -> bool {
+        i32 count = QuickGame_Path_Find(ir, start, goal, path.data(), path.size());
+        if(count < 0) {
+            path.clear();
+            return false;
+        }
+
+        if((usize)count > path.size()) {
+            path.resize(count);
+            QuickGame_Path_Find(ir, start, goal, path.data(), path.size());
+        }
+        path.resize(count);
+        return true;
+    }
+
+    inline auto flow_build(QGVector2 goal) noexcept -> bool {
+        return QuickGame_Path_Flow_Build(ir, goal) == 0;
+    }
+
+    inline auto flow_direction(QGVector2 tile) noexcept -> QGVector2 {
+        return QuickGame_Path_Flow_Direction(ir, tile);
+    }
+
+    protected:
+    QGPathfinder_t ir;
+};
+
+class Sprite {
+    public:
+    QGTransform2D transform;
+    i32 layer;
+    QGColor color;
+
+    /**
+     * @brief Creates a sprite
+     * 
+     * @param position Position for sprite
+     * @param size Size of sprite
+     * @param texture Texture to use
+     * @return Sprite Sprite result or NULL if failed
+     */
+    Sprite(const QGVector2 position, const QGVector2 size, Texture* texture) {
+        transform = {position, 0, size};
+        layer = 0;
+        color.color = 0xFFFFFFFF;
+
+        ir = QuickGame_Sprite_Create(position, size, texture->ir);
+
+        if(ir == NULL)
+            throw std::runtime_error("Could not make sprite!");
+    }
+
+    /**
+     * @brief Creates a sprite and loads a texture. This texture is owned by the sprite and destroyed on sprite destroy.
+     * 
+     * @param position Position for sprite
+     * @param size Size of sprite
+     * @param tex_info Information about the texture to load
+     * @return QGSprite_t Sprite result or NULL if failed
+     */
+    Sprite(const QGVector2&& position, const QGVector2&& size, const QGTexInfo tex_info) {
+        transform = {position, 0, size};
+        layer = 0;
+        color.color = 0xFFFFFFFF;
+
+        ir = QuickGame_Sprite_Create_Contained(position.x, position.y, size.x, size.y, tex_info);
+
+        if(ir == NULL)
+            throw std::runtime_error("Could not make sprite!");
+    }
+
+    ~Sprite() {
+        QuickGame_Sprite_Destroy(&ir);
+    }
+
+    Sprite(const Sprite&) = delete;
+    Sprite& operator=(const Sprite&) = delete;
+
+    Sprite(Sprite&& other) noexcept : transform(other.transform), layer(other.layer), color(other.color), ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    Sprite& operator=(Sprite&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Sprite_Destroy(&ir);
+            transform = other.transform;
+            layer = other.layer;
+            color = other.color;
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
+    inline auto draw() noexcept -> void{
+        if(ir == nullptr)
+            return;
+
+        ir->transform = transform;
+        ir->layer = layer;
+
+        QuickGame_Sprite_Draw(ir);
+    }
+
+    inline auto draw_flipped(uint8_t flip) noexcept -> void {
+        if(ir == nullptr)
+            return;
+
+        ir->transform = transform;
+        ir->layer = layer;
+
+        QuickGame_Sprite_Draw_Flipped(ir, flip);
+    }
+    
+    inline auto intersects(Sprite& other) noexcept -> bool {
+        return QuickGame_Sprite_Intersects(ir, other.ir);
+    }
+
+    /**
+     * @brief Pixel-perfect intersection, needs textures loaded with a mask
+     * 
+     * @param other Sprite to test against
+     */
+    inline auto intersects_pixel(Sprite& other) noexcept -> bool {
+        if(ir == nullptr || other.ir == nullptr)
+            return false;
+
+        ir->transform = transform;
+        other.ir->transform = other.transform;
+        return QuickGame_Sprite_Intersects_Pixel(ir, other.ir);
+    }
+
+
+
+    inline auto intersection(Sprite& other) noexcept -> int {
         return QuickGame_Sprite_Intersect_Direction(ir, other.ir);
     }
 
+    friend class RenderQueue;
+
     private:
     QGSprite_t ir;
 };
 
 
+class NineSlice {
+    public:
+
+    /**
+     * @brief Creates a nine-slice from a region of a texture
+     * 
+     * @param position Center of the panel
+     * @param size Size of the panel in pixels
+     * @param texture Texture to use -- must outlive the nine-slice
+     * @param x Left of the region in pixels
+     * @param y Top of the region in pixels
+     * @param w Width of the region in pixels
+     * @param h Height of the region in pixels
+     * @param insets Border sizes in texels
+     */
+    NineSlice(QGVector2 position, QGVector2 size, Texture& texture, f32 x, f32 y, f32 w, f32 h, QGInsets insets) {
+        ir = QuickGame_Nine_Slice_Create(position, size, texture.ir, x, y, w, h, insets);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not create nine-slice!");
+    }
+
+    /**
+     * @brief Creates a nine-slice from a tile of an atlas
+     * 
+     * @param position Center of the panel
+     * @param size Size of the panel in pixels
+     * @param atlas Atlas to take the tile from -- its texture must outlive the nine-slice
+     * @param idx Index of the tile in the atlas
+     * @param insets Border sizes in texels
+     */
+    NineSlice(QGVector2 position, QGVector2 size, Atlas& atlas, usize idx, QGInsets insets) {
+        ir = QuickGame_Nine_Slice_Create_Atlas(position, size, atlas.ir, idx, insets);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not create nine-slice!");
+    }
+
+    ~NineSlice() {
+        QuickGame_Nine_Slice_Destroy(&ir);
+    }
+
+    NineSlice(const NineSlice&) = delete;
+    NineSlice& operator=(const NineSlice&) = delete;
+
+    NineSlice(NineSlice&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    NineSlice& operator=(NineSlice&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Nine_Slice_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Position, rotation and size in pixels -- the mesh is rebuilt when the size changes
+     * 
+     */
+    inline auto transform() noexcept -> QGTransform2D& {
+        return ir->transform;
+    }
+
+    inline auto set_color(QGColor color) noexcept -> void {
+        ir->color = color;
+    }
+
+    inline auto set_layer(i32 layer) noexcept -> void {
+        ir->layer = layer;
+    }
+
+    inline auto draw() noexcept -> void {
+        QuickGame_Nine_Slice_Draw(ir);
+    }
+
+    friend class RenderQueue;
+
+    protected:
+    QGNineSlice_t ir;
+};
+
+class RenderQueue {
+    public:
+
+    /**
+     * @brief Creates a render queue
+     * 
+     * @param capacity Maximum number of draws per frame
+     */
+    RenderQueue(usize capacity) {
+        ir = QuickGame_Render_Queue_Create(capacity);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not create render queue!");
+    }
+
+    ~RenderQueue() {
+        QuickGame_Render_Queue_Destroy(&ir);
+    }
+
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    RenderQueue(RenderQueue&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    RenderQueue& operator=(RenderQueue&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Render_Queue_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
+    inline auto submit(const QGDrawCommand& command, i32 layer, u16 depth = 0) noexcept -> bool {
+        return QuickGame_Render_Queue_Submit(ir, &command, layer, depth) == 0;
+    }
+
+    inline auto submit(Sprite& sprite, u8 flip = QG_FLIP_NONE) noexcept -> bool;
+
+    inline auto submit(NineSlice& slice) noexcept -> bool {
+        return QuickGame_Render_Queue_Submit_Nine_Slice(ir, slice.ir) == 0;
+    }
+
+    inline auto submit(Tilemap& tilemap, i32 layer) noexcept -> bool {
+        return QuickGame_Render_Queue_Submit_Tilemap(ir, tilemap.ir, layer) == 0;
+    }
+
+    inline auto submit_primitive(u8 type, QGTransform2D transform, QGColor color, i32 layer) noexcept -> bool {
+        return QuickGame_Render_Queue_Submit_Primitive(ir, type, transform, color, layer) == 0;
+    }
+
+    inline auto execute() noexcept -> void {
+        QuickGame_Render_Queue_Execute(ir);
+    }
+
+    inline auto clear() noexcept -> void {
+        QuickGame_Render_Queue_Clear(ir);
+    }
+
+    inline auto stats() const noexcept -> const QGRenderStats& {
+        return ir->stats;
+    }
+
+    protected:
+    QGRenderQueue_t ir;
+};
+
+inline auto RenderQueue::submit(Sprite& sprite, u8 flip) noexcept -> bool {
+    if(sprite.ir == nullptr)
+        return false;
+
+    sprite.ir->transform = sprite.transform;
+    sprite.ir->layer = sprite.layer;
+    sprite.ir->color = sprite.color;
+    return QuickGame_Render_Queue_Submit_Sprite(ir, sprite.ir, flip) == 0;
+}
+
 /**
  * @brief Intersection Detection
  * 
@@ -460,7 +1212,7 @@ class Timer {
     Timer() {
         QuickGame_Timer_Start(&t);
     }
-    virtual ~Timer() {
+    ~Timer() {
         reset();
     }
 
@@ -515,6 +1267,22 @@ class Clip{
     ~Clip() {
         QuickGame_Audio_Destroy(&ir);
     }
+
+    Clip(const Clip&) = delete;
+    Clip& operator=(const Clip&) = delete;
+
+    Clip(Clip&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    Clip& operator=(Clip&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Audio_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
     /**
      * @brief Sets the clip's looping mode
      * 
@@ -568,13 +1336,285 @@ class Clip{
         QuickGame_Audio_Stop(ir);
     }
 
+    friend class QuickGame::Manifest;
+
     private:
+    explicit Clip(QGAudioClip_t clip) noexcept : ir(clip) {}
+
     QGAudioClip_t ir;
 
 };
 
 }
 
+class Manifest {
+    public:
+    using Callback = std::function<void(const QGAsset& asset, usize done, usize total)>;
+
+    /**
+     * @brief Parses a manifest file, nothing is loaded yet
+     * 
+     * @param filename Manifest file
+     */
+    Manifest(const char* filename) {
+        ir = QuickGame_Manifest_Load(filename);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not load manifest!");
+    }
+
+    ~Manifest() {
+        QuickGame_Manifest_Destroy(&ir);
+    }
+
+    Manifest(const Manifest&) = delete;
+    Manifest& operator=(const Manifest&) = delete;
+
+    Manifest(Manifest&& other) noexcept : ir(other.ir), callback(std::move(other.callback)) {
+        other.ir = nullptr;
+    }
+
+    Manifest& operator=(Manifest&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Manifest_Destroy(&ir);
+            ir = other.ir;
+            callback = std::move(other.callback);
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Starts loading in the background
+     * 
+     * @param on_progress Called on the main thread as each asset is ready or failed -- may be empty
+     */
+    inline auto start(Callback on_progress = nullptr) -> void {
+        // Heap allocated so the pointer given to C survives moves
+        callback = std::make_unique<Callback>(std::move(on_progress));
+        if(QuickGame_Manifest_Start(ir, *callback ? report : nullptr, callback.get()) < 0)
+            throw std::runtime_error("Manifest was already started!");
+    }
+
+    /**
+     * @brief Finishes decoded assets and queues more reads, call once per frame
+     * 
+     * @return f32 Progress in [0, 1]
+     */
+    inline auto update() -> f32 {
+        QuickGame_Manifest_Update(ir);
+        return QuickGame_Manifest_Progress(ir);
+    }
+
+    /**
+     * @brief Loads everything before returning
+     * 
+     */
+    inline auto wait() -> void {
+        QuickGame_Manifest_Wait(ir);
+    }
+
+    inline auto progress() const noexcept -> f32 {
+        return QuickGame_Manifest_Progress(ir);
+    }
+
+    inline auto done() const noexcept -> bool {
+        return QuickGame_Manifest_Done(ir);
+    }
+
+    /**
+     * @brief Looks up a ready asset, owned by the manifest
+     * 
+     * @param name Asset name
+     * @return Resource or nullptr until ready
+     */
+    inline auto texture(const char* name) noexcept -> QGTexture_t {
+        return QuickGame_Manifest_Get_Texture(ir, name);
+    }
+
+    inline auto clip(const char* name) noexcept -> QGAudioClip_t {
+        return QuickGame_Manifest_Get_Clip(ir, name);
+    }
+
+    inline auto world(const char* name) noexcept -> QGWorld_t {
+        return QuickGame_Manifest_Get_World(ir, name);
+    }
+
+    inline auto data(const char* name, usize& size) noexcept -> const u8* {
+        return QuickGame_Manifest_Get_Data(ir, name, &size);
+    }
+
+    /**
+     * @brief Takes a ready texture out of the manifest
+     * 
+     * @param name Asset name
+     * @throw Throws a runtime error exception if it is not ready or was taken
+     */
+    inline auto take_texture(const char* name) -> Graphics::Texture {
+        if(texture(name) == nullptr)
+            throw std::runtime_error("Texture is not ready!");
+
+        return Graphics::Texture(static_cast<QGTexture_t>(QuickGame_Manifest_Take(ir, name)));
+    }
+
+    /**
+     * @brief Takes a ready sound out of the manifest
+     * 
+     * @param name Asset name
+     * @throw Throws a runtime error exception if it is not ready or was taken
+     */
+    inline auto take_clip(const char* name) -> Audio::Clip {
+        if(clip(name) == nullptr)
+            throw std::runtime_error("Clip is not ready!");
+
+        return Audio::Clip(static_cast<QGAudioClip_t>(QuickGame_Manifest_Take(ir, name)));
+    }
+
+    private:
+    static auto report(const QGAsset* asset, usize done, usize total, anyopaque* user) -> void {
+        (*static_cast<Callback*>(user))(*asset, done, total);
+    }
+
+    QGManifest_t ir;
+    std::unique_ptr<Callback> callback;
+};
+
+namespace Net {
+/**
+ * @brief Brings up networking, connecting to an access point on PSP
+ * 
+ * @param config Network configuration index, starting at 1
+ * @param timeout_ms Time to wait for the access point
+ * @throw Throws a runtime error exception on failure
+ */
+inline auto init(i32 config = 1, u32 timeout_ms = 10000) -> void {
+    if(QuickGame_Net_Init(config, timeout_ms) < 0)
+        throw std::runtime_error("Could not connect to the network!");
+}
+
+inline auto terminate() noexcept -> void {
+    QuickGame_Net_Terminate();
+}
+
+/**
+ * @brief Parses a dotted IPv4 address
+ * 
+ * @throw Throws a runtime error exception if it is not an IPv4 address
+ */
+inline auto address(const char* ip, u16 port) -> QGNetAddress {
+    QGNetAddress result;
+    if(QuickGame_Net_Address(ip, port, &result) < 0)
+        throw std::runtime_error("Invalid address!");
+    return result;
+}
+
+class Endpoint {
+    public:
+    /**
+     * @brief Opens a UDP endpoint
+     * 
+     * @param port Port to bind, 0 for any
+     * @param tick_rate Snapshots sent per second
+     */
+    Endpoint(u16 port, u32 tick_rate = 20) {
+        ir = QuickGame_Net_Create(port, tick_rate);
+        if(ir == nullptr)
+            throw std::runtime_error("Could not open endpoint!");
+    }
+
+    ~Endpoint() {
+        QuickGame_Net_Destroy(&ir);
+    }
+
+    Endpoint(const Endpoint&) = delete;
+    Endpoint& operator=(const Endpoint&) = delete;
+
+    Endpoint(Endpoint&& other) noexcept : ir(other.ir) {
+        other.ir = nullptr;
+    }
+
+    Endpoint& operator=(Endpoint&& other) noexcept {
+        if(this != &other) {
+            QuickGame_Net_Destroy(&ir);
+            ir = other.ir;
+            other.ir = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Registers state sent every tick, in the same order on every end
+     * 
+     * @param value State, floats are interpolated when every member is an f32
+     * @return i32 Block index
+     */
+    template<typename T>
+    inline auto add(T& value, QGNetBlockType type = QG_NET_BLOCK_RAW) -> i32 {
+        i32 block = QuickGame_Net_Register(ir, &value, sizeof(T), type);
+        if(block < 0)
+            throw std::runtime_error("Snapshot is full!");
+        return block;
+    }
+
+    inline auto accept(bool enable) noexcept -> void {
+        QuickGame_Net_Accept(ir, enable);
+    }
+
+    inline auto connect(const QGNetAddress& address) -> i32 {
+        i32 peer = QuickGame_Net_Connect(ir, &address);
+        if(peer < 0)
+            throw std::runtime_error("Too many peers!");
+        return peer;
+    }
+
+    inline auto disconnect(i32 peer) noexcept -> void {
+        QuickGame_Net_Disconnect(ir, peer);
+    }
+
+    /**
+     * @brief Receives, then sends a snapshot if a tick elapsed. Call once per frame.
+     * 
+     * @return bool A snapshot was sent
+     */
+    inline auto update() noexcept -> bool {
+        return QuickGame_Net_Update(ir) > 0;
+    }
+
+    /**
+     * @brief Reads a block of a peer's state, interpolated behind the newest snapshot
+     * 
+     * @return bool Something was received from the peer
+     */
+    template<typename T>
+    inline auto read(i32 peer, i32 block, T& out) noexcept -> bool {
+        return QuickGame_Net_Read(ir, peer, block, &out) >= 0;
+    }
+
+    inline auto set_interpolation(u32 ticks) noexcept -> void {
+        QuickGame_Net_Set_Interpolation(ir, ticks);
+    }
+
+    inline auto set_timeout(u32 timeout_ms) noexcept -> void {
+        QuickGame_Net_Set_Timeout(ir, timeout_ms);
+    }
+
+    inline auto connected(i32 peer) const noexcept -> bool {
+        QGNetPeer* p = QuickGame_Net_Peer(ir, peer);
+        return p != nullptr && p->state == QG_NET_PEER_CONNECTED;
+    }
+
+    inline auto stats(i32 peer) const noexcept -> const QGNetStats* {
+        return QuickGame_Net_Stats(ir, peer);
+    }
+
+    inline auto port() const noexcept -> u16 {
+        return ir->port;
+    }
+
+    private:
+    QGNet_t ir;
+};
+}
+
 namespace Primitive {
     /**
  * @brief Initialize Primitive Drawings
@@ -614,6 +1654,41 @@ void draw_triangle(QGTransform2D transform, QGColor color);
 void draw_circle(QGTransform2D transform, QGColor color);
 }
 
+namespace Jobs {
+
+/**
+ * @brief Queues a job
+ * 
+ * @param func Function to run
+ * @param data User data passed to func
+ * @param counter Counter tracking the job -- may be NULL
+ * @param dependency Counter that must reach zero before the job starts -- may be NULL
+ */
+inline auto submit(QGJobFunc func, anyopaque* data, QGJobCounter* counter = nullptr, QGJobCounter* dependency = nullptr) -> void {
+    if(QuickGame_Jobs_Submit(func, data, counter, dependency) < 0)
+        throw std::runtime_error("Could not submit job!");
+}
+
+/**
+ * @brief Runs one ready job on the calling thread
+ * 
+ * @return Whether a job was run
+ */
+inline auto help() noexcept -> bool {
+    return QuickGame_Jobs_Help();
+}
+
+/**
+ * @brief Waits for every job of a counter, helping with jobs meanwhile
+ * 
+ * @param counter Counter to wait on
+ */
+inline auto wait(QGJobCounter& counter) noexcept -> void {
+    QuickGame_Jobs_Wait(&counter);
+}
+
+}
+
 namespace Input {
 
 /**
@@ -684,6 +1759,235 @@ inline auto analog_y() noexcept -> f32 {
     return QuickGame_Analog_Y();
 }
 
+/**
+ * @brief Replays recorded pad states instead of reading the pad, one frame per update()
+ * 
+ * @param frames Pad states -- must outlive the replay, nullptr to stop replaying
+ * @param count Number of frames
+ * @param loop Start over after the last frame, otherwise the pad is read again
+ */
+inline auto replay(const QGInputFrame* frames, usize count, bool loop = false) noexcept -> void {
+    QuickGame_Input_Replay(frames, count, loop);
+}
+
+/**
+ * @brief Is a replay running?
+ * 
+ * @return true Input comes from a replay
+ * @return false Input comes from the pad
+ */
+inline auto replaying() noexcept -> bool {
+    return QuickGame_Input_Replaying();
+}
+
+}
+
+namespace Profile {
+
+/**
+ * @brief Starts a run of a fixed number of frames, a previous run is discarded
+ * 
+ * @param scenario Name written to the report -- a string literal
+ * @param frames Number of frames to record
+ */
+inline auto start(const char* scenario, usize frames) -> void {
+    if(QuickGame_Profile_Start(scenario, frames) < 0)
+        throw std::runtime_error("Could not start profiling!");
+}
+
+/**
+ * @brief Ends the run and frees the recorded frames
+ * 
+ */
+inline auto stop() noexcept -> void {
+    QuickGame_Profile_Stop();
+}
+
+/**
+ * @brief Registers a section, or finds it if the name is already registered
+ * 
+ * @param name Section name -- a string literal
+ * @return i32 Section index, < 0 if there is no run or too many sections
+ */
+inline auto section(const char* name) noexcept -> i32 {
+    return QuickGame_Profile_Section(name);
+}
+
+/**
+ * @brief Times a section for as long as it is in scope
+ * 
+ */
+class Scope {
+    i32 ir;
+
+    public:
+    Scope(i32 section) noexcept : ir(section) {
+        QuickGame_Profile_Begin(ir);
+    }
+
+    ~Scope() {
+        QuickGame_Profile_End(ir);
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+};
+
+/**
+ * @brief Ends the current frame and starts the next one
+ * 
+ * @return true The run recorded all of its frames
+ */
+inline auto frame() noexcept -> bool {
+    return QuickGame_Profile_Frame();
+}
+
+/**
+ * @brief Gets a percentile of the recorded frames
+ * 
+ * @param section Section index, -1 for the whole frame
+ * @param percentile Percentile in [0, 100]
+ * @return f32 Milliseconds
+ */
+inline auto percentile(i32 section, f32 percentile) noexcept -> f32 {
+    return QuickGame_Profile_Percentile(section, percentile);
+}
+
+/**
+ * @brief Writes the frame and section percentiles of the run as JSON
+ * 
+ * @param filename File to write, nullptr for stdout
+ */
+inline auto report(const char* filename = nullptr) -> void {
+    if(QuickGame_Profile_Report(filename) < 0)
+        throw std::runtime_error("Could not write the profile report!");
+}
+
+}
+
+namespace Log {
+
+/**
+ * @brief Starts the writer thread, messages logged before this wait in the ring
+ * 
+ * @param filename File the messages are appended to, nullptr for stdout
+ */
+inline auto init(const char* filename = nullptr) -> void {
+    if(QuickGame_Log_Init(filename) < 0)
+        throw std::runtime_error("Could not start logging!");
+}
+
+/**
+ * @brief Writes the remaining messages and stops the writer
+ * 
+ */
+inline auto terminate() noexcept -> void {
+    QuickGame_Log_Terminate();
+}
+
+/**
+ * @brief Sets the lowest level that is recorded
+ * 
+ * @param level Level, QG_LOG_OFF records nothing
+ */
+inline auto set_level(QGLogLevel level) noexcept -> void {
+    QuickGame_Log_Set_Level(level);
+}
+
+/**
+ * @brief Sets which categories are recorded
+ * 
+ * @param mask Bit (1 << category) per recorded category
+ */
+inline auto set_categories(u32 mask) noexcept -> void {
+    QuickGame_Log_Set_Categories(mask);
+}
+
+/**
+ * @brief Checks whether a message would be recorded
+ * 
+ * @param level Level
+ * @param category Category
+ * @return true The message would be recorded
+ */
+inline auto enabled(QGLogLevel level, QGLogCategory category) noexcept -> bool {
+    return QuickGame_Log_Enabled(level, category);
+}
+
+/**
+ * @brief Records a message, safe from any thread
+ * 
+ * @param level Level
+ * @param category Category
+ * @param format printf format
+ * @param args Arguments
+ */
+template<typename... Args>
+inline auto write(QGLogLevel level, QGLogCategory category, const char* format, Args... args) noexcept -> void {
+    QuickGame_Log(level, category, format, args...);
+}
+
+template<typename... Args>
+inline auto trace(QGLogCategory category, const char* format, Args... args) noexcept -> void {
+    QuickGame_Log(QG_LOG_TRACE, category, format, args...);
+}
+
+template<typename... Args>
+inline auto debug(QGLogCategory category, const char* format, Args... args) noexcept -> void {
+    QuickGame_Log(QG_LOG_DEBUG, category, format, args...);
+}
+
+template<typename... Args>
+inline auto info(QGLogCategory category, const char* format, Args... args) noexcept -> void {
+    QuickGame_Log(QG_LOG_INFO, category, format, args...);
+}
+
+template<typename... Args>
+inline auto warn(QGLogCategory category, const char* format, Args... args) noexcept -> void {
+    QuickGame_Log(QG_LOG_WARN, category, format, args...);
+}
+
+template<typename... Args>
+inline auto error(QGLogCategory category, const char* format, Args... args) noexcept -> void {
+    QuickGame_Log(QG_LOG_ERROR, category, format, args...);
+}
+
+/**
+ * @brief Waits until every message recorded so far is written
+ * 
+ */
+inline auto flush() noexcept -> void {
+    QuickGame_Log_Flush();
+}
+
+/**
+ * @brief Gets how many messages were dropped because the ring was full
+ * 
+ * @return u32 Dropped messages
+ */
+inline auto dropped() noexcept -> u32 {
+    return QuickGame_Log_Dropped();
+}
+
+/**
+ * @brief Shows the latest messages as an on-screen console
+ * 
+ * @param font Font with a 16x16 grid of ASCII glyphs -- must outlive the console, nullptr hides it
+ * @param lines Number of lines shown
+ */
+inline auto set_console(QGTexture_t font, usize lines) -> void {
+    if(QuickGame_Log_Set_Console(font, lines) < 0)
+        throw std::runtime_error("Could not create the log console!");
+}
+
+/**
+ * @brief Draws the console over the frame in a single draw call
+ * 
+ */
+inline auto draw_console() noexcept -> void {
+    QuickGame_Log_Draw_Console();
+}
+
 }
 
 } // QuickGame
@@ -0,0 +1,202 @@
+/**
+ * @file RenderQueue.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Sorted draw submission with minimal state changes
+ * @version 1.0
+ * @date 2022-10-26
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef _RENDER_QUEUE_INCLUDED_H_
+#define _RENDER_QUEUE_INCLUDED_H_
+
+#include <Types.h>
+#include <Sprite.h>
+#include <NineSlice.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Sort key layout, most significant first:
+ * layer (8 bits, biased by 128) | blend (2) | texture hash (14) | depth (16) | submission index (24)
+ * The index keeps the sort stable and identifies the command.
+ */
+#define QG_RENDER_KEY_INDEX_BITS 24
+#define QG_RENDER_KEY_DEPTH_SHIFT 24
+#define QG_RENDER_KEY_TEXTURE_SHIFT 40
+#define QG_RENDER_KEY_BLEND_SHIFT 54
+#define QG_RENDER_KEY_LAYER_SHIFT 56
+#define QG_RENDER_QUEUE_MAX (1 << QG_RENDER_KEY_INDEX_BITS)
+
+/**
+ * Blend modes in the order they are drawn within a layer
+ */
+typedef enum {
+    QG_BLEND_NONE = 0,
+    QG_BLEND_ALPHA = 1,
+    QG_BLEND_ADD = 2
+} QGBlendMode;
+
+typedef enum {
+    QG_DRAW_SPRITE = 0,
+    QG_DRAW_TILEMAP = 1,
+    QG_DRAW_RECTANGLE = 2,
+    QG_DRAW_TRIANGLE = 3,
+    QG_DRAW_CIRCLE = 4,
+    QG_DRAW_MESH = 5,
+    QG_DRAW_NINE_SLICE = 6
+} QGDrawType;
+
+/**
+ * @brief A queued draw. Transform and color are copied at submission, sprites, tilemaps,
+ * meshes and textures are referenced and must stay alive until the queue is executed.
+ * alpha_mode is filled in by Submit from the blend mode, color and texture.
+ */
+typedef struct {
+    u8 type;
+    u8 blend;
+    u8 flip;
+    u8 alpha_mode;
+    QGTransform2D transform;
+    QGColor color;
+    QGTexture_t texture;
+    union {
+        QGSprite_t sprite;
+        QGTilemap_t tilemap;
+        QGVMesh_t mesh;
+        QGNineSlice_t nine_slice;
+    };
+} QGDrawCommand;
+
+typedef struct {
+    usize draws;
+    usize opaque_draws;
+    usize texture_binds;
+    usize blend_changes;
+    usize sort_passes;
+} QGRenderStats;
+
+typedef struct {
+    QGDrawCommand* commands;
+    u64* keys;
+    u64* scratch;
+    usize count;
+    usize capacity;
+    bool sorted;
+    QGRenderStats stats;
+} QGRenderQueue;
+
+typedef QGRenderQueue *QGRenderQueue_t;
+
+/**
+ * @brief Creates a render queue
+ *
+ * @param capacity Maximum number of draws per frame (at most QG_RENDER_QUEUE_MAX)
+ * @return QGRenderQueue_t Render queue or NULL on failure
+ */
+QGRenderQueue_t QuickGame_Render_Queue_Create(usize capacity);
+
+/**
+ * @brief Builds the sort key of a draw, without the submission index
+ *
+ * @param layer Layer in [-128, 127], lower layers draw first
+ * @param blend Blend mode
+ * @param texture Texture or NULL
+ * @param depth Depth within a layer and texture, lower draws first
+ * @return u64 Sort key
+ */
+u64 QuickGame_Render_Key(i32 layer, u8 blend, QGTexture_t texture, u16 depth);
+
+/**
+ * @brief Queues a draw command
+ *
+ * @param queue Render queue
+ * @param command Draw command, copied
+ * @param layer Layer in [-128, 127], lower layers draw first
+ * @param depth Depth within a layer and texture, lower draws first
+ * @return i32 < 0 if the queue is full
+ */
+i32 QuickGame_Render_Queue_Submit(QGRenderQueue_t queue, const QGDrawCommand* command, i32 layer, u16 depth);
+
+/**
+ * @brief Queues a sprite on its own layer with alpha blending, sprites off screen are culled
+ *
+ * @param queue Render queue
+ * @param sprite Sprite to draw
+ * @param flip Flip type
+ * @return i32 < 0 if the queue is full
+ */
+i32 QuickGame_Render_Queue_Submit_Sprite(QGRenderQueue_t queue, QGSprite_t sprite, u8 flip);
+
+/**
+ * @brief Queues a nine-slice on its own layer with alpha blending, panels off screen are culled
+ *
+ * @param queue Render queue
+ * @param slice Nine-slice to draw
+ * @return i32 < 0 if the queue is full
+ */
+i32 QuickGame_Render_Queue_Submit_Nine_Slice(QGRenderQueue_t queue, QGNineSlice_t slice);
+
+/**
+ * @brief Queues a tilemap with alpha blending
+ *
+ * @param queue Render queue
+ * @param tilemap Tilemap to draw
+ * @param layer Layer in [-128, 127]
+ * @return i32 < 0 if the queue is full
+ */
+i32 QuickGame_Render_Queue_Submit_Tilemap(QGRenderQueue_t queue, QGTilemap_t tilemap, i32 layer);
+
+/**
+ * @brief Queues a primitive shape, shapes off screen are culled
+ *
+ * @param queue Render queue
+ * @param type QG_DRAW_RECTANGLE, QG_DRAW_TRIANGLE or QG_DRAW_CIRCLE
+ * @param transform Position, Rotation, Size
+ * @param color Color to draw with
+ * @param layer Layer in [-128, 127]
+ * @return i32 < 0 if the queue is full or type is not a primitive
+ */
+i32 QuickGame_Render_Queue_Submit_Primitive(QGRenderQueue_t queue, u8 type, QGTransform2D transform, QGColor color, i32 layer);
+
+/**
+ * @brief Sorts the queued draws by key with a radix sort, skipping bytes every key shares
+ *
+ * @param queue Render queue
+ */
+void QuickGame_Render_Queue_Sort(QGRenderQueue_t queue);
+
+/**
+ * @brief Draws the queue, only changing blend state and textures when they differ. Sorts first if needed.
+ * Each draw gets a depth from its place in key order. Opaque and cutout draws go first, front to back
+ * with depth writes and blending off, so hidden pixels are rejected before shading. Translucent draws
+ * follow back to front, depth tested against them. Clears the depth buffer when there are opaque draws.
+ * Must be called inside of StartFrame() EndFrame().
+ *
+ * @param queue Render queue
+ */
+void QuickGame_Render_Queue_Execute(QGRenderQueue_t queue);
+
+/**
+ * @brief Removes all queued draws and resets the stats
+ *
+ * @param queue Render queue
+ */
+void QuickGame_Render_Queue_Clear(QGRenderQueue_t queue);
+
+/**
+ * @brief Destroys a render queue
+ *
+ * @param queue Render queue to destroy -- also gets set to null.
+ */
+void QuickGame_Render_Queue_Destroy(QGRenderQueue_t* queue);
+
+#if __cplusplus
+};
+#endif
+
+#endif
@@ -26,6 +26,8 @@ typedef struct {
     QGVMesh_t mesh;
     bool contained;
     QGVector2 aabb_size;
+    QGVector2 tex_origin; // Texel at the bottom left corner
+    QGVector2 tex_extent; // Texels to the top right corner, negative when the image runs the other way
 } QGSprite;
 
 typedef QGSprite *QGSprite_t;
@@ -78,6 +80,25 @@ QGSprite_t QuickGame_Sprite_Create_Contained(float x, float y, float w, float h,
  */
 QGSprite_t QuickGame_Sprite_Create_Drakonchik(QGVector2 position, QGVector2 size, float u1, float v1, float w, float h, QGTexture_t texture);
 
+/**
+ * @brief Creates a sprite showing a single tile of an atlas
+ * 
+ * @param position Position of sprite
+ * @param size Size of sprite
+ * @param atlas Atlas to take the tile from, its texture is used by the sprite
+ * @param idx Index of the tile in the atlas
+ * @return QGSprite_t Sprite result or NULL if failed
+ */
+QGSprite_t QuickGame_Sprite_Create_Atlas(QGVector2 position, QGVector2 size, QGAtlas_t atlas, usize idx);
+
+/**
+ * @brief Changes the atlas tile shown by a sprite -- only rewrites the texture coordinates
+ * 
+ * @param sprite Sprite to change
+ * @param atlas Atlas to take the tile from
+ * @param idx Index of the tile in the atlas
+ */
+void QuickGame_Sprite_Set_Atlas_Index(QGSprite_t sprite, QGAtlas_t atlas, usize idx);
 
 /**
  * @brief Destroy a sprite and sets it to NULL
@@ -125,6 +146,18 @@ void QuickGame_Sprite_Draw_Flipped(QGSprite_t sprite, uint8_t flip);
  */
 bool QuickGame_Sprite_Intersects(QGSprite_t a, QGSprite_t b);
 
+/**
+ * @brief Pixel-perfect intersection detection using the collision masks of the sprite textures.
+ * Runs only when the bounding boxes overlap. Unrotated sprites drawn at one pixel per texel compare
+ * 32 pixels per step, other sprites are sampled. Without a mask on both sprites the bounding box test is used.
+ * 
+ * @param a Sprite A
+ * @param b Sprite B
+ * @return true Opaque pixels of the sprites overlap
+ * @return false Sprites do not intersect
+ */
+bool QuickGame_Sprite_Intersects_Pixel(QGSprite_t a, QGSprite_t b);
+
 /**
  * @brief Intersection Detection
  * 
@@ -36,6 +36,54 @@ QGTexture_t QuickGame_Texture_Load(const char* filename, const bool flip, const
  */
 QGTexture_t QuickGame_Texture_Load_Alt(const QGTexInfo tex_info);
 
+/**
+ * @brief Decodes a texture from an image file in memory. Safe to call from a job when tex_info.vram is false.
+ * 
+ * @param buffer Contents of a PNG, JPEG, BMP or TGA file
+ * @param size Size of buffer in bytes
+ * @param tex_info Texture info, filename is ignored
+ * @return QGTexture_t Texture loaded or NULL if failed
+ */
+QGTexture_t QuickGame_Texture_Load_Memory(const u8* buffer, const usize size, const QGTexInfo tex_info);
+
+/**
+ * @brief Moves the pixels of a texture loaded in RAM to VRAM. Main thread only, VRAM is never freed.
+ * 
+ * @param texture Texture loaded without vram, dynamic textures are not supported
+ * @return i32 < 0 on failure, the texture is left in RAM
+ */
+i32 QuickGame_Texture_Move_VRAM(QGTexture_t texture);
+
+/**
+ * @brief Creates a texture the CPU writes into through a linear staging buffer, cleared to transparent black
+ * 
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param vram Whether the texture should be stored in VRAM
+ * @return QGTexture_t Texture created or NULL if failed
+ */
+QGTexture_t QuickGame_Texture_Create_Dynamic(const u32 width, const u32 height, const bool vram);
+
+/**
+ * @brief Gets the staging buffer of a dynamic texture -- ABGR pixels, rows are pWidth pixels apart
+ * 
+ * @param texture Dynamic texture
+ * @return u32* Staging pixels or NULL if the texture is not dynamic
+ */
+u32* QuickGame_Texture_Staging(QGTexture_t texture);
+
+/**
+ * @brief Copies a rectangle of the staging buffer to the texture. Only the 16 byte by 8 row blocks
+ * the rectangle touches are swizzled and written back, the texture cache is flushed on the next bind.
+ * 
+ * @param texture Dynamic texture
+ * @param x Left of the rectangle in pixels
+ * @param y Top of the rectangle in pixels
+ * @param w Width of the rectangle in pixels
+ * @param h Height of the rectangle in pixels
+ */
+void QuickGame_Texture_Update_Rect(QGTexture_t texture, u32 x, u32 y, u32 w, u32 h);
+
 /**
  * @brief Destroys a texture pointer
  * 
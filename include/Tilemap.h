@@ -38,6 +38,15 @@ void QuickGame_Atlas_Index_Coords(const QGTextureAtlas atlas, f32* buf, const us
  */
 QGTilemap_t QuickGame_Tilemap_Create(QGTextureAtlas texture_atlas, QGTexture_t texture, QGVector2 size);
 
+/**
+ * @brief Create a tilemap from an atlas
+ * 
+ * @param atlas Atlas to use -- not owned by the tilemap, can be shared
+ * @param size Size of tile map
+ * @return QGTilemap_t Created tilemap or NULL on failure
+ */
+QGTilemap_t QuickGame_Tilemap_Create_Alt(QGAtlas_t atlas, QGVector2 size);
+
 /**
  * @brief Test intersection
  * 
@@ -61,6 +70,13 @@ void QuickGame_Tilemap_Draw_String(QGTilemap_t tilemap, const char* str, QGVecto
  */
 void QuickGame_Tilemap_Draw(QGTilemap_t tilemap);
 
+/**
+ * @brief Adds the on-screen area of every tile to the coverage estimate, does nothing unless it is enabled
+ * 
+ * @param tilemap Tilemap
+ */
+void QuickGame_Tilemap_Estimate_Coverage(QGTilemap_t tilemap);
+
 /**
  * @brief Builds a tilemap to render
  * 
@@ -68,6 +84,61 @@ void QuickGame_Tilemap_Draw(QGTilemap_t tilemap);
  */
 void QuickGame_Tilemap_Build(QGTilemap_t tilemap);
 
+/**
+ * @brief Builds a tilemap into a back mesh without touching the mesh being drawn.
+ * The new mesh is swapped in by the first QuickGame_Graphics_Start_Frame after the build completes.
+ * Use QuickGame_Tilemap_Set_Tile to edit tiles while a build is pending.
+ * 
+ * @param tilemap Tilemap
+ * @param tiles_per_frame 0 builds on a worker job, otherwise this many tiles are built at each frame start
+ * @return i32 < 0 on failure, 0 on success
+ */
+i32 QuickGame_Tilemap_Build_Async(QGTilemap_t tilemap, usize tiles_per_frame);
+
+/**
+ * @brief Tells whether an asynchronous build has not been swapped in yet
+ * 
+ * @param tilemap Tilemap
+ * @return true A build is pending
+ */
+bool QuickGame_Tilemap_Build_Pending(QGTilemap_t tilemap);
+
+/**
+ * @brief Advances frame-spread builds and swaps in completed ones -- called by QuickGame_Graphics_Start_Frame
+ * 
+ */
+void QuickGame_Tilemap_Update_Builds();
+
+/**
+ * @brief Sets a single tile and patches only its vertices in the built mesh
+ * 
+ * @param tilemap Tilemap
+ * @param x Column of the tile
+ * @param y Row of the tile
+ * @param tile New tile
+ */
+void QuickGame_Tilemap_Set_Tile(QGTilemap_t tilemap, usize x, usize y, QGTile tile);
+
+/**
+ * @brief Adds a tile animation -- tiles using base_idx cycle through the frames
+ * 
+ * @param tilemap Tilemap
+ * @param base_idx Atlas index that marks animated tiles
+ * @param frames Atlas indices to display, copied
+ * @param frame_count Number of frames
+ * @param frame_duration Time per frame in seconds
+ * @return i32 < 0 on failure, 0 on success
+ */
+i32 QuickGame_Tilemap_Add_Animation(QGTilemap_t tilemap, usize base_idx, const usize* frames, usize frame_count, f32 frame_duration);
+
+/**
+ * @brief Advances tile animations, patching only the texture coordinates of animated tiles
+ * 
+ * @param tilemap Tilemap
+ * @param dt Time since the last update in seconds
+ */
+void QuickGame_Tilemap_Animate(QGTilemap_t tilemap, f32 dt);
+
 /**
  * @brief Destroy a tilemap
  * 
@@ -59,6 +59,16 @@ typedef union {
 
 typedef void anyopaque;
 
+/**
+ * @brief How a texture uses its alpha channel, found by scanning it at load
+ * 
+ */
+typedef enum {
+    QG_ALPHA_OPAQUE = 0,
+    QG_ALPHA_CUTOUT = 1,
+    QG_ALPHA_BLEND = 2
+} QGAlphaMode;
+
 /**
  * @brief Textures
  * 
@@ -67,6 +77,11 @@ typedef struct {
     u32 width, height;
     u32 pWidth, pHeight;
     anyopaque* data;
+    u8 alpha_mode;
+    u32* staging; // Linear pixels of dynamic textures, NULL otherwise
+    bool dirty;
+    u32* mask; // 1 bit per pixel, set where alpha >= 128, LSB first -- NULL unless requested at load
+    u32 mask_stride; // Words per mask row
 } QGTexture;
 
 typedef QGTexture *QGTexture_t;
@@ -75,6 +90,7 @@ typedef struct {
     const char* filename;
     bool flip;
     bool vram;
+    bool mask; // Build a collision mask for pixel-perfect intersection
 } QGTexInfo;
 
 /**
@@ -181,6 +197,38 @@ typedef struct {
 } QGTextureAtlas;
 
 
+/**
+ * @brief Texture Atlas layout, all sizes in pixels
+ * 
+ */
+typedef struct {
+    u32 columns, rows;
+    u32 margin;
+    u32 padding;
+} QGAtlasInfo;
+
+/**
+ * @brief Number of floats per tile in an atlas UV table
+ * 
+ */
+#define QG_ATLAS_UV_STRIDE 4
+
+/**
+ * @brief Texture Atlas with precomputed texture coordinates
+ * 
+ * Each entry of uvs holds (u0, v0, u1, v1), already scaled to the power of two texture size.
+ * (u0, v0) maps to the first corner of a quad and (u1, v1) to the opposite corner.
+ */
+typedef struct {
+    QGAtlasInfo info;
+    QGTexture_t texture;
+    f32 tile_width, tile_height;
+    usize count;
+    f32* uvs;
+} QGAtlas;
+
+typedef QGAtlas *QGAtlas_t;
+
 typedef struct {
     QGVector2 position;
     QGVector2 scale;
@@ -189,6 +237,37 @@ typedef struct {
     bool collide;
 } QGTile;
 
+/**
+ * @brief Tile animation -- every tile using base_idx cycles through frames
+ * 
+ */
+typedef struct {
+    usize base_idx;
+    usize* frames;
+    usize frame_count;
+    f32 frame_duration;
+    f32 elapsed;
+    usize current;
+
+    usize* cells;
+    usize cell_count;
+    usize cell_capacity;
+} QGTileAnimation;
+
+/**
+ * @brief Number of unfinished jobs submitted with this counter, zero when all of them are done.
+ * Zero initialize before first use.
+ */
+typedef struct {
+    i32 value;
+} QGJobCounter;
+
+typedef enum {
+    QG_TILEMAP_BUILD_IDLE = 0,
+    QG_TILEMAP_BUILD_RUNNING = 1,
+    QG_TILEMAP_BUILD_READY = 2
+} QGTilemapBuildState;
+
 typedef struct {
     QGTransform2D transform;
     QGTextureAtlas atlas;
@@ -196,6 +275,20 @@ typedef struct {
     QGVector2 size;
     QGTile* tile_array;
     QGVMesh_t mesh;
+    QGAtlas_t layout;
+    bool contained;
+    QGTileAnimation* animations;
+    usize animation_count;
+    u16* animation_lookup;
+
+    QGVMesh_t back_mesh;
+    u32 build_state;
+    usize build_cursor;
+    usize build_step;
+    QGJobCounter build_counter;
+
+    usize translucent_tiles; // Tiles with alpha below 0xFF in the mesh, read by the render queue
+    usize back_translucent_tiles; // Same for the back mesh, swapped in with it
 } QGTilemap;
 
 typedef QGTilemap *QGTilemap_t;
@@ -0,0 +1,123 @@
+/**
+ * @file World.h
+ * @author Nathan Bourgeois (iridescentrosesfall@gmail.com)
+ * @brief Streaming chunked world maps
+ * @version 1.0
+ * @date 2022-10-22
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * World files (.qgw) are little endian and laid out as:
+ *  - QGWorldHeader
+ *  - Chunk table: chunk_columns * chunk_rows entries of (u32 offset, u32 size), row-major
+ *  - Chunk data: chunk_size * chunk_size u16 cells per chunk, row-major, rows stored bottom to top
+ *
+ * A cell is QG_WORLD_CELL_EMPTY or an atlas index in the low 15 bits with QG_WORLD_CELL_COLLIDE set for solid tiles.
+ * A chunk with size 0 is entirely empty and is never read from disk.
+ * tools/tiled2qgw.py converts Tiled JSON maps to this format.
+ */
+
+#ifndef _WORLD_INCLUDED_H_
+#define _WORLD_INCLUDED_H_
+
+#include <Types.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+#define QG_WORLD_MAGIC 0x4D574751 /* "QGWM" */
+#define QG_WORLD_VERSION 1
+
+#define QG_WORLD_CELL_EMPTY 0xFFFF
+#define QG_WORLD_CELL_COLLIDE 0x8000
+#define QG_WORLD_CELL_INDEX 0x7FFF
+
+typedef struct __attribute__ ((__packed__)) {
+    u32 magic;
+    u16 version;
+    u16 chunk_size;
+    u32 width, height;
+    u16 tile_width, tile_height;
+    u32 chunk_columns, chunk_rows;
+    u32 reserved;
+} QGWorldHeader;
+
+typedef enum {
+    QG_CHUNK_FREE = 0,
+    QG_CHUNK_LOADING = 1,
+    QG_CHUNK_LOADED = 2,
+    QG_CHUNK_RESIDENT = 3
+} QGChunkState;
+
+typedef struct {
+    i32 cx, cy;
+    volatile u32 state;
+    u16* cells;
+    QGTilemap_t tilemap;
+} QGWorldChunk;
+
+typedef struct {
+    QGWorldHeader header;
+    u32* chunk_table;
+    QGAtlas_t atlas;
+
+    QGWorldChunk* slots;
+    usize slot_count;
+    usize builds_per_update;
+
+    i32 file;
+    i32 thread;
+    i32 signal;
+    volatile bool running;
+} QGWorld;
+
+typedef QGWorld *QGWorld_t;
+
+/**
+ * @brief Opens a world file and preallocates chunk slots within a memory budget
+ *
+ * @param filename World file to open
+ * @param atlas Atlas used to draw the tiles -- not owned by the world
+ * @param budget Maximum number of bytes used by resident chunks
+ * @return QGWorld_t World or NULL on failure
+ */
+QGWorld_t QuickGame_World_Load(const char* filename, QGAtlas_t atlas, usize budget);
+
+/**
+ * @brief Requests the chunks around the camera, builds finished chunks and evicts distant ones
+ *
+ * @param world World to update
+ * @param camera Camera to page around, or NULL for the origin
+ */
+void QuickGame_World_Update(QGWorld_t world, const QGCamera2D* camera);
+
+/**
+ * @brief Draws all resident chunks
+ *
+ * @param world World to draw
+ */
+void QuickGame_World_Draw(QGWorld_t world);
+
+/**
+ * @brief Gets the cell at a tile position if its chunk is resident
+ *
+ * @param world World to query
+ * @param x Column in tiles
+ * @param y Row in tiles, from the bottom
+ * @return u16 Cell value, QG_WORLD_CELL_EMPTY when out of range or not resident
+ */
+u16 QuickGame_World_Get_Cell(QGWorld_t world, i32 x, i32 y);
+
+/**
+ * @brief Stops the loader and destroys a world
+ *
+ * @param world World to destroy -- also gets set to null.
+ */
+void QuickGame_World_Destroy(QGWorld_t* world);
+
+#if __cplusplus
+};
+#endif
+
+#endif
@@ -5,13 +5,16 @@ static int lua_qg_audio_load(lua_State* L) {
     if (argc != 3)
         return luaL_error(L, "Error: AudioClip.load() takes 3 arguments.");
 
-    QGAudioClip** audio = lua_newuserdata(L,sizeof(QGAudioClip*));
+    QGHandle* handle = lua_newuserdata(L,sizeof(QGHandle));
 
     const char* filename = luaL_checkstring(L, 1);
     bool looping  = luaL_checkinteger(L, 2);
     bool streaming = luaL_checkinteger(L, 3);
 
-    *audio = QuickGame_Audio_Load(filename, looping, streaming);
+    QGAudioClip_t clip = QuickGame_Audio_Load(filename, looping, streaming);
+    *handle = QuickGame_Handle_Create(QG_HANDLE_CLIP, clip);
+    if(*handle == QG_NULL_HANDLE)
+        QuickGame_Audio_Destroy(&clip);
 
     luaL_getmetatable(L, "AudioClip");
     lua_setmetatable(L, -2); 
@@ -19,13 +22,19 @@ static int lua_qg_audio_load(lua_State* L) {
     return 1;
 }
 
-QGAudioClip** getClip(lua_State* L){
-    return (QGAudioClip**)luaL_checkudata(L, 1, "AudioClip");
+QGAudioClip_t getClip(lua_State* L){
+    QGHandle* handle = (QGHandle*)luaL_checkudata(L, 1, "AudioClip");
+    QGAudioClip_t clip = QuickGame_Handle_Get_Clip(*handle);
+    if(clip == NULL)
+        luaL_error(L, "Error: AudioClip was destroyed or failed to load.");
+
+    return clip;
 }
 
 static int lua_qg_audio_destroy(lua_State* L) {
-    QGAudioClip** clip = getClip(L);
-    QuickGame_Destroy(clip);
+    QGHandle* handle = (QGHandle*)luaL_checkudata(L, 1, "AudioClip");
+    QuickGame_Handle_Destroy(*handle);
+    *handle = QG_NULL_HANDLE;
 
     return 0;
 }
@@ -35,7 +44,7 @@ static int lua_qg_audio_set_volume(lua_State* L) {
     if (argc != 2)
         return luaL_error(L, "Error: AudioClip:set_volume() takes 2 arguments.");
 
-    QGAudioClip_t clip = *getClip(L);
+    QGAudioClip_t clip = getClip(L);
     f32 volume = luaL_checknumber(L, 2);
     QuickGame_Audio_Set_Volume(clip, volume);
 
@@ -48,7 +57,7 @@ static int lua_qg_audio_set_pan(lua_State* L) {
     if (argc != 2)
         return luaL_error(L, "Error: AudioClip:set_pan() takes 2 arguments.");
 
-    QGAudioClip_t clip = *getClip(L);
+    QGAudioClip_t clip = getClip(L);
     f32 pan = luaL_checknumber(L, 2);
     QuickGame_Audio_Set_Pan(clip, pan);
 
@@ -61,7 +70,7 @@ static int lua_qg_audio_set_loop(lua_State* L) {
     if (argc != 2)
         return luaL_error(L, "Error: AudioClip:set_loop() takes 2 arguments.");
 
-    QGAudioClip_t clip = *getClip(L);
+    QGAudioClip_t clip = getClip(L);
     int looping = lua_toboolean(L, 2);
     QuickGame_Audio_Set_Looping(clip, looping);
 
@@ -73,7 +82,7 @@ static int lua_qg_audio_play(lua_State* L) {
     if (argc != 2)
         return luaL_error(L, "Error: AudioClip:play() takes 2 arguments.");
 
-    QGAudioClip_t clip = *getClip(L);
+    QGAudioClip_t clip = getClip(L);
     int channel = luaL_checkinteger(L, 2);
     QuickGame_Audio_Play(clip, channel);
 
@@ -85,7 +94,7 @@ static int lua_qg_audio_pause(lua_State* L) {
     if (argc != 1)
         return luaL_error(L, "Error: AudioClip:play() takes 1 argument.");
 
-    QGAudioClip_t clip = *getClip(L);
+    QGAudioClip_t clip = getClip(L);
     QuickGame_Audio_Pause(clip);
 
     return 0;
@@ -96,7 +105,7 @@ static int lua_qg_audio_stop(lua_State* L) {
     if (argc != 1)
         return luaL_error(L, "Error: AudioClip:stop() takes 1 argument.");
 
-    QGAudioClip_t clip = *getClip(L);
+    QGAudioClip_t clip = getClip(L);
     QuickGame_Audio_Stop(clip);
 
     return 0;
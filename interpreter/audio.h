@@ -11,4 +11,12 @@
 
 void initialize_audio(lua_State* L);
 
+/**
+ * @brief Opens the AudioClip module behind its lazy global, defined in main.c
+ *
+ * @param L lua_State
+ * @return int 1, the AudioClip class
+ */
+int open_audio(lua_State* L);
+
 #endif
\ No newline at end of file
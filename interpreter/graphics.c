@@ -71,6 +71,50 @@ static int lua_qg_set_wireframe_mode(lua_State* L) {
     return 0;
 }
 
+static int lua_qg_set_overdraw_mode(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Graphics.set_overdraw_mode() takes 1 argument.");
+
+    bool b = lua_toboolean(L, 1);
+
+    QuickGame_Graphics_Set_Overdraw_Mode(b);
+
+    return 0;
+}
+
+static int lua_qg_set_coverage_estimate(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Graphics.set_coverage_estimate() takes 1 argument.");
+
+    bool b = lua_toboolean(L, 1);
+
+    QuickGame_Graphics_Set_Coverage_Estimate(b);
+
+    return 0;
+}
+
+static int lua_qg_coverage_stats(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: Graphics.coverage_stats() takes no arguments.");
+
+    QGCoverageStats stats = QuickGame_Graphics_Get_Coverage_Stats();
+
+    lua_newtable(L);
+    lua_pushnumber(L, stats.pixels[QG_COVERAGE_SPRITE]);
+    lua_setfield(L, -2, "sprite");
+    lua_pushnumber(L, stats.pixels[QG_COVERAGE_TILEMAP]);
+    lua_setfield(L, -2, "tilemap");
+    lua_pushnumber(L, stats.pixels[QG_COVERAGE_PRIMITIVE]);
+    lua_setfield(L, -2, "primitive");
+    lua_pushnumber(L, stats.overdraw);
+    lua_setfield(L, -2, "overdraw");
+
+    return 1;
+}
+
 static int lua_qg_set2D(lua_State* L) {
     int argc = lua_gettop(L);
     if (argc != 0)
@@ -108,6 +152,9 @@ static const luaL_Reg graphicsLib[] = {
 	{"end_frame", lua_qg_end_frame},
 	{"set_dialog_mode", lua_qg_set_dialog_mode},
 	{"set_wireframe_mode", lua_qg_set_wireframe_mode},
+	{"set_overdraw_mode", lua_qg_set_overdraw_mode},
+	{"set_coverage_estimate", lua_qg_set_coverage_estimate},
+	{"coverage_stats", lua_qg_coverage_stats},
     {"set2D", lua_qg_set2D},
     {"set_camera", lua_qg_set_camera},
     {"unset_camera", lua_qg_unset_camera},
@@ -286,13 +333,8 @@ static const luaL_Reg primitiveLib[] = {
 };
 
 void initialize_primitive(lua_State* L) {
-    lua_getglobal(L, "Primitive");
-
-    if(lua_isnil(L, -1)){
-        lua_pop(L, 1);
-        lua_newtable(L);
-    }
-
+    // A fresh table, the global is still the lazy proxy that loads this module
+    lua_newtable(L);
     luaL_setfuncs(L, primitiveLib, 0);
     lua_setglobal(L, "Primitive");
 }
@@ -317,9 +359,11 @@ QGCamera2D* getQGCamera(lua_State* L){
     return (QGCamera2D*)luaL_checkudata(L, 1, "Camera");
 }
 
+// The camera lives inside the userdata, Lua frees it
 static int lua_qg_camera_destroy(lua_State* L) {
     QGCamera2D* camera = getQGCamera(L);
-    QuickGame_Destroy(&camera);
+    if(QuickGame_Graphics_Get_Camera() == camera)
+        QuickGame_Graphics_Unset_Camera();
 
     return 0;
 }
@@ -407,9 +451,9 @@ static int lua_qg_transform_create(lua_State* L) {
     return 1;
 }
 
+// The transform lives inside the userdata, Lua frees it
 static int lua_qg_transform_destroy(lua_State* L) {
-    QGTransform2D* t = getQGTransform(L);
-    QuickGame_Destroy(&t);
+    getQGTransform(L);
 
     return 0;
 }
@@ -68,6 +68,64 @@ static int lua_qg_analogy(lua_State* L) {
     return 1;
 }
 
+// The engine replays from memory it does not own, the last replay table is copied here
+static QGInputFrame* replay_frames = NULL;
+
+static int lua_qg_input_replay(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1 && argc != 2)
+        return luaL_error(L, "Error: Input.replay() takes 1 or 2 arguments.");
+
+    bool loop = argc == 2 && lua_toboolean(L, 2);
+
+    // Input.replay(nil) goes back to the pad
+    if(lua_isnil(L, 1)) {
+        QuickGame_Input_Replay(NULL, 0, false);
+        return 0;
+    }
+
+    // { {buttons, lx, ly}, ... }, the stick is centered when left out
+    luaL_checktype(L, 1, LUA_TTABLE);
+    usize count = lua_rawlen(L, 1);
+
+    QGInputFrame* frames = count > 0 ? QuickGame_Allocate(sizeof(QGInputFrame) * count) : NULL;
+    if(count > 0 && frames == NULL)
+        return luaL_error(L, "Error: Input.replay() is out of memory.");
+
+    for(usize i = 0; i < count; i++) {
+        lua_rawgeti(L, 1, i + 1);
+        if(!lua_istable(L, -1)) {
+            QuickGame_Destroy(frames);
+            return luaL_error(L, "Error: Input.replay() frame %d is not a table.", (int)(i + 1));
+        }
+
+        lua_rawgeti(L, -1, 1);
+        lua_rawgeti(L, -2, 2);
+        lua_rawgeti(L, -3, 3);
+        frames[i].buttons = lua_tointeger(L, -3);
+        frames[i].lx = lua_isnil(L, -2) ? 128 : lua_tointeger(L, -2);
+        frames[i].ly = lua_isnil(L, -1) ? 128 : lua_tointeger(L, -1);
+        lua_pop(L, 4);
+    }
+
+    QuickGame_Input_Replay(frames, count, loop);
+
+    if(replay_frames != NULL)
+        QuickGame_Destroy(replay_frames);
+    replay_frames = frames;
+
+    return 0;
+}
+
+static int lua_qg_input_replaying(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: Input.replaying() takes 0 arguments.");
+
+    lua_pushboolean(L, QuickGame_Input_Replaying());
+    return 1;
+}
+
 static const luaL_Reg inputLib[] = {
 	{"update", lua_qg_input_update},
 	{"button_pressed", lua_qg_button_pressed},
@@ -75,6 +133,8 @@ static const luaL_Reg inputLib[] = {
 	{"button_held", lua_qg_button_held},
 	{"analog_x", lua_qg_analogx},
 	{"analog_y", lua_qg_analogy},
+	{"replay", lua_qg_input_replay},
+	{"replaying", lua_qg_input_replaying},
 	{0, 0}
 };
 
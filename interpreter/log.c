@@ -0,0 +1,150 @@
+#include "log.h"
+#include "sprite.h"
+
+// Font of the console, the console holds a reference to it
+static QGHandle console_font = QG_NULL_HANDLE;
+
+/**
+ * @brief Records the arguments joined by tabs, the way print writes them
+ * 
+ * @param L lua_State
+ * @param level Level of the message
+ * @return int Number of results
+ */
+int log_arguments(lua_State* L, u8 level) {
+    if(!QuickGame_Log_Enabled(level, QG_LOG_SCRIPT))
+        return 0;
+
+    int argc = lua_gettop(L);
+    luaL_Buffer buffer;
+    luaL_buffinit(L, &buffer);
+
+    for(int n = 1; n <= argc; n++) {
+        if(n > 1)
+            luaL_addchar(&buffer, '\t');
+
+        luaL_tolstring(L, n, NULL);
+        luaL_addvalue(&buffer);
+    }
+
+    luaL_pushresult(&buffer);
+    QuickGame_Log(level, QG_LOG_SCRIPT, "%s", lua_tostring(L, -1));
+    return 0;
+}
+
+static int lua_qg_log_trace(lua_State* L) {
+    return log_arguments(L, QG_LOG_TRACE);
+}
+
+static int lua_qg_log_debug(lua_State* L) {
+    return log_arguments(L, QG_LOG_DEBUG);
+}
+
+static int lua_qg_log_info(lua_State* L) {
+    return log_arguments(L, QG_LOG_INFO);
+}
+
+static int lua_qg_log_warn(lua_State* L) {
+    return log_arguments(L, QG_LOG_WARN);
+}
+
+static int lua_qg_log_error(lua_State* L) {
+    return log_arguments(L, QG_LOG_ERROR);
+}
+
+static int lua_qg_log_set_level(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Log.set_level() takes 1 argument.");
+
+    QuickGame_Log_Set_Level(luaL_checkinteger(L, 1));
+    return 0;
+}
+
+static int lua_qg_log_flush(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: Log.flush() takes 0 arguments.");
+
+    QuickGame_Log_Flush();
+    return 0;
+}
+
+static int lua_qg_log_dropped(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: Log.dropped() takes 0 arguments.");
+
+    lua_pushinteger(L, QuickGame_Log_Dropped());
+    return 1;
+}
+
+static int lua_qg_log_console(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1 && argc != 2)
+        return luaL_error(L, "Error: Log.console() takes 1 or 2 arguments.");
+
+    // The console draws with the texture, so hold a reference to it for as long as it is shown
+    QGTexture_t font = lua_isnil(L, 1) ? NULL : getTexn(L, 1);
+    usize lines = argc == 2 ? luaL_checkinteger(L, 2) : 8;
+
+    QGHandle handle = font ? *(QGHandle*)lua_touserdata(L, 1) : QG_NULL_HANDLE;
+    if(font && QuickGame_Handle_Retain(handle) < 0)
+        return luaL_error(L, "Error: Texture is used by too many objects.");
+
+    // The previous console is gone either way
+    i32 result = QuickGame_Log_Set_Console(font, lines);
+    QuickGame_Handle_Destroy(console_font);
+    console_font = handle;
+    if(result < 0) {
+        QuickGame_Handle_Destroy(handle);
+        console_font = QG_NULL_HANDLE;
+    }
+
+    lua_pushboolean(L, result >= 0);
+    return 1;
+}
+
+static int lua_qg_log_draw(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: Log.draw() takes 0 arguments.");
+
+    QuickGame_Log_Draw_Console();
+    return 0;
+}
+
+static const luaL_Reg logLib[] = {
+	{"trace", lua_qg_log_trace},
+	{"debug", lua_qg_log_debug},
+	{"info", lua_qg_log_info},
+	{"warn", lua_qg_log_warn},
+	{"error", lua_qg_log_error},
+	{"set_level", lua_qg_log_set_level},
+	{"flush", lua_qg_log_flush},
+	{"dropped", lua_qg_log_dropped},
+	{"console", lua_qg_log_console},
+	{"draw", lua_qg_log_draw},
+	{0, 0}
+};
+
+void initialize_log(lua_State* L) {
+    // A fresh table, the global is still the lazy proxy that loads this module
+    lua_newtable(L);
+    luaL_setfuncs(L, logLib, 0);
+
+    lua_pushinteger(L, QG_LOG_TRACE);
+    lua_setfield(L, -2, "TRACE");
+    lua_pushinteger(L, QG_LOG_DEBUG);
+    lua_setfield(L, -2, "DEBUG");
+    lua_pushinteger(L, QG_LOG_INFO);
+    lua_setfield(L, -2, "INFO");
+    lua_pushinteger(L, QG_LOG_WARN);
+    lua_setfield(L, -2, "WARN");
+    lua_pushinteger(L, QG_LOG_ERROR);
+    lua_setfield(L, -2, "ERROR");
+    lua_pushinteger(L, QG_LOG_OFF);
+    lua_setfield(L, -2, "OFF");
+
+    lua_setglobal(L, "Log");
+}
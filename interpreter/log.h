@@ -0,0 +1,16 @@
+#include <QuickGame.h>
+#include <lua.h>
+#include <lualib.h>
+#include <lauxlib.h>
+#include <luaconf.h>
+#include <pspdebug.h>
+#include <pspctrl.h>
+
+#ifndef LOG_INCLUDED_H
+#define LOG_INCLUDED_H
+
+void initialize_log(lua_State* L);
+
+int log_arguments(lua_State* L, u8 level);
+
+#endif
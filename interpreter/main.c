@@ -13,7 +13,11 @@
 #include "input.h"
 #include "audio.h"
 #include "sprite.h"
+#include "manifest.h"
+#include "profile.h"
+#include "log.h"
 #include <stdlib.h>
+#include <stdio.h>
 
 #define RAM_BLOCK 1024
 u32 ramAvailableMax(void)
@@ -56,14 +60,9 @@ static int lua_memfree(lua_State* L) {
     return 1;
 }
 
+// Goes through the log instead of redrawing the debug screen, see Log.console() to show it
 static int lua_print(lua_State* L) {
-    pspDebugScreenInit();
-    pspDebugScreenSetXY(0, 0);
-
-    int argc = lua_gettop(L);
-    int n;
-    for (n = 1; n <= argc; n++) pspDebugScreenPrintf("%s\n", lua_tostring(L, n));
-    return 0;
+    return log_arguments(L, QG_LOG_INFO);
 }
 
 lua_State *L;
@@ -86,9 +85,44 @@ static int lua_qg_request_exit(lua_State* L) {
     return 0;
 }
 
+static int lua_qg_boot_phases(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: QuickGame.boot_phases() takes 0 arguments.");
+
+    usize count = 0;
+    const QGBootPhase* phases = QuickGame_Boot_Phases(&count);
+
+    // { {name = "graphics", start = seconds, duration = seconds}, ... }
+    lua_createtable(L, count, 0);
+    for(usize i = 0; i < count; i++) {
+        lua_createtable(L, 0, 3);
+        lua_pushstring(L, phases[i].name);
+        lua_setfield(L, -2, "name");
+        lua_pushnumber(L, (lua_Number)phases[i].start / 1000000.0);
+        lua_setfield(L, -2, "start");
+        lua_pushnumber(L, (lua_Number)phases[i].duration / 1000000.0);
+        lua_setfield(L, -2, "duration");
+        lua_rawseti(L, -2, i + 1);
+    }
+
+    return 1;
+}
+
+static int lua_qg_first_frame(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: QuickGame.first_frame() takes 0 arguments.");
+
+    lua_pushnumber(L, (lua_Number)QuickGame_Boot_First_Frame() / 1000000.0);
+    return 1;
+}
+
 static const luaL_Reg quickgameLib[] = {
 	{"running", lua_qg_running},
 	{"request_exit", lua_qg_request_exit},
+	{"boot_phases", lua_qg_boot_phases},
+	{"first_frame", lua_qg_first_frame},
 	{0, 0}
 };
 
@@ -127,9 +161,9 @@ QGTimer* getQGTimer(lua_State* L){
     return (QGTimer*)luaL_checkudata(L, 1, "Timer");
 }
 
+// The timer lives inside the userdata, Lua frees it
 static int lua_qg_timer_destroy(lua_State* L) {
-    QGTimer* timer = getQGTimer(L);
-    QuickGame_Destroy(&timer);
+    getQGTimer(L);
 
     return 0;
 }
@@ -213,14 +247,150 @@ void initialize_timer(lua_State* L) {
 }
 
 /**
- * @brief Initialize Lua
+ * @brief Loads the module behind a lazy global on first use. The real module replaces the
+ * global and is cached in the proxy's metatable, so copies of the proxy keep working.
+ * 
+ * @param L lua_State, the proxy is at index 1
+ */
+static void lazy_resolve(lua_State* L) {
+    lua_getmetatable(L, 1);
+    lua_getfield(L, -1, "module");
+
+    if(lua_isnil(L, -1)) {
+        lua_pop(L, 1);
+
+        lua_getfield(L, -1, "name");
+        const char* name = lua_touserdata(L, -1);
+        lua_getfield(L, -2, "open");
+        lua_CFunction open = lua_tocfunction(L, -1);
+        lua_pop(L, 2);
+
+        u64 start = QuickGame_Boot_Time();
+        luaL_requiref(L, name, open, 1);
+        QuickGame_Boot_Phase(name, start);
+
+        lua_pushvalue(L, -1);
+        lua_setfield(L, -3, "module");
+    }
+
+    lua_remove(L, -2);
+}
+
+static int lua_lazy_index(lua_State* L) {
+    lazy_resolve(L);
+    lua_pushvalue(L, 2);
+    lua_gettable(L, -2);
+    return 1;
+}
+
+static int lua_lazy_newindex(lua_State* L) {
+    lazy_resolve(L);
+    lua_pushvalue(L, 2);
+    lua_pushvalue(L, 3);
+    lua_settable(L, -3);
+    return 0;
+}
+
+/**
+ * @brief Registers a global that loads its module the first time it is indexed.
+ * require() also works through package.preload.
+ * 
+ * @param L lua_State
+ * @param name Global name -- a string literal, it names the boot phase
+ * @param open Function returning the module
+ */
+static void lazy_global(lua_State* L, const char* name, lua_CFunction open) {
+    lua_getglobal(L, "package");
+    lua_getfield(L, -1, "preload");
+    lua_pushcfunction(L, open);
+    lua_setfield(L, -2, name);
+    lua_pop(L, 2);
+
+    lua_newtable(L);
+    lua_createtable(L, 0, 4);
+    lua_pushlightuserdata(L, (void*)name);
+    lua_setfield(L, -2, "name");
+    lua_pushcfunction(L, open);
+    lua_setfield(L, -2, "open");
+    lua_pushcfunction(L, lua_lazy_index);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, lua_lazy_newindex);
+    lua_setfield(L, -2, "__newindex");
+    lua_setmetatable(L, -2);
+
+    lua_setglobal(L, name);
+}
+
+static int open_camera(lua_State* L) {
+    initialize_camera(L);
+    lua_getglobal(L, "Camera");
+    return 1;
+}
+
+static int open_primitive(lua_State* L) {
+    initialize_primitive(L);
+    lua_getglobal(L, "Primitive");
+    return 1;
+}
+
+int open_audio(lua_State* L) {
+    initialize_audio(L);
+    lua_getglobal(L, "AudioClip");
+    return 1;
+}
+
+static int open_tilemap(lua_State* L) {
+    initialize_tilemap(L);
+    lua_getglobal(L, "Tilemap");
+    return 1;
+}
+
+static int open_profile(lua_State* L) {
+    initialize_profile(L);
+    lua_getglobal(L, "Profile");
+    return 1;
+}
+
+static int open_log(lua_State* L) {
+    initialize_log(L);
+    lua_getglobal(L, "Log");
+    return 1;
+}
+
+static int open_manifest(lua_State* L) {
+    initialize_manifest(L);
+    lua_getglobal(L, "Manifest");
+    return 1;
+}
+
+/**
+ * @brief Initialize Lua. Libraries most scripts need load now, the rest on first use.
  * 
  */
 void qg_lua_init() {
+    u64 start = QuickGame_Boot_Time();
     L = luaL_newstate();
-	luaL_openlibs(L);
+
+    luaL_requiref(L, "_G", luaopen_base, 1);
+    luaL_requiref(L, LUA_LOADLIBNAME, luaopen_package, 1);
+    luaL_requiref(L, LUA_STRLIBNAME, luaopen_string, 1);
+    luaL_requiref(L, LUA_TABLIBNAME, luaopen_table, 1);
+    luaL_requiref(L, LUA_MATHLIBNAME, luaopen_math, 1);
+    lua_pop(L, 5);
+
+    lazy_global(L, LUA_COLIBNAME, luaopen_coroutine);
+    lazy_global(L, LUA_IOLIBNAME, luaopen_io);
+    lazy_global(L, LUA_OSLIBNAME, luaopen_os);
+    lazy_global(L, LUA_DBLIBNAME, luaopen_debug);
+#ifdef LUA_UTF8LIBNAME
+    lazy_global(L, LUA_UTF8LIBNAME, luaopen_utf8);
+#endif
+
     lua_register(L, "print", lua_print);
     lua_register(L, "memoryfree", lua_memfree);
+    QuickGame_Boot_Phase("lua_state", start);
+
+    start = QuickGame_Boot_Time();
 
     //QuickGame Lib
     initialize_quickgame(L);
@@ -229,10 +399,10 @@ void qg_lua_init() {
     initialize_graphics(L);
 
     //Camera Object
-    initialize_camera(L);
+    lazy_global(L, "Camera", open_camera);
 
     //Primitive Lib
-    initialize_primitive(L);
+    lazy_global(L, "Primitive", open_primitive);
 
     //Input Lib
     initialize_input(L);
@@ -241,7 +411,7 @@ void qg_lua_init() {
     initialize_timer(L);
 
     //AudioClip Object
-    initialize_audio(L);
+    lazy_global(L, "AudioClip", open_audio);
 
     //Texture Object
     initialize_texture(L);
@@ -253,22 +423,61 @@ void qg_lua_init() {
     initialize_transform(L);
     
     //Tilemap Object
-    initialize_tilemap(L);
+    lazy_global(L, "Tilemap", open_tilemap);
+
+    //Manifest Object
+    lazy_global(L, "Manifest", open_manifest);
+
+    //Profile Lib
+    lazy_global(L, "Profile", open_profile);
+
+    //Log Lib
+    lazy_global(L, "Log", open_log);
+
+    QuickGame_Boot_Phase("lua_modules", start);
+}
+
+/**
+ * @brief Sets the global arg table like the standalone interpreter: the script at 0, its arguments after
+ * 
+ * @param L lua_State
+ * @param script Script path
+ * @param argc Number of script arguments
+ * @param argv Script arguments
+ */
+static void qg_lua_set_args(lua_State* L, const char* script, int argc, char** argv) {
+    lua_createtable(L, argc, 1);
+
+    lua_pushstring(L, script);
+    lua_rawseti(L, -2, 0);
+
+    for(int i = 0; i < argc; i++) {
+        lua_pushstring(L, argv[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+
+    lua_setglobal(L, "arg");
 }
 
 /**
  * @brief Run Lua
  * 
+ * @param script Script to run
  * @return int Returns Status code
  */
-int qg_lua_run() {
+int qg_lua_run(const char* script) {
     qg_lua_start:
 
     // Load file
-    int ret_stat = luaL_loadfile(L, "script.lua");
+    u64 start = QuickGame_Boot_Time();
+    int ret_stat = luaL_loadfile(L, script);
+    QuickGame_Boot_Phase("script_load", start);
 
     // Failure
     if(ret_stat != 0) {
+#ifndef __PSP__
+        fprintf(stderr, "Lua Error:\n%s\n", lua_tostring(L, -1));
+#endif
         lua_close(L);
         QuickGame_Terminate();
         return 1;
@@ -279,6 +488,7 @@ int qg_lua_run() {
 
     // Error!
     if(ret_stat != 0){
+#ifdef __PSP__
         pspDebugScreenInit();
 		pspDebugScreenEnableBackColor(0);
         
@@ -293,6 +503,11 @@ int qg_lua_run() {
             if(QuickGame_Button_Pressed(PSP_CTRL_START))
                 goto qg_lua_start;
         }
+#else
+        // Nobody can press start on a headless build, write what the script printed before the error
+        QuickGame_Log_Flush();
+        fprintf(stderr, "Lua Error:\n%s\n", lua_tostring(L, -1));
+#endif
     }
 
     // End Game
@@ -300,23 +515,36 @@ int qg_lua_run() {
     return ret_stat;
 }
 
-int main() {
+int main(int argc, char** argv) {
+    QuickGame_Boot_Start();
+
+    // A script given on the command line replaces script.lua, the arguments after it go to the script
+    const char* script = argc > 1 ? argv[1] : "script.lua";
+
     // Init engine
     if(QuickGame_Init() < 0)
         return 1;
 
+    // Scripts print to the log, next to the EBOOT on hardware and to stdout on the host
+#ifdef __PSP__
+    QuickGame_Log_Init("log.txt");
+#else
+    QuickGame_Log_Init(NULL);
+#endif
+
     // Set Graphics 2D
     QuickGame_Graphics_Set2D();
 
     // Initialize Lua
     qg_lua_init();
+    qg_lua_set_args(L, script, argc > 2 ? argc - 2 : 0, argv + 2);
 
     // Run Lua Script
-    int r = qg_lua_run();
+    int r = qg_lua_run(script);
     if(r != 0)
         return r; 
     
     // Terminate engine
     QuickGame_Terminate();
     return 0;
-}
\ No newline at end of file
+}
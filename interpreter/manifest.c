@@ -0,0 +1,259 @@
+#include "manifest.h"
+#include "audio.h"
+
+typedef struct {
+    QGManifest_t manifest;
+    lua_State* L;
+    int callback;
+} LuaManifest;
+
+static LuaManifest* getManifest(lua_State* L) {
+    LuaManifest* m = (LuaManifest*)luaL_checkudata(L, 1, "Manifest");
+    if(m->manifest == NULL)
+        luaL_error(L, "Error: Manifest was destroyed.");
+
+    return m;
+}
+
+// Calls callback(name, done, total, ok) from the update that finished the asset
+static void lua_manifest_progress(const QGAsset* asset, usize done, usize total, anyopaque* user) {
+    LuaManifest* m = (LuaManifest*)user;
+    if(m->callback == LUA_NOREF)
+        return;
+
+    lua_State* L = m->L;
+    lua_rawgeti(L, LUA_REGISTRYINDEX, m->callback);
+    lua_pushstring(L, asset->name);
+    lua_pushinteger(L, done);
+    lua_pushinteger(L, total);
+    lua_pushboolean(L, asset->state == QG_ASSET_READY);
+    lua_call(L, 4, 0);
+}
+
+static int lua_qg_manifest_load(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Manifest.load() takes 1 argument.");
+
+    const char* filename = luaL_checkstring(L, 1);
+
+    LuaManifest* m = lua_newuserdata(L,sizeof(LuaManifest));
+    m->manifest = QuickGame_Manifest_Load(filename);
+    m->L = L;
+    m->callback = LUA_NOREF;
+
+    if(m->manifest == NULL)
+        return luaL_error(L, "Error: Manifest %s failed to load.", filename);
+
+    luaL_getmetatable(L, "Manifest");
+    lua_setmetatable(L, -2); 
+
+    return 1;
+}
+
+static int lua_qg_manifest_destroy(lua_State* L) {
+    LuaManifest* m = (LuaManifest*)luaL_checkudata(L, 1, "Manifest");
+    QuickGame_Manifest_Destroy(&m->manifest);
+
+    luaL_unref(L, LUA_REGISTRYINDEX, m->callback);
+    m->callback = LUA_NOREF;
+
+    return 0;
+}
+
+static int lua_qg_manifest_start(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1 && argc != 2)
+        return luaL_error(L, "Error: Manifest:start() takes 1 or 2 arguments.");
+
+    LuaManifest* m = getManifest(L);
+    if(argc == 2) {
+        if(!lua_isfunction(L, 2))
+            return luaL_error(L, "Error: Manifest:start() callback must be a function.");
+
+        lua_pushvalue(L, 2);
+        m->callback = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+
+    m->L = L;
+    if(QuickGame_Manifest_Start(m->manifest, lua_manifest_progress, m) < 0)
+        return luaL_error(L, "Error: Manifest was already started.");
+
+    return 0;
+}
+
+static int lua_qg_manifest_update(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Manifest:update() takes 1 argument.");
+
+    LuaManifest* m = getManifest(L);
+    m->L = L;
+    QuickGame_Manifest_Update(m->manifest);
+
+    lua_pushnumber(L, QuickGame_Manifest_Progress(m->manifest));
+    return 1;
+}
+
+static int lua_qg_manifest_wait(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Manifest:wait() takes 1 argument.");
+
+    LuaManifest* m = getManifest(L);
+    m->L = L;
+    QuickGame_Manifest_Wait(m->manifest);
+
+    return 0;
+}
+
+static int lua_qg_manifest_progress(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Manifest:progress() takes 1 argument.");
+
+    LuaManifest* m = getManifest(L);
+    lua_pushnumber(L, QuickGame_Manifest_Progress(m->manifest));
+    return 1;
+}
+
+static int lua_qg_manifest_done(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Manifest:done() takes 1 argument.");
+
+    LuaManifest* m = getManifest(L);
+    lua_pushboolean(L, QuickGame_Manifest_Done(m->manifest));
+    return 1;
+}
+
+// Textures and sounds move to Lua ownership, later calls with the same name return nil
+static int lua_qg_manifest_texture(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 2)
+        return luaL_error(L, "Error: Manifest:texture() takes 2 arguments.");
+
+    LuaManifest* m = getManifest(L);
+    const char* name = luaL_checkstring(L, 2);
+
+    QGAsset* asset = QuickGame_Manifest_Find(m->manifest, name);
+    if(asset == NULL || asset->type != QG_ASSET_TEXTURE)
+        return luaL_error(L, "Error: Manifest has no texture %s.", name);
+
+    QGTexture_t texture = QuickGame_Manifest_Take(m->manifest, name);
+    if(texture == NULL) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    QGHandle* handle = lua_newuserdata(L,sizeof(QGHandle));
+    *handle = QuickGame_Handle_Create(QG_HANDLE_TEXTURE, texture);
+    if(*handle == QG_NULL_HANDLE)
+        QuickGame_Texture_Destroy(&texture);
+
+    luaL_getmetatable(L, "Texture");
+    lua_setmetatable(L, -2); 
+
+    return 1;
+}
+
+static int lua_qg_manifest_sound(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 2)
+        return luaL_error(L, "Error: Manifest:sound() takes 2 arguments.");
+
+    LuaManifest* m = getManifest(L);
+    const char* name = luaL_checkstring(L, 2);
+
+    QGAsset* asset = QuickGame_Manifest_Find(m->manifest, name);
+    if(asset == NULL || asset->type != QG_ASSET_SOUND)
+        return luaL_error(L, "Error: Manifest has no sound %s.", name);
+
+    QGAudioClip_t clip = QuickGame_Manifest_Take(m->manifest, name);
+    if(clip == NULL) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    // Loads the lazy AudioClip module, which registers the metatable, whatever the global holds now
+    luaL_requiref(L, "AudioClip", open_audio, 0);
+    lua_pop(L, 1);
+
+    QGHandle* handle = lua_newuserdata(L,sizeof(QGHandle));
+    *handle = QuickGame_Handle_Create(QG_HANDLE_CLIP, clip);
+    if(*handle == QG_NULL_HANDLE)
+        QuickGame_Audio_Destroy(&clip);
+
+    luaL_getmetatable(L, "AudioClip");
+    lua_setmetatable(L, -2); 
+
+    return 1;
+}
+
+static int lua_qg_manifest_script(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 2)
+        return luaL_error(L, "Error: Manifest:script() takes 2 arguments.");
+
+    LuaManifest* m = getManifest(L);
+    const char* name = luaL_checkstring(L, 2);
+
+    usize size = 0;
+    const u8* data = QuickGame_Manifest_Get_Data(m->manifest, name, &size);
+    if(data == NULL) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    QGAsset* asset = QuickGame_Manifest_Find(m->manifest, name);
+    if(luaL_loadbuffer(L, (const char*)data, size, asset->path) != 0)
+        return lua_error(L);
+
+    return 1;
+}
+
+static const luaL_Reg manifestLib[] = { // Manifest methods
+	{"load", lua_qg_manifest_load},
+	{"destroy", lua_qg_manifest_destroy},
+	{"start", lua_qg_manifest_start},
+	{"update", lua_qg_manifest_update},
+	{"wait", lua_qg_manifest_wait},
+	{"progress", lua_qg_manifest_progress},
+	{"done", lua_qg_manifest_done},
+	{"texture", lua_qg_manifest_texture},
+	{"sound", lua_qg_manifest_sound},
+	{"script", lua_qg_manifest_script},
+	{0,0}
+};
+
+static const luaL_Reg manifestMetaLib[] = {
+	{"__gc", lua_qg_manifest_destroy},
+	{0,0}
+};
+
+void initialize_manifest(lua_State* L) {
+    int lib_id, meta_id;
+
+    // new class = {}
+    lua_createtable(L, 0, 0);
+    lib_id = lua_gettop(L);
+
+    // meta table = {}
+    luaL_newmetatable(L, "Manifest");
+    meta_id = lua_gettop(L);
+    luaL_setfuncs(L, manifestMetaLib, 0);
+
+    // meta table = methods
+    luaL_newlib(L, manifestLib);
+    lua_setfield(L, meta_id, "__index");  
+
+    // meta table.metatable = metatable
+    luaL_newlib(L, manifestMetaLib);
+    lua_setfield(L, meta_id, "__metatable");
+
+    // class.metatable = metatable
+    lua_setmetatable(L, lib_id);
+
+    // Manifest
+    lua_setglobal(L, "Manifest");
+}
@@ -0,0 +1,14 @@
+#include <QuickGame.h>
+#include <lua.h>
+#include <lualib.h>
+#include <lauxlib.h>
+#include <luaconf.h>
+#include <pspdebug.h>
+#include <pspctrl.h>
+
+#ifndef MANIFEST_INCLUDED_H
+#define MANIFEST_INCLUDED_H
+
+void initialize_manifest(lua_State* L);
+
+#endif
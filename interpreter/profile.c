@@ -0,0 +1,128 @@
+#include "profile.h"
+
+// The profiler keeps the name pointers, the strings are held here so Lua does not collect them
+#define PROFILE_NAMES "QGProfileNames"
+
+static const char* keep_name(lua_State* L, int idx) {
+    const char* name = luaL_checkstring(L, idx);
+
+    lua_getfield(L, LUA_REGISTRYINDEX, PROFILE_NAMES);
+    lua_pushvalue(L, idx);
+    lua_rawseti(L, -2, lua_rawlen(L, -2) + 1);
+    lua_pop(L, 1);
+
+    return name;
+}
+
+static int lua_qg_profile_start(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 2)
+        return luaL_error(L, "Error: Profile.start() takes 2 arguments.");
+
+    usize frames = luaL_checkinteger(L, 2);
+
+    // Names of the previous run are released with it
+    lua_newtable(L);
+    lua_setfield(L, LUA_REGISTRYINDEX, PROFILE_NAMES);
+
+    const char* scenario = keep_name(L, 1);
+    lua_pushboolean(L, QuickGame_Profile_Start(scenario, frames) >= 0);
+    return 1;
+}
+
+static int lua_qg_profile_stop(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: Profile.stop() takes 0 arguments.");
+
+    QuickGame_Profile_Stop();
+    return 0;
+}
+
+static int lua_qg_profile_section(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Profile.section() takes 1 argument.");
+
+    const char* name = keep_name(L, 1);
+    lua_pushinteger(L, QuickGame_Profile_Section(name));
+    return 1;
+}
+
+static int lua_qg_profile_begin(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Profile.begin() takes 1 argument.");
+
+    QuickGame_Profile_Begin(luaL_checkinteger(L, 1));
+    return 0;
+}
+
+static int lua_qg_profile_finish(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 1)
+        return luaL_error(L, "Error: Profile.finish() takes 1 argument.");
+
+    QuickGame_Profile_End(luaL_checkinteger(L, 1));
+    return 0;
+}
+
+static int lua_qg_profile_frame(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 0)
+        return luaL_error(L, "Error: Profile.frame() takes 0 arguments.");
+
+    lua_pushboolean(L, QuickGame_Profile_Frame());
+    return 1;
+}
+
+static int lua_qg_profile_percentile(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 2)
+        return luaL_error(L, "Error: Profile.percentile() takes 2 arguments.");
+
+    i32 section = luaL_checkinteger(L, 1);
+    f32 percentile = luaL_checknumber(L, 2);
+
+    lua_pushnumber(L, QuickGame_Profile_Percentile(section, percentile));
+    return 1;
+}
+
+static int lua_qg_profile_report(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc > 1)
+        return luaL_error(L, "Error: Profile.report() takes 0 or 1 arguments.");
+
+    const char* filename = argc == 1 && !lua_isnil(L, 1) ? luaL_checkstring(L, 1) : NULL;
+    lua_pushboolean(L, QuickGame_Profile_Report(filename) >= 0);
+    return 1;
+}
+
+static const luaL_Reg profileLib[] = {
+	{"start", lua_qg_profile_start},
+	{"stop", lua_qg_profile_stop},
+	{"section", lua_qg_profile_section},
+	{"begin", lua_qg_profile_begin},
+	{"finish", lua_qg_profile_finish},
+	{"frame", lua_qg_profile_frame},
+	{"percentile", lua_qg_profile_percentile},
+	{"report", lua_qg_profile_report},
+	{0, 0}
+};
+
+void initialize_profile(lua_State* L) {
+    lua_newtable(L);
+    lua_setfield(L, LUA_REGISTRYINDEX, PROFILE_NAMES);
+
+    // A fresh table, the global is still the lazy proxy that loads this module
+    lua_newtable(L);
+    luaL_setfuncs(L, profileLib, 0);
+
+    // Sections timed by the engine, in the table since Profile loads on first use
+    lua_pushinteger(L, QG_PROFILE_INPUT);
+    lua_setfield(L, -2, "INPUT");
+    lua_pushinteger(L, QG_PROFILE_PRESENT);
+    lua_setfield(L, -2, "PRESENT");
+
+    lua_setglobal(L, "Profile");
+}
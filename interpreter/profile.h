@@ -0,0 +1,14 @@
+#include <QuickGame.h>
+#include <lua.h>
+#include <lualib.h>
+#include <lauxlib.h>
+#include <luaconf.h>
+#include <pspdebug.h>
+#include <pspctrl.h>
+
+#ifndef PROFILE_INCLUDED_H
+#define PROFILE_INCLUDED_H
+
+void initialize_profile(lua_State* L);
+
+#endif
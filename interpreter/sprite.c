@@ -2,16 +2,22 @@
 
 static int lua_qg_texture_load(lua_State* L) {
     int argc = lua_gettop(L);
-    if (argc != 3)
-        return luaL_error(L, "Error: Texture.load() takes 3 arguments.");
+    if (argc != 3 && argc != 4)
+        return luaL_error(L, "Error: Texture.load() takes 3 or 4 arguments.");
 
-    QGTexture_t* texture = lua_newuserdata(L,sizeof(QGTexture_t));
+    QGHandle* handle = lua_newuserdata(L,sizeof(QGHandle));
 
-    const char* filename = luaL_checkstring(L, 1);
-    bool flip  = luaL_checkinteger(L, 2);
-    bool vram = luaL_checkinteger(L, 3);
+    QGTexInfo info = {
+        .filename = luaL_checkstring(L, 1),
+        .flip = luaL_checkinteger(L, 2),
+        .vram = luaL_checkinteger(L, 3),
+        .mask = argc == 4 && lua_toboolean(L, 4)
+    };
 
-    *texture = QuickGame_Texture_Load(filename, flip, vram);
+    QGTexture_t texture = QuickGame_Texture_Load_Alt(info);
+    *handle = QuickGame_Handle_Create(QG_HANDLE_TEXTURE, texture);
+    if(*handle == QG_NULL_HANDLE)
+        QuickGame_Texture_Destroy(&texture);
 
     luaL_getmetatable(L, "Texture");
     lua_setmetatable(L, -2); 
@@ -19,16 +25,23 @@ static int lua_qg_texture_load(lua_State* L) {
     return 1;
 }
 
-QGTexture_t* getTex(lua_State* L){
-    return (QGTexture_t*)luaL_checkudata(L, 1, "Texture");
+// Userdata holds a handle, a destroyed texture is caught instead of used after free
+QGTexture_t getTexn(lua_State* L, int n){
+    QGHandle* handle = (QGHandle*)luaL_checkudata(L, n, "Texture");
+    QGTexture_t texture = QuickGame_Handle_Get_Texture(*handle);
+    if(texture == NULL)
+        luaL_error(L, "Error: Texture was destroyed or failed to load.");
+
+    return texture;
 }
-QGTexture_t* getTexn(lua_State* L, int n){
-    return (QGTexture_t*)luaL_checkudata(L, n, "Texture");
+QGTexture_t getTex(lua_State* L){
+    return getTexn(L, 1);
 }
 
 static int lua_qg_texture_destroy(lua_State* L) {
-    QGTexture_t* tex = getTex(L);
-    QuickGame_Destroy(tex);
+    QGHandle* handle = (QGHandle*)luaL_checkudata(L, 1, "Texture");
+    QuickGame_Handle_Destroy(*handle);
+    *handle = QG_NULL_HANDLE;
 
     return 0;
 }
@@ -39,7 +52,7 @@ static int lua_qg_texture_bind(lua_State* L) {
     if (argc != 1)
         return luaL_error(L, "Error: Texture:bind() takes 1 arguments.");
 
-    QGTexture_t texture = *getTex(L);
+    QGTexture_t texture = getTex(L);
 
     QuickGame_Texture_Bind(texture);
 
@@ -51,7 +64,7 @@ static int lua_qg_texture_unbind(lua_State* L) {
     if (argc != 1)
         return luaL_error(L, "Error: Texture:unbind() takes 1 arguments.");
 
-    QGTexture_t texture = *getTex(L);
+    QGTexture_t texture = getTex(L);
 
     QuickGame_Texture_Unbind();
 
@@ -98,21 +111,48 @@ void initialize_texture(lua_State* L) {
     lua_setglobal(L, "Texture");
 }
 
+// Sprites and tilemaps use their texture through its pointer, so they hold a reference to
+// it: destroying the texture in Lua only drops the reference of the Lua object.
+typedef struct {
+    QGHandle sprite;
+    QGHandle texture;
+} LuaSprite;
+
+typedef struct {
+    QGTilemap_t tilemap;
+    QGHandle texture;
+} LuaTilemap;
+
+// Takes a texture already checked with getTexn()
+static QGHandle retain_texture(lua_State* L, int n) {
+    QGHandle texture = *(QGHandle*)lua_touserdata(L, n);
+    if(QuickGame_Handle_Retain(texture) < 0)
+        luaL_error(L, "Error: Texture is used by too many objects.");
+
+    return texture;
+}
+
 static int lua_qg_sprite_create(lua_State* L) {
     int argc = lua_gettop(L);
     if (argc != 5)
         return luaL_error(L, "Error: Sprite.create() takes 5 arguments.");
 
-    QGSprite_t* sprite = lua_newuserdata(L,sizeof(QGSprite_t));
-
     int x = luaL_checkinteger(L, 1);
     int y = luaL_checkinteger(L, 2);
     int w = luaL_checkinteger(L, 3);
     int h = luaL_checkinteger(L, 4);
 
-    QGTexture_t tex = *getTexn(L,5);
+    QGTexture_t tex = getTexn(L,5);
+
+    QGHandle texture = retain_texture(L, 5);
+
+    LuaSprite* ls = lua_newuserdata(L,sizeof(LuaSprite));
+    ls->texture = texture;
 
-    *sprite = QuickGame_Sprite_Create_Alt(x, y, w, h, tex);
+    QGSprite_t sprite = QuickGame_Sprite_Create_Alt(x, y, w, h, tex);
+    ls->sprite = QuickGame_Handle_Create(QG_HANDLE_SPRITE, sprite);
+    if(ls->sprite == QG_NULL_HANDLE)
+        QuickGame_Sprite_Destroy(&sprite);
 
     luaL_getmetatable(L, "Sprite");
     lua_setmetatable(L, -2); 
@@ -120,17 +160,25 @@ static int lua_qg_sprite_create(lua_State* L) {
     return 1;
 }
 
-QGSprite_t* getSprite(lua_State* L){
-    return (QGSprite_t*)luaL_checkudata(L, 1, "Sprite");
+QGSprite_t getSpriten(lua_State* L, int n){
+    LuaSprite* ls = (LuaSprite*)luaL_checkudata(L, n, "Sprite");
+    QGSprite_t sprite = QuickGame_Handle_Get_Sprite(ls->sprite);
+    if(sprite == NULL)
+        luaL_error(L, "Error: Sprite was destroyed or failed to create.");
+
+    return sprite;
 }
 
-QGSprite_t* getSpriten(lua_State* L, int n){
-    return (QGSprite_t*)luaL_checkudata(L, n, "Sprite");
+QGSprite_t getSprite(lua_State* L){
+    return getSpriten(L, 1);
 }
 
 static int lua_qg_sprite_destroy(lua_State* L) {
-    QGSprite_t* sprite = getSprite(L);
-    QuickGame_Sprite_Destroy(sprite);
+    LuaSprite* ls = (LuaSprite*)luaL_checkudata(L, 1, "Sprite");
+    QuickGame_Handle_Destroy(ls->sprite);
+    QuickGame_Handle_Destroy(ls->texture);
+    ls->sprite = QG_NULL_HANDLE;
+    ls->texture = QG_NULL_HANDLE;
 
     return 0;
 }
@@ -140,7 +188,7 @@ static int lua_qg_sprite_draw(lua_State* L) {
     if (argc != 1)
         return luaL_error(L, "Error: Sprite:draw() takes 1 arguments.");
 
-    QGSprite_t sprite = *getSprite(L);
+    QGSprite_t sprite = getSprite(L);
 
     QuickGame_Sprite_Draw(sprite);
 
@@ -152,8 +200,8 @@ static int lua_qg_sprite_intersects(lua_State* L) {
     if (argc != 2)
         return luaL_error(L, "Error: Sprite:intersects() takes 2 arguments.");
 
-    QGSprite_t sprite1 = *getSpriten(L,1);
-    QGSprite_t sprite2 = *getSpriten(L, 2);
+    QGSprite_t sprite1 = getSpriten(L,1);
+    QGSprite_t sprite2 = getSpriten(L, 2);
 
     bool i = QuickGame_Sprite_Intersects(sprite1, sprite2);
 
@@ -161,13 +209,26 @@ static int lua_qg_sprite_intersects(lua_State* L) {
     return 1;
 }
 
+static int lua_qg_sprite_intersects_pixel(lua_State* L) {
+    int argc = lua_gettop(L);
+    if (argc != 2)
+        return luaL_error(L, "Error: Sprite:intersects_pixel() takes 2 arguments.");
+
+    QGSprite_t sprite1 = getSpriten(L,1);
+    QGSprite_t sprite2 = getSpriten(L, 2);
+
+    bool i = QuickGame_Sprite_Intersects_Pixel(sprite1, sprite2);
+
+    lua_pushboolean(L, i);
+    return 1;
+}
 
 static int lua_qg_sprite_set_position(lua_State* L) {
     int argc = lua_gettop(L);
     if (argc != 3)
         return luaL_error(L, "Error: Sprite:set_position() takes 3 arguments.");
 
-    QGSprite_t sprite1 = *getSpriten(L,1);
+    QGSprite_t sprite1 = getSpriten(L,1);
     int x = luaL_checkinteger(L, 2);
     int y = luaL_checkinteger(L, 3);
 
@@ -181,7 +242,7 @@ static int lua_qg_sprite_set_scale(lua_State* L) {
     if (argc != 3)
         return luaL_error(L, "Error: Sprite:set_scale() takes 3 arguments.");
 
-    QGSprite_t sprite1 = *getSpriten(L,1);
+    QGSprite_t sprite1 = getSpriten(L,1);
     int w = luaL_checkinteger(L, 2);
     int h = luaL_checkinteger(L, 3);
 
@@ -196,7 +257,7 @@ static int lua_qg_sprite_set_rotation(lua_State* L) {
     if (argc != 2)
         return luaL_error(L, "Error: Sprite:set_rotation() takes 2 arguments.");
 
-    QGSprite_t sprite1 = *getSpriten(L,1);
+    QGSprite_t sprite1 = getSpriten(L,1);
     f32 rot = luaL_checknumber(L, 2);
 
     sprite1->transform.rotation = rot;
@@ -209,7 +270,7 @@ static int lua_qg_sprite_set_layer(lua_State* L) {
     if (argc != 2)
         return luaL_error(L, "Error: Sprite:set_layer() takes 2 arguments.");
 
-    QGSprite_t sprite1 = *getSpriten(L,1);
+    QGSprite_t sprite1 = getSpriten(L,1);
     int layer = luaL_checkinteger(L, 2);
 
     sprite1->layer = layer;
@@ -223,7 +284,7 @@ static int lua_qg_sprite_set_color(lua_State* L) {
     if (argc != 2)
         return luaL_error(L, "Error: Sprite:set_color() takes 2 arguments.");
 
-    QGSprite_t sprite1 = *getSpriten(L,1);
+    QGSprite_t sprite1 = getSpriten(L,1);
     int color = luaL_checkinteger(L, 2);
 
     sprite1->color.color = color;
@@ -237,6 +298,7 @@ static const luaL_Reg spriteLib[] = {
 	{"destroy", lua_qg_sprite_destroy},
 	{"draw", lua_qg_sprite_draw},
 	{"intersects", lua_qg_sprite_intersects},
+	{"intersects_pixel", lua_qg_sprite_intersects_pixel},
 	{"set_position", lua_qg_sprite_set_position},
 	{"set_rotation", lua_qg_sprite_set_rotation},
 	{"set_scale", lua_qg_sprite_set_scale},
@@ -283,11 +345,9 @@ static int lua_qg_tilemap_create(lua_State* L) {
     if (argc != 5)
         return luaL_error(L, "Error: Tilemap.create() takes 5 arguments.");
 
-    QGTilemap_t* tmap = lua_newuserdata(L,sizeof(QGTilemap_t));
-
     int x = luaL_checkinteger(L, 1);
     int y = luaL_checkinteger(L, 2);
-    QGTexture_t tex = *getTexn(L,3);
+    QGTexture_t tex = getTexn(L,3);
     int w = luaL_checkinteger(L, 4);
     int h = luaL_checkinteger(L, 5);
 
@@ -301,7 +361,11 @@ static int lua_qg_tilemap_create(lua_State* L) {
         .y = y
     };
 
-    *tmap = QuickGame_Tilemap_Create(atlas, tex, size);
+    QGHandle texture = retain_texture(L, 3);
+
+    LuaTilemap* lt = lua_newuserdata(L,sizeof(LuaTilemap));
+    lt->texture = texture;
+    lt->tilemap = QuickGame_Tilemap_Create(atlas, tex, size);
 
     luaL_getmetatable(L, "Tilemap");
     lua_setmetatable(L, -2); 
@@ -310,12 +374,14 @@ static int lua_qg_tilemap_create(lua_State* L) {
 }
 
 QGTilemap_t* getTilemap(lua_State* L){
-    return (QGTilemap_t*)luaL_checkudata(L, 1, "Tilemap");
+    return &((LuaTilemap*)luaL_checkudata(L, 1, "Tilemap"))->tilemap;
 }
 
 static int lua_qg_tilemap_destroy(lua_State* L) {
-    QGTilemap_t* tilemap = getTilemap(L);
-    QuickGame_Tilemap_Destroy(tilemap);
+    LuaTilemap* lt = (LuaTilemap*)luaL_checkudata(L, 1, "Tilemap");
+    QuickGame_Tilemap_Destroy(&lt->tilemap);
+    QuickGame_Handle_Destroy(lt->texture);
+    lt->texture = QG_NULL_HANDLE;
 
     return 0;
 }
@@ -350,7 +416,7 @@ static int lua_qg_tilemap_intersects(lua_State* L) {
         return luaL_error(L, "Error: Tilemap:intersects() takes 2 arguments.");
 
     QGTilemap_t tilemap = *getTilemap(L);
-    QGSprite_t sprite2 = *getSpriten(L, 2);
+    QGSprite_t sprite2 = getSpriten(L, 2);
 
     bool i = QuickGame_Tilemap_Intersects(tilemap, sprite2->transform);
 
@@ -14,4 +14,6 @@ void initialize_texture(lua_State* L);
 
 void initialize_tilemap(lua_State* L);
 
+QGTexture_t getTexn(lua_State* L, int n);
+
 #endif
\ No newline at end of file
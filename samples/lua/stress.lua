@@ -0,0 +1,129 @@
+-- Stress scene: 1000 scripted objects driven by a replayed input track.
+-- Prints frame time percentiles and the time of each part of the frame after 1800 frames,
+-- and writes the same report to stress-lua.json.
+
+FRAMES = 1800
+OBJECTS = 1000
+DT = 1 / 60
+
+-- Same track as the C stress samples: frames, buttons, stick x, stick y
+segments = {
+    {120, PSP_RIGHT, 128, 128},
+    {120, PSP_DOWN, 128, 128},
+    {90, PSP_RIGHT + PSP_CROSS, 128, 128},
+    {60, 0, 255, 128},
+    {120, PSP_LEFT, 128, 128},
+    {60, PSP_CIRCLE, 128, 0},
+    {120, PSP_UP, 128, 128},
+    {60, PSP_CROSS, 0, 255},
+    {50, 0, 128, 128},
+}
+
+track = {}
+while #track < FRAMES do
+    for _, s in ipairs(segments) do
+        for i = 1, s[1] do
+            if #track < FRAMES then
+                track[#track + 1] = {s[2], s[3], s[4]}
+            end
+        end
+    end
+end
+
+-- Fixed seed so every run does the same work
+seed = 1
+function random(min, max)
+    seed = (seed * 16807) % 2147483647
+    return min + seed / 2147483647 * (max - min)
+end
+
+Mover = {}
+Mover.__index = Mover
+
+function Mover.new()
+    local self = setmetatable({}, Mover)
+    self.x = random(0, 480)
+    self.y = random(0, 272)
+    self.vx = random(-80, 80)
+    self.vy = random(-80, 80)
+    self.size = random(4, 10)
+    self.rotation = 0
+    self.color = Color.create(math.floor(random(64, 255)), math.floor(random(64, 255)), 255, 255)
+    self.transform = Transform.create()
+    self.transform:set_scale(self.size, self.size)
+    return self
+end
+
+function Mover:update(dt, wind_x, wind_y, spin)
+    self.x = self.x + (self.vx + wind_x) * dt
+    self.y = self.y + (self.vy + wind_y) * dt
+
+    if self.x < 0 or self.x > 480 then
+        self.vx = -self.vx
+        self.x = math.max(0, math.min(480, self.x))
+    end
+    if self.y < 0 or self.y > 272 then
+        self.vy = -self.vy
+        self.y = math.max(0, math.min(272, self.y))
+    end
+
+    if spin then
+        self.rotation = self.rotation + 180 * dt
+        self.transform:set_rotation(self.rotation)
+    end
+
+    self.transform:set_position(self.x, self.y)
+end
+
+function Mover:draw(tint)
+    Primitive.draw_rectangle(self.transform, tint or self.color)
+end
+
+objects = {}
+for i = 1, OBJECTS do
+    objects[i] = Mover.new()
+end
+
+tint = Color.create(255, 64, 64, 255)
+Graphics.set_clear_color(Color.create(16, 16, 16, 255))
+
+Input.replay(track)
+Profile.start("stress-lua", FRAMES)
+update_section = Profile.section("update")
+draw_section = Profile.section("draw")
+
+done = false
+while QuickGame.running() and not done do
+    Input.update()
+
+    Profile.begin(update_section)
+    local wind_x = Input.analog_x() * 60
+    local wind_y = -Input.analog_y() * 60
+    if Input.button_held(PSP_LEFT) then wind_x = wind_x - 60 end
+    if Input.button_held(PSP_RIGHT) then wind_x = wind_x + 60 end
+    if Input.button_held(PSP_UP) then wind_y = wind_y + 60 end
+    if Input.button_held(PSP_DOWN) then wind_y = wind_y - 60 end
+    local spin = Input.button_held(PSP_CROSS)
+
+    for i = 1, OBJECTS do
+        objects[i]:update(DT, wind_x, wind_y, spin)
+    end
+    Profile.finish(update_section)
+
+    Graphics.start_frame()
+    Graphics.clear()
+
+    Profile.begin(draw_section)
+    local t = Input.button_held(PSP_CIRCLE) and tint or nil
+    for i = 1, OBJECTS do
+        objects[i]:draw(t)
+    end
+    Profile.finish(draw_section)
+
+    Graphics.end_frame(true)
+    done = Profile.frame()
+end
+
+print(string.format("stress-lua: p50 %.2f ms, p99 %.2f ms", Profile.percentile(-1, 50), Profile.percentile(-1, 99)))
+Profile.report(nil)
+Profile.report("stress-lua.json")
@@ -0,0 +1,109 @@
+#include "stress.h"
+#include <math.h>
+#include <string.h>
+
+#define CLIP_COUNT 32
+
+// Each clip plays on a hardware channel, the PSP has 8 of them
+#define CHANNEL_COUNT 8
+
+#define SAMPLE_RATE 22050
+#define CLIP_SAMPLES (SAMPLE_RATE / 2)
+
+static QGAudioClip_t clips[CLIP_COUNT];
+
+/**
+ * Writes a 16-bit mono WAV of a decaying tone, so the clips need no files
+ */
+static usize create_wav(u8* wav, f32 frequency) {
+    u32 data_size = CLIP_SAMPLES * sizeof(i16);
+    u32 format[4] = { 16, 1 | (1 << 16), SAMPLE_RATE, SAMPLE_RATE * sizeof(i16) };
+    u32 block = sizeof(i16) | (16 << 16);
+    u32 riff_size = 36 + data_size;
+
+    memcpy(wav, "RIFF", 4);
+    memcpy(wav + 4, &riff_size, 4);
+    memcpy(wav + 8, "WAVEfmt ", 8);
+    memcpy(wav + 16, format, sizeof(format));
+    memcpy(wav + 32, &block, 4);
+    memcpy(wav + 36, "data", 4);
+    memcpy(wav + 40, &data_size, 4);
+
+    i16* samples = (i16*)(wav + 44);
+    for(u32 i = 0; i < CLIP_SAMPLES; i++) {
+        f32 t = (f32)i / SAMPLE_RATE;
+        samples[i] = (i16)(sinf(t * frequency * 6.2831853f) * expf(-t * 4.0f) * 8000.0f);
+    }
+
+    return 44 + data_size;
+}
+
+int main(int argc, char** argv) {
+    if(Stress_Init("stress-audio") < 0)
+        return 1;
+
+    static u8 wav[44 + CLIP_SAMPLES * sizeof(i16)];
+    for(usize i = 0; i < CLIP_COUNT; i++) {
+        usize size = create_wav(wav, 220.0f + i * 27.5f);
+        clips[i] = QuickGame_Audio_Load_Memory("stress.wav", wav, size, false);
+        if(clips[i] == NULL)
+            return 1;
+    }
+
+    i32 update_section = QuickGame_Profile_Section("update");
+    i32 draw_section = QuickGame_Profile_Section("draw");
+
+    usize next_clip = 0;
+    usize next_channel = 0;
+    u32 frame = 0;
+    u8 playing[CHANNEL_COUNT];
+    memset(playing, 0, sizeof(playing));
+
+    do {
+        QuickGame_Input_Update();
+
+        // Every channel is kept busy: a clip starts every few frames, cycling through all 32 so
+        // clips are stopped and replaced mid-play. The replay speeds this up while cross is held.
+        QuickGame_Profile_Begin(update_section);
+        u32 interval = QuickGame_Button_Held(PSP_CTRL_CROSS) ? 1 : 4;
+        if(frame % interval == 0) {
+            QuickGame_Audio_Stop(clips[playing[next_channel]]);
+            QuickGame_Audio_Play(clips[next_clip], next_channel);
+            playing[next_channel] = next_clip;
+
+            next_clip = (next_clip + 1) % CLIP_COUNT;
+            next_channel = (next_channel + 1) % CHANNEL_COUNT;
+        }
+
+        if(QuickGame_Button_Pressed(PSP_CTRL_CIRCLE)) {
+            for(usize i = 0; i < CLIP_COUNT; i++)
+                QuickGame_Audio_Set_Volume(clips[i], (i % 4) / 4.0f);
+        }
+        frame++;
+        QuickGame_Profile_End(update_section);
+
+        QuickGame_Graphics_Start_Frame();
+        QuickGame_Graphics_Clear();
+
+        // A bar per channel, its height the pitch of the clip on it
+        QuickGame_Profile_Begin(draw_section);
+        for(usize i = 0; i < CHANNEL_COUNT; i++) {
+            f32 height = 16.0f + playing[i] * 6.0f;
+            QGTransform2D bar = {
+                .position = { .x = 60.0f + i * 52.0f, .y = 40.0f + height / 2.0f },
+                .rotation = 0.0f,
+                .scale = { .x = 40.0f, .y = height }
+            };
+            QuickGame_Primitive_Draw_Rectangle(bar, (QGColor){ .color = 0xFF40C0FF });
+        }
+        QuickGame_Profile_End(draw_section);
+
+        QuickGame_Graphics_End_Frame(true);
+    } while(Stress_Frame());
+
+    for(usize i = 0; i < CLIP_COUNT; i++)
+        QuickGame_Audio_Destroy(&clips[i]);
+
+    Stress_Finish();
+    return 0;
+}
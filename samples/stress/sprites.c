@@ -0,0 +1,118 @@
+#include "stress.h"
+
+#define SPRITE_COUNT 5000
+
+static QGSprite_t sprites[SPRITE_COUNT];
+static QGVector2 velocity[SPRITE_COUNT];
+
+// Fixed seed, every run moves the sprites the same way
+static u32 seed = 1;
+static f32 random_range(f32 min, f32 max) {
+    seed = seed * 1103515245 + 12345;
+    return min + (f32)((seed >> 16) & 0x7FFF) / 32767.0f * (max - min);
+}
+
+static QGTexture_t create_texture() {
+    QGTexture_t texture = QuickGame_Texture_Create_Dynamic(16, 16, false);
+    if(texture == NULL)
+        return NULL;
+
+    // Ring with a transparent middle, so blending does real work
+    u32* texels = QuickGame_Texture_Staging(texture);
+    for(i32 y = 0; y < 16; y++) {
+        for(i32 x = 0; x < 16; x++) {
+            i32 dx = x * 2 - 15, dy = y * 2 - 15;
+            i32 d = dx * dx + dy * dy;
+            texels[y * 16 + x] = d < 225 && d > 100 ? 0xFFFFFFFF : 0;
+        }
+    }
+    QuickGame_Texture_Update_Rect(texture, 0, 0, 16, 16);
+
+    return texture;
+}
+
+static void update(f32 dt) {
+    // The replay pushes everything around and spins or tints it while buttons are held
+    QGVector2 wind = {
+        .x = QuickGame_Analog_X() * 60.0f,
+        .y = -QuickGame_Analog_Y() * 60.0f
+    };
+
+    if(QuickGame_Button_Held(PSP_CTRL_LEFT))
+        wind.x -= 60.0f;
+    if(QuickGame_Button_Held(PSP_CTRL_RIGHT))
+        wind.x += 60.0f;
+    if(QuickGame_Button_Held(PSP_CTRL_UP))
+        wind.y += 60.0f;
+    if(QuickGame_Button_Held(PSP_CTRL_DOWN))
+        wind.y -= 60.0f;
+
+    bool spin = QuickGame_Button_Held(PSP_CTRL_CROSS);
+    bool tint = QuickGame_Button_Held(PSP_CTRL_CIRCLE);
+
+    for(usize i = 0; i < SPRITE_COUNT; i++) {
+        QGTransform2D* transform = &sprites[i]->transform;
+        transform->position.x += (velocity[i].x + wind.x) * dt;
+        transform->position.y += (velocity[i].y + wind.y) * dt;
+
+        if(transform->position.x < 0.0f || transform->position.x > 480.0f) {
+            velocity[i].x = -velocity[i].x;
+            transform->position.x = transform->position.x < 0.0f ? 0.0f : 480.0f;
+        }
+        if(transform->position.y < 0.0f || transform->position.y > 272.0f) {
+            velocity[i].y = -velocity[i].y;
+            transform->position.y = transform->position.y < 0.0f ? 0.0f : 272.0f;
+        }
+
+        if(spin)
+            transform->rotation += 180.0f * dt;
+
+        sprites[i]->color.color = tint ? 0xFF4080FF : 0xFFFFFFFF;
+    }
+}
+
+int main(int argc, char** argv) {
+    if(Stress_Init("stress-sprites") < 0)
+        return 1;
+
+    QGTexture_t texture = create_texture();
+    if(texture == NULL)
+        return 1;
+
+    for(usize i = 0; i < SPRITE_COUNT; i++) {
+        sprites[i] = QuickGame_Sprite_Create_Alt(random_range(0, 480), random_range(0, 272), 8, 8, texture);
+        if(sprites[i] == NULL)
+            return 1;
+
+        velocity[i].x = random_range(-80, 80);
+        velocity[i].y = random_range(-80, 80);
+    }
+
+    i32 update_section = QuickGame_Profile_Section("update");
+    i32 draw_section = QuickGame_Profile_Section("draw");
+
+    do {
+        QuickGame_Input_Update();
+
+        QuickGame_Profile_Begin(update_section);
+        update(STRESS_DT);
+        QuickGame_Profile_End(update_section);
+
+        QuickGame_Graphics_Start_Frame();
+        QuickGame_Graphics_Clear();
+
+        QuickGame_Profile_Begin(draw_section);
+        for(usize i = 0; i < SPRITE_COUNT; i++)
+            QuickGame_Sprite_Draw(sprites[i]);
+        QuickGame_Profile_End(draw_section);
+
+        QuickGame_Graphics_End_Frame(true);
+    } while(Stress_Frame());
+
+    for(usize i = 0; i < SPRITE_COUNT; i++)
+        QuickGame_Sprite_Destroy(&sprites[i]);
+    QuickGame_Texture_Destroy(&texture);
+
+    Stress_Finish();
+    return 0;
+}
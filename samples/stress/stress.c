@@ -0,0 +1,71 @@
+#include "stress.h"
+#include <stdio.h>
+
+typedef struct {
+    u32 frames;
+    u32 buttons;
+    u8 lx, ly;
+} StressSegment;
+
+// Scroll around, hold buttons that change what the scenarios do, sweep the stick
+static const StressSegment segments[] = {
+    { 120, PSP_CTRL_RIGHT, 128, 128 },
+    { 120, PSP_CTRL_DOWN, 128, 128 },
+    { 90, PSP_CTRL_RIGHT | PSP_CTRL_CROSS, 128, 128 },
+    { 60, 0, 255, 128 },
+    { 120, PSP_CTRL_LEFT, 128, 128 },
+    { 60, PSP_CTRL_CIRCLE, 128, 0 },
+    { 120, PSP_CTRL_UP, 128, 128 },
+    { 60, PSP_CTRL_CROSS, 0, 255 },
+    { 50, 0, 128, 128 },
+};
+
+static QGInputFrame track[STRESS_FRAMES];
+static const char* scenario_name = NULL;
+
+static void build_track() {
+    usize segment_count = sizeof(segments) / sizeof(segments[0]);
+    usize segment = 0;
+    u32 left = segments[0].frames;
+
+    for(usize i = 0; i < STRESS_FRAMES; i++) {
+        if(left == 0) {
+            segment = (segment + 1) % segment_count;
+            left = segments[segment].frames;
+        }
+
+        track[i].buttons = segments[segment].buttons;
+        track[i].lx = segments[segment].lx;
+        track[i].ly = segments[segment].ly;
+        left--;
+    }
+}
+
+i32 Stress_Init(const char* scenario) {
+    if(QuickGame_Init() < 0)
+        return -1;
+
+    QuickGame_Graphics_Set2D();
+
+    build_track();
+    QuickGame_Input_Replay(track, STRESS_FRAMES, false);
+
+    scenario_name = scenario;
+    return QuickGame_Profile_Start(scenario, STRESS_FRAMES);
+}
+
+bool Stress_Frame() {
+    bool done = QuickGame_Profile_Frame();
+    return QuickGame_Running() && !done;
+}
+
+void Stress_Finish() {
+    char filename[64];
+    snprintf(filename, sizeof(filename), "%s.json", scenario_name);
+
+    QuickGame_Profile_Report(NULL);
+    if(QuickGame_Profile_Report(filename) < 0)
+        printf("Could not write %s\n", filename);
+
+    QuickGame_Terminate();
+}
@@ -0,0 +1,40 @@
+/**
+ * @file stress.h
+ * @brief Shared scenario of the stress samples: a fixed input replay, a fixed timestep and a profiled run
+ */
+
+#ifndef _STRESS_H_
+#define _STRESS_H_
+
+#include <QuickGame.h>
+#include <pspctrl.h>
+#include <stddef.h>
+
+// Frames recorded per run, 30 seconds at 60 FPS
+#define STRESS_FRAMES 1800
+
+// Every scenario steps the same fixed amount per frame, so a run does the same work however fast it goes
+#define STRESS_DT (1.0f / 60.0f)
+
+/**
+ * @brief Initializes the engine, starts the input replay and the profiled run
+ *
+ * @param scenario Name of the run -- a string literal
+ * @return i32 < 0 on failure
+ */
+i32 Stress_Init(const char* scenario);
+
+/**
+ * @brief Ends a frame of the run
+ *
+ * @return true The scenario should keep running
+ */
+bool Stress_Frame();
+
+/**
+ * @brief Prints the report, writes it to <scenario>.json and terminates the engine
+ *
+ */
+void Stress_Finish();
+
+#endif
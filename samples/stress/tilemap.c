@@ -0,0 +1,162 @@
+#include "stress.h"
+#include <pspiofilemgr.h>
+
+#define MAP_SIZE 256
+#define CHUNK_SIZE 32
+#define TILE_SIZE 16
+#define WORLD_FILE "stress.qgw"
+
+// Chunk slots for the view and the chunks streamed in around it
+#define WORLD_BUDGET (4 * 1024 * 1024)
+
+/**
+ * Generates the map into a world file, so the run streams it like a shipped level
+ */
+static i32 write_world() {
+    SceUID fd = sceIoOpen(WORLD_FILE, PSP_O_WRONLY | PSP_O_CREAT | PSP_O_TRUNC, 0777);
+    if(fd < 0)
+        return -1;
+
+    u32 chunks = MAP_SIZE / CHUNK_SIZE;
+    QGWorldHeader header = {
+        .magic = QG_WORLD_MAGIC,
+        .version = QG_WORLD_VERSION,
+        .chunk_size = CHUNK_SIZE,
+        .width = MAP_SIZE,
+        .height = MAP_SIZE,
+        .tile_width = TILE_SIZE,
+        .tile_height = TILE_SIZE,
+        .chunk_columns = chunks,
+        .chunk_rows = chunks,
+    };
+
+    u32 cell_bytes = CHUNK_SIZE * CHUNK_SIZE * sizeof(u16);
+    u32 data_offset = sizeof(QGWorldHeader) + chunks * chunks * 2 * sizeof(u32);
+
+    i32 result = sceIoWrite(fd, &header, sizeof(header)) == sizeof(header) ? 0 : -1;
+    for(u32 i = 0; i < chunks * chunks && result == 0; i++) {
+        u32 entry[2] = { data_offset + i * cell_bytes, cell_bytes };
+        if(sceIoWrite(fd, entry, sizeof(entry)) != sizeof(entry))
+            result = -1;
+    }
+
+    static u16 cells[CHUNK_SIZE * CHUNK_SIZE];
+    for(u32 i = 0; i < chunks * chunks && result == 0; i++) {
+        u32 cx = i % chunks, cy = i / chunks;
+
+        // Bands of terrain with scattered gaps, every chunk looks different
+        for(u32 y = 0; y < CHUNK_SIZE; y++) {
+            for(u32 x = 0; x < CHUNK_SIZE; x++) {
+                u32 wx = cx * CHUNK_SIZE + x, wy = cy * CHUNK_SIZE + y;
+                u32 hash = (wx * 73856093u) ^ (wy * 19349663u);
+                cells[y * CHUNK_SIZE + x] = hash % 13 == 0 ? QG_WORLD_CELL_EMPTY : ((wx / 8 + wy / 8 + hash % 3) % 64);
+            }
+        }
+
+        if(sceIoWrite(fd, cells, cell_bytes) != (int)cell_bytes)
+            result = -1;
+    }
+
+    sceIoClose(fd);
+    return result;
+}
+
+static QGTexture_t create_texture() {
+    QGTexture_t texture = QuickGame_Texture_Create_Dynamic(128, 128, false);
+    if(texture == NULL)
+        return NULL;
+
+    // 8x8 tiles of 16 pixels, each a different shade with a border
+    u32* texels = QuickGame_Texture_Staging(texture);
+    for(u32 y = 0; y < 128; y++) {
+        for(u32 x = 0; x < 128; x++) {
+            u32 tile = (y / 16) * 8 + x / 16;
+            bool border = x % 16 == 0 || y % 16 == 0;
+            u8 shade = border ? 32 : 64 + tile * 3;
+            texels[y * 128 + x] = 0xFF000000 | (shade << 16) | ((255 - shade) << 8) | (tile * 4);
+        }
+    }
+    QuickGame_Texture_Update_Rect(texture, 0, 0, 128, 128);
+
+    return texture;
+}
+
+static void update(QGCamera2D* camera, f32 dt) {
+    // Drift across the map and let the replay steer, faster while cross is held
+    f32 speed = QuickGame_Button_Held(PSP_CTRL_CROSS) ? 480.0f : 240.0f;
+    QGVector2 direction = { .x = 0.5f + QuickGame_Analog_X(), .y = 0.25f - QuickGame_Analog_Y() };
+
+    if(QuickGame_Button_Held(PSP_CTRL_LEFT))
+        direction.x -= 1.0f;
+    if(QuickGame_Button_Held(PSP_CTRL_RIGHT))
+        direction.x += 1.0f;
+    if(QuickGame_Button_Held(PSP_CTRL_UP))
+        direction.y += 1.0f;
+    if(QuickGame_Button_Held(PSP_CTRL_DOWN))
+        direction.y -= 1.0f;
+
+    camera->position.x += direction.x * speed * dt;
+    camera->position.y += direction.y * speed * dt;
+
+    // Wrap so the camera keeps crossing chunk boundaries for the whole run
+    const f32 extent = MAP_SIZE * TILE_SIZE;
+    if(camera->position.x < 0.0f)
+        camera->position.x += extent;
+    if(camera->position.x >= extent)
+        camera->position.x -= extent;
+    if(camera->position.y < 0.0f)
+        camera->position.y += extent;
+    if(camera->position.y >= extent)
+        camera->position.y -= extent;
+}
+
+int main(int argc, char** argv) {
+    if(Stress_Init("stress-tilemap") < 0)
+        return 1;
+
+    QGTexture_t texture = create_texture();
+    QGAtlas_t atlas = QuickGame_Atlas_Create_Alt(texture, (QGTextureAtlas){ .x = 8, .y = 8 });
+    if(atlas == NULL || write_world() < 0)
+        return 1;
+
+    QGWorld_t world = QuickGame_World_Load(WORLD_FILE, atlas, WORLD_BUDGET);
+    if(world == NULL)
+        return 1;
+
+    QGCamera2D camera = { .position = { .x = 0.0f, .y = 0.0f }, .rotation = 0.0f };
+    QuickGame_Graphics_Set_Camera(&camera);
+
+    i32 update_section = QuickGame_Profile_Section("update");
+    i32 stream_section = QuickGame_Profile_Section("stream");
+    i32 draw_section = QuickGame_Profile_Section("draw");
+
+    do {
+        QuickGame_Input_Update();
+
+        QuickGame_Profile_Begin(update_section);
+        update(&camera, STRESS_DT);
+        QuickGame_Profile_End(update_section);
+
+        // Requests chunks from the loader and builds the ones that arrived
+        QuickGame_Profile_Begin(stream_section);
+        QuickGame_World_Update(world, &camera);
+        QuickGame_Profile_End(stream_section);
+
+        QuickGame_Graphics_Start_Frame();
+        QuickGame_Graphics_Clear();
+
+        QuickGame_Profile_Begin(draw_section);
+        QuickGame_World_Draw(world);
+        QuickGame_Profile_End(draw_section);
+
+        QuickGame_Graphics_End_Frame(true);
+    } while(Stress_Frame());
+
+    QuickGame_Graphics_Unset_Camera();
+    QuickGame_World_Destroy(&world);
+    QuickGame_Atlas_Destroy(&atlas);
+    QuickGame_Texture_Destroy(&texture);
+
+    Stress_Finish();
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include <QuickGame.h>
+#include <Atlas.h>
+#include <stddef.h>
+
+/**
+ * @brief Creates an atlas and precomputes the texture coordinates of every tile
+ *
+ * @param texture Texture the atlas refers to -- not owned by the atlas
+ * @param info Layout of the atlas (columns, rows, margin and padding in pixels)
+ * @return QGAtlas_t Atlas or NULL on failure
+ */
+QGAtlas_t QuickGame_Atlas_Create(QGTexture_t texture, QGAtlasInfo info) {
+    if(texture == NULL || info.columns == 0 || info.rows == 0)
+        return NULL;
+
+    f32 usable_w = (f32)texture->width - 2.0f * info.margin - (f32)(info.columns - 1) * info.padding;
+    f32 usable_h = (f32)texture->height - 2.0f * info.margin - (f32)(info.rows - 1) * info.padding;
+    if(usable_w <= 0.0f || usable_h <= 0.0f)
+        return NULL;
+
+    QGAtlas_t atlas = (QGAtlas_t)QuickGame_Allocate(sizeof(QGAtlas));
+    if(atlas == NULL)
+        return NULL;
+
+    atlas->info = info;
+    atlas->texture = texture;
+    atlas->count = info.columns * info.rows;
+    atlas->tile_width = usable_w / (f32)info.columns;
+    atlas->tile_height = usable_h / (f32)info.rows;
+
+    atlas->uvs = (f32*)QuickGame_Allocate(sizeof(f32) * QG_ATLAS_UV_STRIDE * atlas->count);
+    if(atlas->uvs == NULL) {
+        QuickGame_Destroy(atlas);
+        return NULL;
+    }
+
+    // Normalize against the padded size so no ratio needs to be applied later
+    f32 inv_w = 1.0f / (f32)texture->pWidth;
+    f32 inv_h = 1.0f / (f32)texture->pHeight;
+
+    f32* uv = atlas->uvs;
+    for(usize row = 0; row < info.rows; row++)
+    for(usize col = 0; col < info.columns; col++) {
+        f32 x = (f32)info.margin + (f32)col * (atlas->tile_width + (f32)info.padding);
+        f32 y = (f32)info.margin + (f32)row * (atlas->tile_height + (f32)info.padding);
+
+        uv[0] = x * inv_w;
+        uv[1] = (y + atlas->tile_height) * inv_h;
+        uv[2] = (x + atlas->tile_width) * inv_w;
+        uv[3] = y * inv_h;
+        uv += QG_ATLAS_UV_STRIDE;
+    }
+
+    return atlas;
+}
+
+/**
+ * @brief Creates an atlas from a legacy texture atlas size
+ *
+ * @param texture Texture the atlas refers to -- not owned by the atlas
+ * @param atlas Number of tiles across and down
+ * @return QGAtlas_t Atlas or NULL on failure
+ */
+QGAtlas_t QuickGame_Atlas_Create_Alt(QGTexture_t texture, QGTextureAtlas atlas) {
+    QGAtlasInfo info = {
+        .columns = (u32)atlas.x,
+        .rows = (u32)atlas.y,
+        .margin = 0,
+        .padding = 0
+    };
+
+    return QuickGame_Atlas_Create(texture, info);
+}
+
+/**
+ * @brief Destroys an atlas
+ *
+ * @param atlas Atlas to destroy -- also gets set to null.
+ */
+void QuickGame_Atlas_Destroy(QGAtlas_t* atlas) {
+    if(atlas == NULL || (*atlas) == NULL)
+        return;
+
+    QuickGame_Destroy((*atlas)->uvs);
+    QuickGame_Destroy(*atlas);
+    *atlas = NULL;
+}
+
+/**
+ * @brief Gets the precomputed texture coordinates of a tile
+ *
+ * @param atlas Atlas to use
+ * @param idx Index of the tile, wraps around when out of range
+ * @return const f32* QG_ATLAS_UV_STRIDE floats (u0, v0, u1, v1) or NULL on failure
+ */
+const f32* QuickGame_Atlas_UV(const QGAtlas_t atlas, usize idx) {
+    if(atlas == NULL)
+        return NULL;
+
+    if(idx >= atlas->count)
+        idx %= atlas->count;
+
+    return &atlas->uvs[idx * QG_ATLAS_UV_STRIDE];
+}
+
+/**
+ * @brief Gets quad texture coordinates of a tile in the same layout as QuickGame_Atlas_Index_Coords
+ *
+ * @param atlas Atlas to use
+ * @param buf Buffer of 8 floats to fill with the coordinates
+ * @param idx Index of the tile
+ */
+void QuickGame_Atlas_Get_Coords(const QGAtlas_t atlas, f32* buf, const usize idx) {
+    const f32* uv = QuickGame_Atlas_UV(atlas, idx);
+    if(buf == NULL || uv == NULL)
+        return;
+
+    buf[0] = uv[0];
+    buf[1] = uv[1];
+
+    buf[2] = uv[2];
+    buf[3] = uv[1];
+
+    buf[4] = uv[2];
+    buf[5] = uv[3];
+
+    buf[6] = uv[0];
+    buf[7] = uv[3];
+}
@@ -3,16 +3,30 @@
 #include "osl_sound/oslib.h"
 #include "osl_sound/audio.h"
 
+static bool audio_initialized = false;
+
 void QuickGame_Audio_Init() {
+    if(audio_initialized)
+        return;
+
+    u64 start = QuickGame_Boot_Time();
     VirtualFileInit();
     oslInitAudio();
+    audio_initialized = true;
+    QuickGame_Boot_Phase("audio", start);
 }
 
 void QuickGame_Audio_Terminate() {
+    if(!audio_initialized)
+        return;
+
     oslDeinitAudio();
+    audio_initialized = false;
 }
 
 QGAudioClip_t QuickGame_Audio_Load(const char* filename, bool looping, bool streaming){
+    QuickGame_Audio_Init();
+
     QGAudioClip_t clip = QuickGame_Allocate(sizeof(QGAudioClip));
     if(clip == NULL)
         return NULL;
@@ -20,7 +34,8 @@ QGAudioClip_t QuickGame_Audio_Load(const char* filename, bool looping, bool stre
     clip->data = oslLoadSoundFile(filename, streaming ? OSL_FMT_STREAM : OSL_FMT_NONE);
     
     if(clip->data == NULL){
-        QuickGame_Destroy(&clip);
+        QuickGame_Log(QG_LOG_ERROR, QG_LOG_ASSET, "Could not load audio %s", filename);
+        QuickGame_Destroy(clip);
         return NULL;
     }
 
@@ -28,6 +43,29 @@ QGAudioClip_t QuickGame_Audio_Load(const char* filename, bool looping, bool stre
     return clip;
 }
 
+QGAudioClip_t QuickGame_Audio_Load_Memory(const char* filename, const u8* data, usize size, bool looping){
+    if(filename == NULL || data == NULL || size == 0)
+        return NULL;
+
+    QuickGame_Audio_Init();
+
+    // OSLib looks the name up in its RAM file list before the disk, the sound copies the samples
+    OSL_VIRTUALFILENAME file = {
+        .name = filename,
+        .data = (void*)data,
+        .size = size,
+        .type = &VF_MEMORY
+    };
+
+    if(!oslAddVirtualFileList(&file, 1))
+        return NULL;
+
+    QGAudioClip_t clip = QuickGame_Audio_Load(filename, looping, false);
+    oslRemoveVirtualFileList(&file, 1);
+
+    return clip;
+}
+
 void QuickGame_Audio_Destroy(QGAudioClip_t* clip){
     if(clip == NULL || (*clip) == NULL)
         return;
@@ -0,0 +1,110 @@
+#include <QuickGame.h>
+#include <Boot.h>
+#include <stddef.h>
+#include <psprtc.h>
+
+static u64 boot_tick = 0;
+static u64 tick_resolution = 0;
+static u64 first_frame = 0;
+static QGSplashCallback splash_callback = NULL;
+
+static QGBootPhase phases[QG_BOOT_PHASES_MAX];
+static usize phase_count = 0;
+
+/**
+ * @brief Starts the boot clock, does nothing if it is already running.
+ * QuickGame_Init() starts it, call this first thing in main() to include earlier work.
+ *
+ */
+void QuickGame_Boot_Start() {
+    if(tick_resolution != 0)
+        return;
+
+    tick_resolution = sceRtcGetTickResolution();
+    sceRtcGetCurrentTick(&boot_tick);
+}
+
+/**
+ * @brief Gets the time since the boot clock started, starting it if needed
+ *
+ * @return u64 Microseconds
+ */
+u64 QuickGame_Boot_Time() {
+    QuickGame_Boot_Start();
+
+    u64 current;
+    sceRtcGetCurrentTick(&current);
+
+    return (current - boot_tick) * 1000000ULL / tick_resolution;
+}
+
+/**
+ * @brief Records a phase that ran from start until now. Phases past QG_BOOT_PHASES_MAX are dropped.
+ *
+ * @param name Name of the phase -- must outlive the boot stats, a string literal
+ * @param start Start of the phase from QuickGame_Boot_Time()
+ */
+void QuickGame_Boot_Phase(const char* name, u64 start) {
+    u64 now = QuickGame_Boot_Time();
+    if(phase_count >= QG_BOOT_PHASES_MAX)
+        return;
+
+    phases[phase_count].name = name;
+    phases[phase_count].start = start;
+    phases[phase_count].duration = now - start;
+    phase_count++;
+}
+
+/**
+ * @brief Gets the recorded phases in the order they finished
+ *
+ * @param count Number of phases
+ * @return const QGBootPhase* Phases
+ */
+const QGBootPhase* QuickGame_Boot_Phases(usize* count) {
+    if(count != NULL)
+        *count = phase_count;
+
+    return phases;
+}
+
+/**
+ * @brief Gets the time to the first presented frame
+ *
+ * @return u64 Microseconds or 0 if no frame was presented during boot
+ */
+u64 QuickGame_Boot_First_Frame() {
+    return first_frame;
+}
+
+/**
+ * @brief Sets the function drawing the splash frame, must be called before QuickGame_Init()
+ *
+ * @param splash Splash callback or NULL to present a cleared frame
+ */
+void QuickGame_Boot_Set_Splash(QGSplashCallback splash) {
+    splash_callback = splash;
+}
+
+/**
+ * @brief Presents the splash frame and records it as the first frame. Called by QuickGame_Init()
+ * right after graphics, before the other subsystems.
+ *
+ */
+void QuickGame_Boot_Splash() {
+    u64 start = QuickGame_Boot_Time();
+
+    QuickGame_Graphics_Start_Frame();
+    QuickGame_Graphics_Clear();
+    QuickGame_Graphics_Set2D();
+
+    if(splash_callback != NULL)
+        splash_callback();
+
+    // No vsync, the frame goes out as soon as the GE is done
+    QuickGame_Graphics_End_Frame(false);
+
+    QuickGame_Boot_Phase("splash", start);
+    if(first_frame == 0)
+        first_frame = QuickGame_Boot_Time();
+}
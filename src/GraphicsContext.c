@@ -2,16 +2,44 @@
 #include <QuickGame.h>
 #define GUGL_IMPLEMENTATION
 #include <gu2gl.h>
+#include <math.h>
+#include <string.h>
+#include <pspkernel.h>
 
 static u32 __attribute__((aligned(16))) list[262144];
 static QGColor clearColor;
 static QGCamera2D* cam_ptr;
 static bool dialogMode;
 static bool wireframeMode;
-
-void QuickGame_Graphics_Init() {
-    guglInit(list);
-    
+static bool overdrawMode;
+static bool coverageMode;
+static QGCoverageStats coverage_stats;
+static QGCoverageStats last_coverage_stats;
+
+// Smallest 32-bit texture the GE takes, sampled with replace so only the increment is written
+static u32 __attribute__((aligned(16))) overdraw_texels[8 * 8];
+static QGVector2 view_min;
+static QGVector2 view_max;
+static QGCullStats cull_stats;
+static QGCullStats last_cull_stats;
+
+static QGDisplayConfig display;
+static bool custom_display;
+static void* framebuffers[3];
+static i32 draw_buffer;
+static i32 shown_buffer;
+static i32 queued_buffer;
+static u32 queued_vcount;
+static u32 swap_vcount;
+
+static const ScePspIMatrix4 dither_matrix = {
+    {-4, 0, -3, 1},
+    {2, -2, 3, -1},
+    {-3, 1, -4, 0},
+    {3, -1, 2, -2}
+};
+
+static void setup_state() {
     QuickGame_Graphics_Start_Frame();
     glDisable(GL_DEPTH_TEST);
     glBlendFunc(GU_ADD, GU_SRC_ALPHA, GU_ONE_MINUS_SRC_ALPHA, 0, 0);
@@ -22,6 +50,67 @@ void QuickGame_Graphics_Init() {
     dialogMode = false;
     cam_ptr = NULL;
     wireframeMode = false;
+    overdrawMode = false;
+    coverageMode = false;
+}
+
+void QuickGame_Graphics_Init() {
+    custom_display = false;
+    guglInit(list);
+
+    setup_state();
+}
+
+i32 QuickGame_Graphics_Init_Alt(const QGDisplayConfig* config) {
+    if(!config || config->format > QG_PSM_8888 || config->buffer_count < 2 || config->buffer_count > 3 || config->vsync > QG_VSYNC_ADAPTIVE)
+        return -1;
+
+    display = *config;
+    custom_display = true;
+
+    // Same allocator as gu2gl, so VRAM textures are placed after the buffers
+    for(usize i = 0; i < display.buffer_count; i++)
+        framebuffers[i] = getStaticVramBuffer(512, 272, display.format);
+    void* depth = getStaticVramBuffer(512, 272, GU_PSM_4444);
+
+    draw_buffer = 0;
+    shown_buffer = 1;
+    queued_buffer = -1;
+
+    sceGuInit();
+    sceGuStart(GU_DIRECT, list);
+    sceGuDrawBuffer(display.format, framebuffers[0], 512);
+    sceGuDispBuffer(480, 272, framebuffers[1], 512);
+    sceGuDepthBuffer(depth, 512);
+    sceGuOffset(2048 - (480 / 2), 2048 - (272 / 2));
+    sceGuViewport(2048, 2048, 480, 272);
+    sceGuDepthRange(65535, 0);
+    sceGuScissor(0, 0, 480, 272);
+    sceGuEnable(GU_SCISSOR_TEST);
+    sceGuDepthFunc(GU_GEQUAL);
+    sceGuEnable(GU_DEPTH_TEST);
+    sceGuFrontFace(GU_CW);
+    sceGuShadeModel(GU_SMOOTH);
+    sceGuEnable(GU_CULL_FACE);
+    sceGuEnable(GU_TEXTURE_2D);
+    sceGuEnable(GU_CLIP_PLANES);
+
+    // Hides banding from 16-bit framebuffers
+    if(display.format != QG_PSM_8888) {
+        sceGuSetDither(&dither_matrix);
+        sceGuEnable(GU_DITHER);
+    }
+
+    sceGuFinish();
+    sceGuSync(0, 0);
+
+    guSwapBuffersBehaviour(PSP_DISPLAY_SETBUF_IMMEDIATE);
+    sceDisplayWaitVblankStart();
+    sceGuDisplay(GU_TRUE);
+    swap_vcount = sceDisplayGetVcount();
+
+    setup_state();
+    return 0;
 }
 
 void QuickGame_Graphics_Terminate() {
@@ -36,9 +125,77 @@ void QuickGame_Graphics_Set_Wireframe_Mode(bool mode) {
     wireframeMode = mode;
 }
 
+void QuickGame_Graphics_Set_Overdraw_Mode(bool mode) {
+    if(mode && overdraw_texels[0] != QG_OVERDRAW_INCREMENT) {
+        for(usize i = 0; i < 8 * 8; i++)
+            overdraw_texels[i] = QG_OVERDRAW_INCREMENT;
+
+        sceKernelDcacheWritebackRange(overdraw_texels, sizeof(overdraw_texels));
+    }
+
+    overdrawMode = mode;
+}
+
+void QuickGame_Graphics_Set_Coverage_Estimate(bool mode) {
+    coverageMode = mode;
+}
+
+bool QuickGame_Graphics_Coverage_Enabled() {
+    return coverageMode;
+}
+
+static void update_view_rect() {
+    if(!cam_ptr) {
+        view_min.x = 0.0f;
+        view_min.y = 0.0f;
+        view_max.x = 480.0f;
+        view_max.y = 272.0f;
+        return;
+    }
+
+    // The view matrix maps world w to screen s = R(rotation) * w - position, so w = R(-rotation) * (s + position)
+    f32 c = cosf(cam_ptr->rotation);
+    f32 sn = sinf(cam_ptr->rotation);
+
+    view_min.x = view_min.y = INFINITY;
+    view_max.x = view_max.y = -INFINITY;
+
+    for(int i = 0; i < 4; i++) {
+        f32 x = ((i & 1) ? 480.0f : 0.0f) + cam_ptr->position.x;
+        f32 y = ((i & 2) ? 272.0f : 0.0f) + cam_ptr->position.y;
+
+        f32 wx = c * x + sn * y;
+        f32 wy = -sn * x + c * y;
+
+        if(wx < view_min.x) view_min.x = wx;
+        if(wy < view_min.y) view_min.y = wy;
+        if(wx > view_max.x) view_max.x = wx;
+        if(wy > view_max.y) view_max.y = wy;
+    }
+}
+
 void QuickGame_Graphics_Start_Frame() {
     guglStartFrame(list, dialogMode);
 
+    // Triple buffering picks its own draw target, sceGuSwapBuffers only knows two
+    if(custom_display && display.buffer_count == 3)
+        sceGuDrawBufferList(display.format, framebuffers[draw_buffer], 512);
+
+    // The previous frame is done with the front meshes, finished builds can take their place
+    QuickGame_Tilemap_Update_Builds();
+
+    last_cull_stats = cull_stats;
+    cull_stats.drawn = 0;
+    cull_stats.culled = 0;
+
+    last_coverage_stats = coverage_stats;
+    last_coverage_stats.overdraw = 0.0f;
+    for(usize i = 0; i < QG_COVERAGE_CATEGORIES; i++)
+        last_coverage_stats.overdraw += coverage_stats.pixels[i];
+    last_coverage_stats.overdraw /= 480.0f * 272.0f;
+    memset(&coverage_stats, 0, sizeof(QGCoverageStats));
+    update_view_rect();
+
     if(cam_ptr) {
         // Set to location
         glMatrixMode(GL_VIEW);
@@ -58,8 +215,53 @@ void QuickGame_Graphics_Start_Frame() {
     }
 }
 
+static void present_queued() {
+    if(queued_buffer >= 0) {
+        // No vblank since the last frame was queued means we are two frames ahead
+        if(sceDisplayGetVcount() == queued_vcount)
+            sceDisplayWaitVblankStart();
+
+        shown_buffer = queued_buffer;
+    }
+
+    sceDisplaySetFrameBuf((u8*)sceGeEdramGetAddr() + (uintptr_t)framebuffers[draw_buffer], 512, display.format, PSP_DISPLAY_SETBUF_NEXTFRAME);
+    queued_buffer = draw_buffer;
+    queued_vcount = sceDisplayGetVcount();
+
+    // Buffers are 0, 1 and 2, the one neither shown nor queued is free
+    draw_buffer = 3 - shown_buffer - queued_buffer;
+}
+
+static void end_frame(bool vsync) {
+    if(!custom_display) {
+        guglSwapBuffers(vsync, dialogMode);
+        return;
+    }
+
+    if(!dialogMode) {
+        sceGuFinish();
+        sceGuSync(0, 0);
+    }
+
+    if(display.buffer_count == 3) {
+        present_queued();
+        return;
+    }
+
+    u8 mode = vsync ? display.vsync : QG_VSYNC_OFF;
+
+    // Adaptive only waits when the frame finished before the next vblank
+    if(mode == QG_VSYNC_ON || (mode == QG_VSYNC_ADAPTIVE && sceDisplayGetVcount() == swap_vcount))
+        sceDisplayWaitVblankStart();
+
+    sceGuSwapBuffers();
+    swap_vcount = sceDisplayGetVcount();
+}
+
 void QuickGame_Graphics_End_Frame(bool vsync) {
-    guglSwapBuffers(vsync, dialogMode);
+    QuickGame_Profile_Begin(QG_PROFILE_PRESENT);
+    end_frame(vsync);
+    QuickGame_Profile_End(QG_PROFILE_PRESENT);
 }
 
 void QuickGame_Graphics_Set_Clear_Color(QGColor color) {
@@ -109,7 +311,7 @@ QGVMesh_t QuickGame_Graphics_Create_Mesh(const u8 type, const usize vcount, cons
 }
 
 void QuickGame_Graphics_Destroy_Mesh(QGVMesh_t* mesh) {
-    if(!mesh)
+    if(!mesh || !*mesh)
         return;
     
     QuickGame_Destroy((*mesh)->data);
@@ -118,34 +320,71 @@ void QuickGame_Graphics_Destroy_Mesh(QGVMesh_t* mesh) {
     *mesh = NULL;
 }
 
+static void draw_elements(QGVMesh_t mesh, u32 format, usize first, usize count) {
+    if(format & QG_VFMT_TEXTURE_32BITF)
+        glEnable(GL_TEXTURE_2D);
+    else
+        glDisable(GL_TEXTURE_2D);
+
+    int mode = GL_TRIANGLES;
+    if(wireframeMode)
+        mode = GL_LINE_STRIP;
+
+    if(overdrawMode) {
+        // Texture color replaces the vertex colors whatever the format, the fixed factors make the blend src + dst
+        glEnable(GL_TEXTURE_2D);
+        glTexMode(GU_PSM_8888, 0, 0, 0);
+        glTexFunc(GU_TFX_REPLACE, GU_TCC_RGB);
+        glTexImage(0, 8, 8, 8, overdraw_texels);
+        glEnable(GL_BLEND);
+        glBlendFunc(GU_ADD, GU_FIX, GU_FIX, 0xFFFFFFFF, 0xFFFFFFFF);
+    }
+
+    glDrawElements(mode, format | GL_TRANSFORM_3D, count, mesh->indices + first, mesh->data);
+    cull_stats.drawn++;
+
+    if(overdrawMode) {
+        glTexFunc(GL_TFX_MODULATE, GL_TCC_RGBA);
+        glBlendFunc(GU_ADD, GU_SRC_ALPHA, GU_ONE_MINUS_SRC_ALPHA, 0, 0);
+    }
+}
 
 void QuickGame_Graphics_Draw_Mesh(QGVMesh_t mesh) {
-    if(!mesh || !mesh->data || !mesh->indices)
+    if(!mesh)
+        return;
+
+    QuickGame_Graphics_Draw_Mesh_Range(mesh, 0, mesh->count);
+}
+
+void QuickGame_Graphics_Draw_Mesh_Range(QGVMesh_t mesh, usize first, usize count) {
+    if(!mesh || !mesh->data || !mesh->indices || count == 0 || first + count > mesh->count)
         return;
     
-    usize vtype = GL_INDEX_16BIT | GL_VERTEX_32BITF | GL_TRANSFORM_3D;
+    u32 format = QG_VFMT_INDEX_16BIT | QG_VFMT_VERTEX_32BITF;
 
     if(mesh->type == QG_VERTEX_TYPE_TEXTURED){
-        glEnable(GL_TEXTURE_2D);
-        vtype |= GL_TEXTURE_32BITF;
+        format |= QG_VFMT_TEXTURE_32BITF;
     } else if (mesh->type == QG_VERTEX_TYPE_COLORED) {
-        glDisable(GL_TEXTURE_2D);
-        vtype |= GL_COLOR_8888;
+        format |= QG_VFMT_COLOR_8888;
         QuickGame_Texture_Unbind();
     } else if (mesh->type == QG_VERTEX_TYPE_FULL) {
-        glEnable(GL_TEXTURE_2D);
-        vtype |= GL_TEXTURE_32BITF | GL_COLOR_8888;
-    } else if (mesh->type == QG_VERTEX_TYPE_SIMPLE) {
-        glDisable(GL_TEXTURE_2D);  
-    } else {
+        format |= QG_VFMT_TEXTURE_32BITF | QG_VFMT_COLOR_8888;
+    } else if (mesh->type != QG_VERTEX_TYPE_SIMPLE) {
         return;
     }
 
-    int mode = GL_TRIANGLES;
-    if(wireframeMode)
-        mode = GL_LINE_STRIP;
+    draw_elements(mesh, format, first, count);
+}
 
-    glDrawElements(mode, vtype, mesh->count, mesh->indices, mesh->data);
+void QuickGame_Graphics_Draw_Mesh_Format(QGVMesh_t mesh, u32 format) {
+    if(!mesh || !mesh->data || !mesh->indices || mesh->count == 0)
+        return;
+
+    // Without texture coordinates the GE would still sample the last bound texture
+    if(!(format & QG_VFMT_TEXTURE_32BITF))
+        QuickGame_Texture_Unbind();
+
+    draw_elements(mesh, format, 0, mesh->count);
 }
 
 void QuickGame_Graphics_Set2D() {
@@ -167,4 +406,91 @@ void QuickGame_Graphics_Set_Camera(QGCamera2D* camera) {
 
 void QuickGame_Graphics_Unset_Camera() {
     cam_ptr = NULL;
-}
\ No newline at end of file
+}
+
+QGCamera2D* QuickGame_Graphics_Get_Camera() {
+    return cam_ptr;
+}
+
+void QuickGame_Graphics_Get_View_Rect(QGVector2* min, QGVector2* max) {
+    if(min)
+        *min = view_min;
+    if(max)
+        *max = view_max;
+}
+
+bool QuickGame_Graphics_Visible(QGTransform2D transform) {
+    return QuickGame_Graphics_Visible_Extent(transform, (QGVector2){ 0.5f, 0.5f });
+}
+
+bool QuickGame_Graphics_Visible_Extent(QGTransform2D transform, QGVector2 extent) {
+    f32 hx = fabsf(transform.scale.x) * extent.x;
+    f32 hy = fabsf(transform.scale.y) * extent.y;
+
+    // Any rotation stays within the half extents summed, which avoids a sqrt per object
+    if(transform.rotation != 0.0f) {
+        hx += hy;
+        hy = hx;
+    }
+
+    return transform.position.x + hx >= view_min.x && transform.position.x - hx <= view_max.x &&
+           transform.position.y + hy >= view_min.y && transform.position.y - hy <= view_max.y;
+}
+
+bool QuickGame_Graphics_Cull(QGTransform2D transform) {
+    return QuickGame_Graphics_Cull_Extent(transform, (QGVector2){ 0.5f, 0.5f });
+}
+
+bool QuickGame_Graphics_Cull_Extent(QGTransform2D transform, QGVector2 extent) {
+    if(QuickGame_Graphics_Visible_Extent(transform, extent))
+        return false;
+
+    cull_stats.culled++;
+    return true;
+}
+
+QGCullStats QuickGame_Graphics_Get_Cull_Stats() {
+    return last_cull_stats;
+}
+
+void QuickGame_Graphics_Estimate_Coverage(u8 category, QGTransform2D transform) {
+    QuickGame_Graphics_Estimate_Coverage_Extent(category, transform, (QGVector2){ 0.5f, 0.5f });
+}
+
+void QuickGame_Graphics_Estimate_Coverage_Extent(u8 category, QGTransform2D transform, QGVector2 extent) {
+    if(!coverageMode || category >= QG_COVERAGE_CATEGORIES)
+        return;
+
+    f32 sx = fabsf(transform.scale.x);
+    f32 sy = fabsf(transform.scale.y);
+    f32 hx = sx * extent.x;
+    f32 hy = sy * extent.y;
+
+    if(transform.rotation != 0.0f) {
+        f32 r = transform.rotation / 180.0f * GL_PI;
+        f32 c = fabsf(cosf(r));
+        f32 s = fabsf(sinf(r));
+        f32 bx = c * hx + s * hy;
+        hy = s * hx + c * hy;
+        hx = bx;
+    }
+
+    f32 x0 = fmaxf(transform.position.x - hx, view_min.x);
+    f32 x1 = fminf(transform.position.x + hx, view_max.x);
+    f32 y0 = fmaxf(transform.position.y - hy, view_min.y);
+    f32 y1 = fminf(transform.position.y + hy, view_max.y);
+    if(x1 <= x0 || y1 <= y0)
+        return;
+
+    // Shape area scaled by the visible part of its bounding box
+    coverage_stats.pixels[category] += sx * sy * ((x1 - x0) * (y1 - y0)) / (4.0f * hx * hy);
+}
+
+void QuickGame_Graphics_Add_Coverage(u8 category, f32 pixels) {
+    if(coverageMode && category < QG_COVERAGE_CATEGORIES)
+        coverage_stats.pixels[category] += pixels;
+}
+
+QGCoverageStats QuickGame_Graphics_Get_Coverage_Stats() {
+    return last_coverage_stats;
+}
@@ -0,0 +1,319 @@
+#include <QuickGame.h>
+#include <Handle.h>
+#include <stddef.h>
+#include <string.h>
+
+#define INDEX_MASK ((1u << QG_HANDLE_INDEX_BITS) - 1)
+#define GENERATION_MASK ((1u << QG_HANDLE_GENERATION_BITS) - 1)
+#define MAX_SLOTS (1u << QG_HANDLE_INDEX_BITS)
+#define NO_SLOT 0xFFFFFFFF
+#define INITIAL_CAPACITY 64
+#define MAX_REFS 0xFFFF
+
+/**
+ * Resource pointers are packed in dense, slots map a handle index to its dense entry.
+ * Free slots are chained through slot_dense.
+ */
+typedef struct {
+    anyopaque** dense;
+    u32* dense_slot;
+    u32* slot_dense;
+    u16* generation;
+    u16* refs;
+    usize count;
+    usize slot_count;
+    usize capacity;
+    u32 free_head;
+} QGHandleTable;
+
+static QGHandleTable tables[QG_HANDLE_TYPES];
+
+static inline QGHandle make_handle(u8 type, u32 generation, u32 slot) {
+    return ((u32)type << QG_HANDLE_TYPE_SHIFT) | (generation << QG_HANDLE_INDEX_BITS) | slot;
+}
+
+// Table and slot of a live handle, NULL if stale
+static QGHandleTable* lookup(QGHandle handle, u32* slot) {
+    QGHandleTable* table = &tables[handle >> QG_HANDLE_TYPE_SHIFT];
+    u32 idx = handle & INDEX_MASK;
+    u32 generation = (handle >> QG_HANDLE_INDEX_BITS) & GENERATION_MASK;
+
+    if(idx >= table->slot_count || table->generation[idx] != generation || table->slot_dense[idx] >= table->count)
+        return NULL;
+
+    // A free slot keeps the generation its next handle gets, so check the slot is owned
+    if(table->dense_slot[table->slot_dense[idx]] != idx)
+        return NULL;
+
+    *slot = idx;
+    return table;
+}
+
+static i32 grow(QGHandleTable* table) {
+    usize capacity = table->capacity == 0 ? INITIAL_CAPACITY : table->capacity * 2;
+    if(capacity > MAX_SLOTS)
+        capacity = MAX_SLOTS;
+    if(capacity == table->capacity)
+        return -1;
+
+    anyopaque** dense = QuickGame_Allocate(sizeof(anyopaque*) * capacity);
+    u32* dense_slot = QuickGame_Allocate(sizeof(u32) * capacity);
+    u32* slot_dense = QuickGame_Allocate(sizeof(u32) * capacity);
+    u16* generation = QuickGame_Allocate(sizeof(u16) * capacity);
+    u16* refs = QuickGame_Allocate(sizeof(u16) * capacity);
+
+    if(!dense || !dense_slot || !slot_dense || !generation || !refs) {
+        QuickGame_Destroy(dense);
+        QuickGame_Destroy(dense_slot);
+        QuickGame_Destroy(slot_dense);
+        QuickGame_Destroy(generation);
+        QuickGame_Destroy(refs);
+        return -1;
+    }
+
+    if(table->capacity > 0) {
+        memcpy(dense, table->dense, sizeof(anyopaque*) * table->count);
+        memcpy(dense_slot, table->dense_slot, sizeof(u32) * table->count);
+        memcpy(slot_dense, table->slot_dense, sizeof(u32) * table->slot_count);
+        memcpy(generation, table->generation, sizeof(u16) * table->slot_count);
+        memcpy(refs, table->refs, sizeof(u16) * table->slot_count);
+    }
+
+    QuickGame_Destroy(table->dense);
+    QuickGame_Destroy(table->dense_slot);
+    QuickGame_Destroy(table->slot_dense);
+    QuickGame_Destroy(table->generation);
+    QuickGame_Destroy(table->refs);
+
+    table->dense = dense;
+    table->dense_slot = dense_slot;
+    table->slot_dense = slot_dense;
+    table->generation = generation;
+    table->refs = refs;
+    table->capacity = capacity;
+    return 0;
+}
+
+/**
+ * @brief Registers a resource in the table of its type, holding one reference. Resource pointers
+ * are kept packed, so the table can be walked without gaps, and a resource can be moved with Relocate.
+ *
+ * @param type QGHandleType of the resource
+ * @param resource Resource to register
+ * @return QGHandle Handle or QG_NULL_HANDLE on failure
+ */
+QGHandle QuickGame_Handle_Create(u8 type, anyopaque* resource) {
+    if(type >= QG_HANDLE_TYPES || resource == NULL)
+        return QG_NULL_HANDLE;
+
+    QGHandleTable* table = &tables[type];
+    if(table->capacity == 0)
+        table->free_head = NO_SLOT;
+
+    u32 slot;
+    if(table->free_head != NO_SLOT) {
+        slot = table->free_head;
+        table->free_head = table->slot_dense[slot];
+    } else {
+        if(table->slot_count == table->capacity && grow(table) < 0)
+            return QG_NULL_HANDLE;
+
+        slot = table->slot_count++;
+        table->generation[slot] = 1;
+    }
+
+    u32 d = table->count++;
+    table->dense[d] = resource;
+    table->dense_slot[d] = slot;
+    table->slot_dense[slot] = d;
+    table->refs[slot] = 1;
+
+    return make_handle(type, table->generation[slot], slot);
+}
+
+/**
+ * @brief Looks up a resource in O(1)
+ *
+ * @param handle Handle
+ * @param type Expected QGHandleType
+ * @return anyopaque* Resource or NULL if the handle is stale or of another type
+ */
+anyopaque* QuickGame_Handle_Get(QGHandle handle, u8 type) {
+    u32 slot;
+    if((handle >> QG_HANDLE_TYPE_SHIFT) != type)
+        return NULL;
+
+    QGHandleTable* table = lookup(handle, &slot);
+    return table == NULL ? NULL : table->dense[table->slot_dense[slot]];
+}
+
+/**
+ * @brief Tells whether a handle still refers to a resource
+ *
+ * @param handle Handle
+ * @return true The resource is registered
+ */
+bool QuickGame_Handle_Valid(QGHandle handle) {
+    u32 slot;
+    return lookup(handle, &slot) != NULL;
+}
+
+/**
+ * @brief Adds a reference to a resource, for objects that use it through its pointer
+ *
+ * @param handle Handle
+ * @return i32 < 0 if the handle is stale or the resource has too many references
+ */
+i32 QuickGame_Handle_Retain(QGHandle handle) {
+    u32 slot;
+    QGHandleTable* table = lookup(handle, &slot);
+    if(table == NULL || table->refs[slot] == MAX_REFS)
+        return -1;
+
+    table->refs[slot]++;
+    return 0;
+}
+
+/**
+ * @brief Unregisters a resource without destroying it, whatever its references -- the handle and its copies become stale
+ *
+ * @param handle Handle
+ * @return anyopaque* Resource or NULL if the handle was already stale
+ */
+anyopaque* QuickGame_Handle_Release(QGHandle handle) {
+    u32 slot;
+    QGHandleTable* table = lookup(handle, &slot);
+    if(table == NULL)
+        return NULL;
+
+    u32 d = table->slot_dense[slot];
+    anyopaque* resource = table->dense[d];
+
+    // Keep the table packed by moving the last resource into the hole
+    u32 last = table->count - 1;
+    table->dense[d] = table->dense[last];
+    table->dense_slot[d] = table->dense_slot[last];
+    table->slot_dense[table->dense_slot[d]] = d;
+    table->count--;
+
+    // Generation 0 is never used so no handle is QG_NULL_HANDLE
+    u16 generation = (table->generation[slot] + 1) & GENERATION_MASK;
+    table->generation[slot] = generation == 0 ? 1 : generation;
+    table->slot_dense[slot] = table->free_head;
+    table->free_head = slot;
+
+    return resource;
+}
+
+/**
+ * @brief Drops a reference to a resource. The last one unregisters the resource and destroys
+ * it with the destroy function of its type, until then the handle stays valid.
+ *
+ * @param handle Handle, nothing happens if it is stale
+ */
+void QuickGame_Handle_Destroy(QGHandle handle) {
+    u32 slot;
+    QGHandleTable* table = lookup(handle, &slot);
+    if(table == NULL || --table->refs[slot] > 0)
+        return;
+
+    anyopaque* resource = QuickGame_Handle_Release(handle);
+    if(resource == NULL)
+        return;
+
+    switch(handle >> QG_HANDLE_TYPE_SHIFT) {
+        case QG_HANDLE_TEXTURE: {
+            QGTexture_t texture = resource;
+            QuickGame_Texture_Destroy(&texture);
+            break;
+        }
+        case QG_HANDLE_MESH: {
+            QGVMesh_t mesh = resource;
+            QuickGame_Graphics_Destroy_Mesh(&mesh);
+            break;
+        }
+        case QG_HANDLE_SPRITE: {
+            QGSprite_t sprite = resource;
+            QuickGame_Sprite_Destroy(&sprite);
+            break;
+        }
+        case QG_HANDLE_CLIP: {
+            QGAudioClip_t clip = resource;
+            QuickGame_Audio_Destroy(&clip);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Points a handle at a resource that moved
+ *
+ * @param handle Handle
+ * @param resource New address of the resource
+ * @return i32 < 0 if the handle is stale
+ */
+i32 QuickGame_Handle_Relocate(QGHandle handle, anyopaque* resource) {
+    u32 slot;
+    QGHandleTable* table = lookup(handle, &slot);
+    if(table == NULL || resource == NULL)
+        return -1;
+
+    table->dense[table->slot_dense[slot]] = resource;
+    return 0;
+}
+
+/**
+ * @brief Gets the number of resources registered with a type
+ *
+ * @param type QGHandleType
+ * @return usize Number of resources
+ */
+usize QuickGame_Handle_Count(u8 type) {
+    return type < QG_HANDLE_TYPES ? tables[type].count : 0;
+}
+
+/**
+ * @brief Gets a resource by its place in the packed table, order changes when resources are released
+ *
+ * @param type QGHandleType
+ * @param idx Index below QuickGame_Handle_Count()
+ * @return anyopaque* Resource or NULL if out of range
+ */
+anyopaque* QuickGame_Handle_At(u8 type, usize idx) {
+    if(type >= QG_HANDLE_TYPES || idx >= tables[type].count)
+        return NULL;
+
+    return tables[type].dense[idx];
+}
+
+/**
+ * @brief Frees the tables, every handle becomes stale. Resources are not destroyed.
+ *
+ */
+void QuickGame_Handle_Terminate() {
+    for(usize i = 0; i < QG_HANDLE_TYPES; i++) {
+        QGHandleTable* table = &tables[i];
+        QuickGame_Destroy(table->dense);
+        QuickGame_Destroy(table->dense_slot);
+        QuickGame_Destroy(table->slot_dense);
+        QuickGame_Destroy(table->generation);
+        QuickGame_Destroy(table->refs);
+        memset(table, 0, sizeof(QGHandleTable));
+    }
+}
+
+QGTexture_t QuickGame_Handle_Get_Texture(QGHandle handle) {
+    return QuickGame_Handle_Get(handle, QG_HANDLE_TEXTURE);
+}
+
+QGVMesh_t QuickGame_Handle_Get_Mesh(QGHandle handle) {
+    return QuickGame_Handle_Get(handle, QG_HANDLE_MESH);
+}
+
+QGSprite_t QuickGame_Handle_Get_Sprite(QGHandle handle) {
+    return QuickGame_Handle_Get(handle, QG_HANDLE_SPRITE);
+}
+
+QGAudioClip_t QuickGame_Handle_Get_Clip(QGHandle handle) {
+    return QuickGame_Handle_Get(handle, QG_HANDLE_CLIP);
+}
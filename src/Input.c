@@ -1,17 +1,49 @@
 #include <pspctrl.h>
 #include <Input.h>
+#include <Profile.h>
 
 static struct SceCtrlData padData;
 static struct SceCtrlData oldData;
 
+static const QGInputFrame* replay = NULL;
+static usize replay_count = 0;
+static usize replay_cursor = 0;
+static bool replay_loop = false;
+
 void QuickGame_Input_Init() {
     sceCtrlSetSamplingCycle(0);
     sceCtrlSetSamplingMode(PSP_CTRL_MODE_ANALOG);
 }
 
 void QuickGame_Input_Update() {
+    QuickGame_Profile_Begin(QG_PROFILE_INPUT);
     oldData = padData;
-    sceCtrlReadBufferPositive(&padData,1);
+
+    if(replay != NULL && replay_cursor >= replay_count && replay_loop)
+        replay_cursor = 0;
+
+    if(replay != NULL && replay_cursor < replay_count) {
+        const QGInputFrame* frame = &replay[replay_cursor++];
+        padData.Buttons = frame->buttons;
+        padData.Lx = frame->lx;
+        padData.Ly = frame->ly;
+    } else {
+        replay = NULL;
+        sceCtrlReadBufferPositive(&padData,1);
+    }
+
+    QuickGame_Profile_End(QG_PROFILE_INPUT);
+}
+
+void QuickGame_Input_Replay(const QGInputFrame* frames, usize count, bool loop) {
+    replay = count > 0 ? frames : NULL;
+    replay_count = count;
+    replay_cursor = 0;
+    replay_loop = loop;
+}
+
+bool QuickGame_Input_Replaying() {
+    return replay != NULL;
 }
 
 bool QuickGame_Button_Pressed(u32 buttons) {
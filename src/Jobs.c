@@ -0,0 +1,315 @@
+#include <QuickGame.h>
+#include <Jobs.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __PSP__
+#include <pspkernel.h>
+#else
+#include <pthread.h>
+#endif
+
+typedef struct {
+    QGJob queue[QG_JOB_QUEUE_SIZE];
+    usize count;
+    usize worker_count;
+    volatile bool running;
+    bool initialized;
+#ifdef __PSP__
+    SceUID lock;
+    SceUID work;
+    SceUID workers[QG_MAX_JOB_WORKERS];
+#else
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    pthread_t workers[QG_MAX_JOB_WORKERS];
+#endif
+} QGJobSystem;
+
+static QGJobSystem jobs;
+
+static inline i32 counter_value(const QGJobCounter* counter) {
+    return counter == NULL ? 0 : __atomic_load_n(&counter->value, __ATOMIC_ACQUIRE);
+}
+
+// Counters are only modified with the lock held, readers just need an atomic load
+static inline void counter_add(QGJobCounter* counter, i32 n) {
+    if(counter != NULL)
+        __atomic_store_n(&counter->value, counter->value + n, __ATOMIC_RELEASE);
+}
+
+static inline void lock() {
+#ifdef __PSP__
+    sceKernelWaitSema(jobs.lock, 1, NULL);
+#else
+    pthread_mutex_lock(&jobs.lock);
+#endif
+}
+
+static inline void unlock() {
+#ifdef __PSP__
+    sceKernelSignalSema(jobs.lock, 1);
+#else
+    pthread_mutex_unlock(&jobs.lock);
+#endif
+}
+
+static void notify_work(usize n) {
+    if(n > jobs.worker_count)
+        n = jobs.worker_count;
+    if(n == 0)
+        return;
+
+#ifdef __PSP__
+    sceKernelSignalSema(jobs.work, n);
+#else
+    pthread_cond_broadcast(&jobs.work);
+#endif
+}
+
+// Called with the lock held
+static bool take_ready(QGJob* job) {
+    for(usize i = 0; i < jobs.count; i++) {
+        if(counter_value(jobs.queue[i].dependency) > 0)
+            continue;
+
+        *job = jobs.queue[i];
+        jobs.count--;
+        memmove(&jobs.queue[i], &jobs.queue[i + 1], sizeof(QGJob) * (jobs.count - i));
+        return true;
+    }
+
+    return false;
+}
+
+static void run(QGJob* job) {
+    job->func(job->data);
+
+    lock();
+    counter_add(job->counter, -1);
+    usize pending = jobs.count;
+#ifndef __PSP__
+    pthread_cond_broadcast(&jobs.done);
+#endif
+    unlock();
+
+    // The finished job may have been the dependency of queued ones
+    if(pending > 0 && job->counter != NULL)
+        notify_work(pending);
+}
+
+#ifdef __PSP__
+static int job_worker(SceSize args, void* argp) {
+    while(jobs.running) {
+        sceKernelWaitSema(jobs.work, 1, NULL);
+        while(QuickGame_Jobs_Help());
+    }
+
+    return 0;
+}
+#else
+static void* job_worker(void* argp) {
+    QGJob job;
+
+    lock();
+    while(jobs.running) {
+        if(take_ready(&job)) {
+            unlock();
+            run(&job);
+            lock();
+            continue;
+        }
+
+        pthread_cond_wait(&jobs.work, &jobs.lock);
+    }
+    unlock();
+
+    return NULL;
+}
+#endif
+
+static void stop_workers(usize started) {
+    lock();
+    jobs.running = false;
+    unlock();
+
+#ifdef __PSP__
+    sceKernelSignalSema(jobs.work, started);
+    for(usize i = 0; i < started; i++) {
+        sceKernelWaitThreadEnd(jobs.workers[i], NULL);
+        sceKernelDeleteThread(jobs.workers[i]);
+    }
+    sceKernelDeleteSema(jobs.work);
+    sceKernelDeleteSema(jobs.lock);
+#else
+    pthread_cond_broadcast(&jobs.work);
+    for(usize i = 0; i < started; i++)
+        pthread_join(jobs.workers[i], NULL);
+    pthread_cond_destroy(&jobs.done);
+    pthread_cond_destroy(&jobs.work);
+    pthread_mutex_destroy(&jobs.lock);
+#endif
+}
+
+/**
+ * @brief Starts the worker pool
+ *
+ * @param workers Number of worker threads, 0 for QG_DEFAULT_JOB_WORKERS
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Jobs_Init(usize workers) {
+    if(jobs.initialized)
+        return 0;
+
+    if(workers == 0)
+        workers = QG_DEFAULT_JOB_WORKERS;
+    if(workers > QG_MAX_JOB_WORKERS)
+        workers = QG_MAX_JOB_WORKERS;
+
+    jobs.count = 0;
+    jobs.worker_count = workers;
+    jobs.running = true;
+
+#ifdef __PSP__
+    jobs.lock = sceKernelCreateSema("job_lock", 0, 1, 1, NULL);
+    jobs.work = sceKernelCreateSema("job_work", 0, 0, 0x7FFFFFFF, NULL);
+    if(jobs.lock < 0 || jobs.work < 0) {
+        if(jobs.lock >= 0) sceKernelDeleteSema(jobs.lock);
+        if(jobs.work >= 0) sceKernelDeleteSema(jobs.work);
+        return -1;
+    }
+
+    for(usize i = 0; i < workers; i++) {
+        // Below the main thread (0x20) so workers only fill the time it spends blocked
+        jobs.workers[i] = sceKernelCreateThread("job_worker", job_worker, 0x24, 0x8000, THREAD_ATTR_USER | THREAD_ATTR_VFPU, 0);
+        if(jobs.workers[i] < 0 || sceKernelStartThread(jobs.workers[i], 0, NULL) < 0) {
+            if(jobs.workers[i] >= 0)
+                sceKernelDeleteThread(jobs.workers[i]);
+            stop_workers(i);
+            return -1;
+        }
+    }
+#else
+    pthread_mutex_init(&jobs.lock, NULL);
+    pthread_cond_init(&jobs.work, NULL);
+    pthread_cond_init(&jobs.done, NULL);
+
+    for(usize i = 0; i < workers; i++) {
+        if(pthread_create(&jobs.workers[i], NULL, job_worker, NULL) != 0) {
+            stop_workers(i);
+            return -1;
+        }
+    }
+#endif
+
+    jobs.initialized = true;
+    return 0;
+}
+
+/**
+ * @brief Runs the remaining jobs and stops the worker pool
+ *
+ */
+void QuickGame_Jobs_Terminate() {
+    if(!jobs.initialized)
+        return;
+
+    while(QuickGame_Jobs_Help());
+
+    stop_workers(jobs.worker_count);
+    jobs.initialized = false;
+}
+
+/**
+ * @brief Queues a job. Without a running pool the job runs immediately.
+ *
+ * @param func Function to run
+ * @param data User data passed to func
+ * @param counter Counter incremented now and decremented when the job finishes -- may be NULL
+ * @param dependency Job only starts once this counter is zero -- may be NULL
+ * @return i32 < 0 if the queue is full (or, without a pool, the dependency is not done)
+ */
+i32 QuickGame_Jobs_Submit(QGJobFunc func, anyopaque* data, QGJobCounter* counter, QGJobCounter* dependency) {
+    if(func == NULL)
+        return -1;
+
+    if(!jobs.initialized) {
+        if(counter_value(dependency) > 0)
+            return -1;
+
+        func(data);
+        return 0;
+    }
+
+    lock();
+    if(jobs.count == QG_JOB_QUEUE_SIZE) {
+        unlock();
+        return -1;
+    }
+
+    QGJob* job = &jobs.queue[jobs.count++];
+    job->func = func;
+    job->data = data;
+    job->counter = counter;
+    job->dependency = dependency;
+    counter_add(counter, 1);
+    unlock();
+
+    notify_work(1);
+    return 0;
+}
+
+/**
+ * @brief Runs one ready job on the calling thread
+ *
+ * @return true A job was run
+ * @return false No job was ready
+ */
+bool QuickGame_Jobs_Help() {
+    if(!jobs.initialized)
+        return false;
+
+    QGJob job;
+
+    lock();
+    bool found = take_ready(&job);
+    unlock();
+
+    if(found)
+        run(&job);
+
+    return found;
+}
+
+/**
+ * @brief Waits until a counter reaches zero, running ready jobs on the calling thread meanwhile
+ *
+ * @param counter Counter to wait on
+ */
+void QuickGame_Jobs_Wait(QGJobCounter* counter) {
+    while(counter_value(counter) > 0) {
+        if(QuickGame_Jobs_Help())
+            continue;
+
+#ifdef __PSP__
+        // Sleep so lower priority workers get to finish
+        sceKernelDelayThread(100);
+#else
+        lock();
+        if(counter_value(counter) > 0)
+            pthread_cond_wait(&jobs.done, &jobs.lock);
+        unlock();
+#endif
+    }
+}
+
+/**
+ * @brief Tells whether all jobs of a counter are done without waiting
+ *
+ * @param counter Counter to check
+ * @return true Every job submitted with the counter finished
+ */
+bool QuickGame_Jobs_Done(const QGJobCounter* counter) {
+    return counter_value(counter) == 0;
+}
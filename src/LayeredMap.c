@@ -0,0 +1,266 @@
+#include <QuickGame.h>
+#include <LayeredMap.h>
+#include <stddef.h>
+#include <float.h>
+#include <math.h>
+#include <gu2gl.h>
+
+/**
+ * @brief Creates a layered map, every layer is a tilemap of the same size sharing one atlas
+ *
+ * @param atlas Atlas shared by the layers -- not owned by the map
+ * @param size Size of each layer in tiles
+ * @param layer_count Number of layers, drawn from 0 (back) to layer_count - 1 (front)
+ * @return QGLayeredMap_t Layered map or NULL on failure
+ */
+QGLayeredMap_t QuickGame_Layered_Map_Create(QGAtlas_t atlas, QGVector2 size, usize layer_count) {
+    if(atlas == NULL || layer_count == 0 || layer_count > QG_MAX_MAP_LAYERS)
+        return NULL;
+
+    QGLayeredMap_t map = (QGLayeredMap_t)QuickGame_Allocate(sizeof(QGLayeredMap));
+    if(map == NULL)
+        return NULL;
+
+    map->atlas = atlas;
+    map->size = size;
+    map->layer_count = layer_count;
+
+    for(usize i = 0; i < layer_count; i++) {
+        QGMapLayer* layer = &map->layers[i];
+        layer->parallax.x = 1.0f;
+        layer->parallax.y = 1.0f;
+        layer->visible = true;
+
+        layer->tilemap = QuickGame_Tilemap_Create_Alt(atlas, size);
+        layer->row_bounds = (f32*)QuickGame_Allocate(sizeof(f32) * 4 * (usize)size.y);
+
+        if(layer->tilemap == NULL || layer->row_bounds == NULL) {
+            QuickGame_Layered_Map_Destroy(&map);
+            return NULL;
+        }
+    }
+
+    return map;
+}
+
+/**
+ * @brief Gets the tilemap of a layer to edit its tiles
+ *
+ * @param map Layered map
+ * @param layer Layer index
+ * @return QGTilemap_t Tilemap or NULL if out of range
+ */
+QGTilemap_t QuickGame_Layered_Map_Get_Layer(QGLayeredMap_t map, usize layer) {
+    if(map == NULL || layer >= map->layer_count)
+        return NULL;
+
+    return map->layers[layer].tilemap;
+}
+
+/**
+ * @brief Sets how fast a layer scrolls with the camera
+ *
+ * @param map Layered map
+ * @param layer Layer index
+ * @param parallax 1 moves with the world, 0 stays fixed on screen, 0.5 scrolls at half speed
+ */
+void QuickGame_Layered_Map_Set_Parallax(QGLayeredMap_t map, usize layer, QGVector2 parallax) {
+    if(map == NULL || layer >= map->layer_count)
+        return;
+
+    map->layers[layer].parallax = parallax;
+}
+
+/**
+ * @brief Shows or hides a layer
+ *
+ * @param map Layered map
+ * @param layer Layer index
+ * @param visible Whether the layer is drawn
+ */
+void QuickGame_Layered_Map_Set_Visible(QGLayeredMap_t map, usize layer, bool visible) {
+    if(map == NULL || layer >= map->layer_count)
+        return;
+
+    map->layers[layer].visible = visible;
+}
+
+static void grow_bounds(f32* bounds, const QGTile* tile) {
+    f32 x0 = tile->position.x;
+    f32 y0 = tile->position.y;
+    f32 x1 = x0 + tile->scale.x;
+    f32 y1 = y0 + tile->scale.y;
+
+    if(x0 > x1) { f32 t = x0; x0 = x1; x1 = t; }
+    if(y0 > y1) { f32 t = y0; y0 = y1; y1 = t; }
+
+    if(x0 < bounds[0]) bounds[0] = x0;
+    if(y0 < bounds[1]) bounds[1] = y0;
+    if(x1 > bounds[2]) bounds[2] = x1;
+    if(y1 > bounds[3]) bounds[3] = y1;
+}
+
+static void compute_bounds(QGLayeredMap_t map, QGMapLayer* layer) {
+    usize w = map->size.x;
+    usize h = map->size.y;
+
+    for(usize y = 0; y < h; y++) {
+        f32* bounds = &layer->row_bounds[y * 4];
+        bounds[0] = bounds[1] = FLT_MAX;
+        bounds[2] = bounds[3] = -FLT_MAX;
+
+        for(usize x = 0; x < w; x++)
+            grow_bounds(bounds, &layer->tilemap->tile_array[x + y * w]);
+    }
+}
+
+/**
+ * @brief Sets a tile of a layer without rebuilding it
+ *
+ * @param map Layered map
+ * @param layer Layer index
+ * @param x Column of the tile
+ * @param y Row of the tile
+ * @param tile New tile
+ */
+void QuickGame_Layered_Map_Set_Tile(QGLayeredMap_t map, usize layer, usize x, usize y, QGTile tile) {
+    if(map == NULL || layer >= map->layer_count || x >= (usize)map->size.x || y >= (usize)map->size.y)
+        return;
+
+    QGMapLayer* l = &map->layers[layer];
+    QuickGame_Tilemap_Set_Tile(l->tilemap, x, y, tile);
+
+    // Bounds only ever grow here, a rebuild tightens them again
+    grow_bounds(&l->row_bounds[y * 4], &tile);
+}
+
+/**
+ * @brief Builds every layer and its culling bounds
+ *
+ * @param map Layered map
+ */
+void QuickGame_Layered_Map_Build(QGLayeredMap_t map) {
+    if(map == NULL)
+        return;
+
+    for(usize i = 0; i < map->layer_count; i++) {
+        QuickGame_Tilemap_Build(map->layers[i].tilemap);
+        compute_bounds(map, &map->layers[i]);
+    }
+}
+
+/**
+ * @brief Draws the visible rows of every visible layer, binding the texture once per run of layers sharing it
+ * Layer tilemaps are positioned and scaled by their transform, rotation is ignored.
+ *
+ * @param map Layered map
+ */
+void QuickGame_Layered_Map_Draw(QGLayeredMap_t map) {
+    if(map == NULL)
+        return;
+
+    QGCamera2D* camera = QuickGame_Graphics_Get_Camera();
+    QGVector2 cam = {0.0f, 0.0f};
+    if(camera != NULL)
+        cam = camera->position;
+
+    QGVector2 view_min, view_max;
+    QuickGame_Graphics_Get_View_Rect(&view_min, &view_max);
+
+    usize w = map->size.x;
+    usize h = map->size.y;
+    QGTexture_t bound = NULL;
+
+    for(usize i = 0; i < map->layer_count; i++) {
+        QGMapLayer* layer = &map->layers[i];
+        QGTilemap_t tilemap = layer->tilemap;
+        if(!layer->visible)
+            continue;
+
+        QGTransform2D* t = &tilemap->transform;
+
+        // A layer with parallax p appears to move by p * camera
+        f32 ox = t->position.x + cam.x * (1.0f - layer->parallax.x);
+        f32 oy = t->position.y + cam.y * (1.0f - layer->parallax.y);
+
+        // View rectangle in layer space
+        f32 vx0 = (view_min.x - ox) / t->scale.x;
+        f32 vy0 = (view_min.y - oy) / t->scale.y;
+        f32 vx1 = (view_max.x - ox) / t->scale.x;
+        f32 vy1 = (view_max.y - oy) / t->scale.y;
+
+        if(vx0 > vx1) { f32 tmp = vx0; vx0 = vx1; vx1 = tmp; }
+        if(vy0 > vy1) { f32 tmp = vy0; vy0 = vy1; vy1 = tmp; }
+
+        bool matrix_set = false;
+        usize run_start = 0;
+        usize run_length = 0;
+
+        for(usize y = 0; y <= h; y++) {
+            bool visible = false;
+            if(y < h) {
+                const f32* b = &layer->row_bounds[y * 4];
+                visible = (b[0] <= vx1 && b[2] >= vx0 && b[1] <= vy1 && b[3] >= vy0);
+            }
+
+            if(visible) {
+                if(QuickGame_Graphics_Coverage_Enabled()) {
+                    // Row bounds clipped to the view, gaps inside a row are counted as covered
+                    const f32* b = &layer->row_bounds[y * 4];
+                    f32 cw = fminf(b[2], vx1) - fmaxf(b[0], vx0);
+                    f32 ch = fminf(b[3], vy1) - fmaxf(b[1], vy0);
+                    QuickGame_Graphics_Add_Coverage(QG_COVERAGE_TILEMAP, cw * ch * fabsf(t->scale.x * t->scale.y));
+                }
+
+                if(run_length == 0)
+                    run_start = y;
+                run_length++;
+                continue;
+            }
+
+            if(run_length == 0)
+                continue;
+
+            if(!matrix_set) {
+                glMatrixMode(GL_MODEL);
+                glLoadIdentity();
+
+                ScePspFVector3 v1 = {ox, oy, 0.0f};
+                gluTranslate(&v1);
+
+                ScePspFVector3 v = {t->scale.x, t->scale.y, 1.0f};
+                gluScale(&v);
+
+                if(tilemap->texture != bound) {
+                    QuickGame_Texture_Bind(tilemap->texture);
+                    bound = tilemap->texture;
+                }
+                matrix_set = true;
+            }
+
+            QuickGame_Graphics_Draw_Mesh_Range(tilemap->mesh, run_start * w * 6, run_length * w * 6);
+            run_length = 0;
+        }
+    }
+
+    if(bound != NULL)
+        QuickGame_Texture_Unbind();
+}
+
+/**
+ * @brief Destroys a layered map
+ *
+ * @param map Layered map to destroy -- also gets set to null.
+ */
+void QuickGame_Layered_Map_Destroy(QGLayeredMap_t* map) {
+    if(map == NULL || (*map) == NULL)
+        return;
+
+    for(usize i = 0; i < (*map)->layer_count; i++) {
+        QuickGame_Tilemap_Destroy(&(*map)->layers[i].tilemap);
+        QuickGame_Destroy((*map)->layers[i].row_bounds);
+    }
+
+    QuickGame_Destroy(*map);
+    *map = NULL;
+}
@@ -0,0 +1,436 @@
+#include <QuickGame.h>
+#include <Log.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <pspkernel.h>
+#include <pspiofilemgr.h>
+#include <gu2gl.h>
+
+#define QG_LOG_GLYPH_SIZE 8
+#define QG_LOG_WAKE_US 100000
+#define QG_LOG_OUTPUT_MAX 4096
+
+/**
+ * A slot is free for position pos when its sequence is lap(pos) * 2 and holds a message when it is
+ * lap(pos) * 2 + 1, the writer frees it for the next lap. Zeroed slots are free for the first lap,
+ * so messages can be recorded before QuickGame_Log_Init().
+ */
+typedef struct {
+    u32 sequence;
+    u8 level;
+    u8 category;
+    u64 time;
+    char text[QG_LOG_MESSAGE_MAX];
+} QGLogRecord;
+
+typedef struct {
+    u8 level;
+    char text[QG_LOG_CONSOLE_COLUMNS + 1];
+} QGLogLine;
+
+static QGLogRecord ring[QG_LOG_RING_SIZE];
+static u32 head = 0; // Next position to claim, any thread
+static u32 tail = 0; // Next position to write, writer thread
+static u32 written = 0; // Positions before this are written out
+static u32 dropped = 0;
+
+static u8 min_level = QG_LOG_INFO;
+static u32 category_mask = QG_LOG_ALL_CATEGORIES;
+
+static SceUID writer = -1;
+static SceUID wake = -1;
+static SceUID file = -1;
+static bool running = false;
+static bool to_stdout = false;
+static char output[QG_LOG_OUTPUT_MAX];
+static usize output_length = 0;
+
+// Written by the writer, drawn by the main thread, both under console_lock
+static SceUID console_lock = -1;
+static QGLogLine console_lines[QG_LOG_CONSOLE_LINES_MAX];
+static usize console_next = 0;
+static usize console_shown = 0;
+static bool console_dirty = false;
+static QGTilemap_t console = NULL;
+
+static const char* level_names[] = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR"};
+static const char* category_names[] = {"core", "graphics", "audio", "input", "asset", "net", "script", "game"};
+
+static inline u32 free_sequence(u32 pos) {
+    return (pos / QG_LOG_RING_SIZE) * 2;
+}
+
+static void write_output() {
+    if(output_length == 0)
+        return;
+
+    if(to_stdout) {
+        fwrite(output, 1, output_length, stdout);
+        fflush(stdout);
+    } else if(file >= 0) {
+        sceIoWrite(file, output, output_length);
+    }
+
+    output_length = 0;
+}
+
+static void add_console_line(u8 level, const char* text, usize length) {
+    if(length > QG_LOG_CONSOLE_COLUMNS - 2)
+        length = QG_LOG_CONSOLE_COLUMNS - 2;
+
+    QGLogLine* line = &console_lines[console_next];
+    line->level = level;
+    line->text[0] = level_names[level][0];
+    line->text[1] = ' ';
+    memcpy(line->text + 2, text, length);
+    line->text[length + 2] = 0;
+
+    console_next = (console_next + 1) % QG_LOG_CONSOLE_LINES_MAX;
+    console_dirty = true;
+}
+
+static void add_console_lines(const QGLogRecord* record) {
+    sceKernelWaitSema(console_lock, 1, NULL);
+
+    const char* text = record->text;
+    const char* end;
+    while((end = strchr(text, '\n')) != NULL) {
+        add_console_line(record->level, text, end - text);
+        text = end + 1;
+    }
+    if(*text != 0)
+        add_console_line(record->level, text, strlen(text));
+
+    sceKernelSignalSema(console_lock, 1);
+}
+
+/**
+ * @brief Writes out the messages recorded so far
+ *
+ */
+static void drain() {
+    for(;;) {
+        QGLogRecord* record = &ring[tail & (QG_LOG_RING_SIZE - 1)];
+        if(__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) != free_sequence(tail) + 1)
+            break;
+
+        if(QG_LOG_OUTPUT_MAX - output_length < QG_LOG_MESSAGE_MAX + 48)
+            write_output();
+
+        u32 seconds = record->time / 1000000;
+        u32 micros = record->time % 1000000;
+        output_length += snprintf(output + output_length, QG_LOG_OUTPUT_MAX - output_length, "[%6u.%06u] %-5s %s: %s\n",
+            seconds, micros, level_names[record->level], category_names[record->category], record->text);
+
+        add_console_lines(record);
+
+        // Hand the slot to the next lap, (tail + size) wraps along with tail
+        __atomic_store_n(&record->sequence, free_sequence(tail + QG_LOG_RING_SIZE), __ATOMIC_RELEASE);
+        tail++;
+    }
+
+    write_output();
+    __atomic_store_n(&written, tail, __ATOMIC_RELEASE);
+}
+
+static int log_writer(SceSize args, void* argp) {
+    while(__atomic_load_n(&running, __ATOMIC_ACQUIRE)) {
+        SceUInt timeout = QG_LOG_WAKE_US;
+        sceKernelWaitSema(wake, 1, &timeout);
+        drain();
+    }
+
+    drain();
+    return 0;
+}
+
+/**
+ * @brief Starts the writer thread. Messages logged before this wait in the ring.
+ *
+ * @param filename File the messages are appended to, NULL for stdout
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Log_Init(const char* filename) {
+    if(writer >= 0)
+        return -1;
+
+    to_stdout = filename == NULL;
+    if(!to_stdout) {
+        file = sceIoOpen(filename, PSP_O_WRONLY | PSP_O_CREAT | PSP_O_APPEND, 0777);
+        if(file < 0)
+            return -1;
+    }
+
+    wake = sceKernelCreateSema("log_signal", 0, 0, 1, NULL);
+    console_lock = sceKernelCreateSema("log_console", 0, 1, 1, NULL);
+    if(wake < 0 || console_lock < 0)
+        goto fail;
+
+    __atomic_store_n(&running, true, __ATOMIC_RELEASE);
+
+    // Below the main thread and the job workers, so writing only fills the time they spend waiting
+    writer = sceKernelCreateThread("log_writer", log_writer, 0x30, 0x4000, 0, 0);
+    if(writer < 0)
+        goto fail;
+
+    if(sceKernelStartThread(writer, 0, NULL) < 0) {
+        sceKernelDeleteThread(writer);
+        writer = -1;
+        goto fail;
+    }
+
+    return 0;
+
+fail:
+    __atomic_store_n(&running, false, __ATOMIC_RELEASE);
+    QuickGame_Log_Terminate();
+    return -1;
+}
+
+/**
+ * @brief Writes the remaining messages, stops the writer and hides the console
+ *
+ */
+void QuickGame_Log_Terminate() {
+    if(writer >= 0) {
+        __atomic_store_n(&running, false, __ATOMIC_RELEASE);
+        sceKernelSignalSema(wake, 1);
+        sceKernelWaitThreadEnd(writer, NULL);
+        sceKernelDeleteThread(writer);
+        writer = -1;
+    }
+
+    QuickGame_Tilemap_Destroy(&console);
+
+    if(wake >= 0)
+        sceKernelDeleteSema(wake);
+    if(console_lock >= 0)
+        sceKernelDeleteSema(console_lock);
+    if(file >= 0)
+        sceIoClose(file);
+
+    wake = -1;
+    console_lock = -1;
+    file = -1;
+    to_stdout = false;
+}
+
+/**
+ * @brief Sets the lowest level that is recorded, QG_LOG_INFO by default
+ *
+ * @param level Level, QG_LOG_OFF records nothing
+ */
+void QuickGame_Log_Set_Level(u8 level) {
+    min_level = level;
+}
+
+/**
+ * @brief Sets which categories are recorded, all of them by default
+ *
+ * @param mask Bit (1 << category) per recorded category
+ */
+void QuickGame_Log_Set_Categories(u32 mask) {
+    category_mask = mask;
+}
+
+/**
+ * @brief Checks whether a message would be recorded, to skip building expensive arguments
+ *
+ * @param level Level
+ * @param category Category
+ * @return true The message would be recorded
+ */
+bool QuickGame_Log_Enabled(u8 level, u8 category) {
+    return level >= min_level && level < QG_LOG_OFF && category < QG_LOG_CATEGORY_COUNT && (category_mask & (1u << category));
+}
+
+/**
+ * @brief Records a message. Safe from any thread, never blocks.
+ *
+ * @param level Level
+ * @param category Category
+ * @param format printf format
+ */
+void QuickGame_Log(u8 level, u8 category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    QuickGame_Log_V(level, category, format, args);
+    va_end(args);
+}
+
+/**
+ * @brief Records a message from a va_list
+ *
+ * @param level Level
+ * @param category Category
+ * @param format printf format
+ * @param args Arguments
+ */
+void QuickGame_Log_V(u8 level, u8 category, const char* format, va_list args) {
+    if(format == NULL || !QuickGame_Log_Enabled(level, category))
+        return;
+
+    // Claim a position, a failed exchange reloads pos with the current head
+    u32 pos = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    QGLogRecord* record;
+    for(;;) {
+        record = &ring[pos & (QG_LOG_RING_SIZE - 1)];
+        i32 lap = (i32)(__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) - free_sequence(pos));
+
+        if(lap == 0) {
+            if(__atomic_compare_exchange_n(&head, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        } else if(lap < 0) {
+            // The writer has not freed this slot from the previous lap
+            __atomic_fetch_add(&dropped, 1, __ATOMIC_RELAXED);
+            return;
+        } else {
+            pos = __atomic_load_n(&head, __ATOMIC_RELAXED);
+        }
+    }
+
+    record->level = level;
+    record->category = category;
+    record->time = QuickGame_Boot_Time();
+    vsnprintf(record->text, QG_LOG_MESSAGE_MAX, format, args);
+
+    __atomic_store_n(&record->sequence, free_sequence(pos) + 1, __ATOMIC_RELEASE);
+
+    // Wake the writer early when half of the ring is used
+    if(wake >= 0 && (pos & (QG_LOG_RING_SIZE / 2 - 1)) == QG_LOG_RING_SIZE / 2 - 1)
+        sceKernelSignalSema(wake, 1);
+}
+
+/**
+ * @brief Waits until the writer has written every message recorded so far
+ *
+ */
+void QuickGame_Log_Flush() {
+    if(writer < 0)
+        return;
+
+    u32 target = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    sceKernelSignalSema(wake, 1);
+
+    while((i32)(__atomic_load_n(&written, __ATOMIC_ACQUIRE) - target) < 0)
+        sceKernelDelayThread(1000);
+}
+
+/**
+ * @brief Gets how many messages were dropped because the ring was full
+ *
+ * @return u32 Dropped messages
+ */
+u32 QuickGame_Log_Dropped() {
+    return __atomic_load_n(&dropped, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Shows the latest messages as a console drawn by QuickGame_Log_Draw_Console()
+ *
+ * @param font Font with a 16x16 grid of ASCII glyphs -- not owned by the console, NULL hides it
+ * @param lines Number of lines shown, at most QG_LOG_CONSOLE_LINES_MAX
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Log_Set_Console(QGTexture_t font, usize lines) {
+    if(console_lock < 0)
+        return -1;
+
+    QuickGame_Tilemap_Destroy(&console);
+    if(font == NULL)
+        return 0;
+
+    if(lines == 0 || lines > QG_LOG_CONSOLE_LINES_MAX)
+        return -1;
+
+    QGTextureAtlas grid = {.x = 16, .y = 16};
+    QGVector2 size = {.x = QG_LOG_CONSOLE_COLUMNS, .y = lines};
+    console = QuickGame_Tilemap_Create(grid, font, size);
+    if(console == NULL)
+        return -1;
+
+    sceKernelWaitSema(console_lock, 1, NULL);
+    console_shown = lines;
+    console_dirty = true;
+    sceKernelSignalSema(console_lock, 1);
+
+    return 0;
+}
+
+static u32 level_color(u8 level) {
+    if(level >= QG_LOG_ERROR)
+        return 0xFF4040FF;
+    if(level == QG_LOG_WARN)
+        return 0xFF40FFFF;
+    return 0xFFFFFFFF;
+}
+
+/**
+ * @brief Lays the latest lines out on the console tilemap, the newest at the bottom
+ *
+ */
+static void build_console() {
+    for(usize row = 0; row < console_shown; row++) {
+        usize idx = (console_next + QG_LOG_CONSOLE_LINES_MAX - console_shown + row) % QG_LOG_CONSOLE_LINES_MAX;
+        const QGLogLine* line = &console_lines[idx];
+        bool ended = false;
+
+        for(usize column = 0; column < QG_LOG_CONSOLE_COLUMNS; column++) {
+            char c = ended ? 0 : line->text[column];
+            ended = c == 0;
+
+            // Blank cells collapse to nothing, the quads stay in the one mesh
+            f32 glyph = (c == 0 || c == ' ') ? 0.0f : QG_LOG_GLYPH_SIZE;
+            QGTile tile = {
+                .atlas_idx = (u8)c,
+                .collide = false,
+                .position = {.x = column * QG_LOG_GLYPH_SIZE, .y = 272 - (row + 1) * QG_LOG_GLYPH_SIZE},
+                .scale = {.x = glyph, .y = glyph},
+                .color.color = level_color(line->level)
+            };
+            console->tile_array[column + row * QG_LOG_CONSOLE_COLUMNS] = tile;
+        }
+    }
+
+    QuickGame_Tilemap_Build(console);
+    console_dirty = false;
+}
+
+/**
+ * @brief Draws the console over the frame in a single draw call, does nothing when it is hidden
+ *
+ */
+void QuickGame_Log_Draw_Console() {
+    if(console == NULL)
+        return;
+
+    sceKernelWaitSema(console_lock, 1, NULL);
+    if(console_dirty)
+        build_console();
+    sceKernelSignalSema(console_lock, 1);
+
+    // The console sits on the screen, not in the world
+    glMatrixMode(GL_VIEW);
+    glLoadIdentity();
+
+    QuickGame_Tilemap_Draw(console);
+
+    QGCamera2D* camera = QuickGame_Graphics_Get_Camera();
+    if(camera != NULL) {
+        glMatrixMode(GL_VIEW);
+        glLoadIdentity();
+
+        ScePspFVector3 temp = {
+            .x = -camera->position.x,
+            .y = -camera->position.y,
+            .z = 0,
+        };
+
+        gluTranslate(&temp);
+        gluRotateZ(camera->rotation);
+    }
+
+    glMatrixMode(GL_MODEL);
+    glLoadIdentity();
+}
@@ -0,0 +1,579 @@
+#include <QuickGame.h>
+#include <Manifest.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pspkernel.h>
+#include <pspiofilemgr.h>
+
+#define MAX_TOKENS 8
+
+// The contents get a terminating zero so scripts can be used as strings
+static u8* read_file(const char* path, usize* size) {
+    SceUID fd = sceIoOpen(path, PSP_O_RDONLY, 0777);
+    if(fd < 0)
+        return NULL;
+
+    SceOff len = sceIoLseek(fd, 0, PSP_SEEK_END);
+    sceIoLseek(fd, 0, PSP_SEEK_SET);
+
+    u8* data = NULL;
+    if(len > 0)
+        data = (u8*)QuickGame_Allocate(len + 1);
+
+    if(data != NULL && sceIoRead(fd, data, len) != len) {
+        QuickGame_Destroy(data);
+        data = NULL;
+    }
+
+    sceIoClose(fd);
+    *size = data != NULL ? (usize)len : 0;
+    return data;
+}
+
+// Splits a line in place, stops at a comment
+static usize tokenize(char* line, char** tokens) {
+    usize count = 0;
+    char* c = line;
+
+    while(*c != '\0' && count < MAX_TOKENS) {
+        while(*c == ' ' || *c == '\t' || *c == '\r')
+            c++;
+
+        if(*c == '\0' || *c == '#')
+            break;
+
+        tokens[count++] = c;
+        while(*c != '\0' && *c != ' ' && *c != '\t' && *c != '\r')
+            c++;
+
+        if(*c != '\0')
+            *c++ = '\0';
+    }
+
+    return count;
+}
+
+static bool copy_word(char* dest, const char* src, usize max) {
+    if(strlen(src) >= max)
+        return false;
+
+    strcpy(dest, src);
+    return true;
+}
+
+static bool parse_options(QGAsset* asset, char** tokens, usize count) {
+    for(usize i = 0; i < count; i++) {
+        if(asset->type == QG_ASSET_TEXTURE && strcmp(tokens[i], "flip") == 0)
+            asset->options |= QG_ASSET_FLIP;
+        else if(asset->type == QG_ASSET_TEXTURE && strcmp(tokens[i], "vram") == 0)
+            asset->options |= QG_ASSET_VRAM;
+        else if(asset->type == QG_ASSET_TEXTURE && strcmp(tokens[i], "mask") == 0)
+            asset->options |= QG_ASSET_MASK;
+        else if(asset->type == QG_ASSET_SOUND && strcmp(tokens[i], "loop") == 0)
+            asset->options |= QG_ASSET_LOOP;
+        else if(asset->type == QG_ASSET_SOUND && strcmp(tokens[i], "stream") == 0)
+            asset->options |= QG_ASSET_STREAM;
+        else
+            return false;
+    }
+
+    return true;
+}
+
+static bool parse_line(QGAsset* asset, char** tokens, usize count) {
+    if(count < 3)
+        return false;
+
+    if(strcmp(tokens[0], "texture") == 0)
+        asset->type = QG_ASSET_TEXTURE;
+    else if(strcmp(tokens[0], "sound") == 0)
+        asset->type = QG_ASSET_SOUND;
+    else if(strcmp(tokens[0], "map") == 0)
+        asset->type = QG_ASSET_MAP;
+    else if(strcmp(tokens[0], "script") == 0)
+        asset->type = QG_ASSET_SCRIPT;
+    else
+        return false;
+
+    if(!copy_word(asset->name, tokens[1], QG_ASSET_NAME_MAX) || !copy_word(asset->path, tokens[2], QG_ASSET_PATH_MAX))
+        return false;
+
+    if(asset->type == QG_ASSET_MAP) {
+        if(count != 7 || !copy_word(asset->dependency, tokens[3], QG_ASSET_NAME_MAX))
+            return false;
+
+        asset->atlas.columns = strtoul(tokens[4], NULL, 10);
+        asset->atlas.rows = strtoul(tokens[5], NULL, 10);
+        asset->budget = strtoul(tokens[6], NULL, 10);
+        return asset->atlas.columns > 0 && asset->atlas.rows > 0 && asset->budget > 0;
+    }
+
+    if(asset->type == QG_ASSET_SCRIPT)
+        return count == 3;
+
+    return parse_options(asset, tokens + 3, count - 3);
+}
+
+static inline u32 asset_state(const QGAsset* asset) {
+    return __atomic_load_n(&asset->state, __ATOMIC_ACQUIRE);
+}
+
+static inline void set_state(QGAsset* asset, u32 state) {
+    __atomic_store_n(&asset->state, state, __ATOMIC_RELEASE);
+}
+
+// Files without a read are finished on the main thread
+static bool needs_read(const QGAsset* asset) {
+    if(asset->type == QG_ASSET_MAP)
+        return false;
+
+    return !(asset->type == QG_ASSET_SOUND && (asset->options & QG_ASSET_STREAM));
+}
+
+static void decode_job(anyopaque* data) {
+    QGAsset* asset = (QGAsset*)data;
+
+    // VRAM is allocated on the main thread, the pixels move there when the asset finishes
+    QGTexInfo info = {
+        .filename = asset->path,
+        .flip = (asset->options & QG_ASSET_FLIP) != 0,
+        .vram = false,
+        .mask = (asset->options & QG_ASSET_MASK) != 0
+    };
+
+    asset->texture = QuickGame_Texture_Load_Memory(asset->data, asset->size, info);
+    QuickGame_Destroy(asset->data);
+    asset->data = NULL;
+    asset->size = 0;
+
+    set_state(asset, QG_ASSET_DECODED);
+}
+
+static void read_job(anyopaque* data) {
+    QGAsset* asset = (QGAsset*)data;
+    asset->data = read_file(asset->path, &asset->size);
+
+    if(asset->data == NULL || asset->type != QG_ASSET_TEXTURE) {
+        set_state(asset, QG_ASSET_DECODED);
+        return;
+    }
+
+    // The next read starts as soon as this job returns, decoding overlaps it
+    if(QuickGame_Jobs_Submit(decode_job, asset, &asset->decode, NULL) < 0)
+        decode_job(asset);
+}
+
+/**
+ * @brief Parses a manifest file, nothing is loaded yet
+ *
+ * @param filename Manifest file
+ * @return QGManifest_t Manifest or NULL on failure (unreadable file, unknown asset type, bad line)
+ */
+QGManifest_t QuickGame_Manifest_Load(const char* filename) {
+    if(filename == NULL)
+        return NULL;
+
+    usize size = 0;
+    char* text = (char*)read_file(filename, &size);
+    if(text == NULL)
+        return NULL;
+
+    usize lines = 1;
+    for(usize i = 0; i < size; i++) {
+        if(text[i] == '\n')
+            lines++;
+    }
+
+    QGManifest_t manifest = (QGManifest_t)QuickGame_Allocate(sizeof(QGManifest));
+    if(manifest == NULL)
+        goto fail;
+
+    manifest->assets = (QGAsset*)QuickGame_Allocate(sizeof(QGAsset) * lines);
+    manifest->order = (usize*)QuickGame_Allocate(sizeof(usize) * lines);
+    if(manifest->assets == NULL || manifest->order == NULL)
+        goto fail;
+
+    char* line = text;
+    while(line != NULL) {
+        char* next = strchr(line, '\n');
+        if(next != NULL)
+            *next++ = '\0';
+
+        char* tokens[MAX_TOKENS];
+        usize count = tokenize(line, tokens);
+        line = next;
+
+        if(count == 0)
+            continue;
+
+        QGAsset* asset = &manifest->assets[manifest->count];
+        if(!parse_line(asset, tokens, count) || QuickGame_Manifest_Find(manifest, asset->name) != NULL)
+            goto fail;
+
+        manifest->count++;
+    }
+
+    // Maps need a texture of the same manifest
+    for(usize i = 0; i < manifest->count; i++) {
+        QGAsset* asset = &manifest->assets[i];
+        if(asset->type != QG_ASSET_MAP)
+            continue;
+
+        QGAsset* texture = QuickGame_Manifest_Find(manifest, asset->dependency);
+        if(texture == NULL || texture->type != QG_ASSET_TEXTURE)
+            goto fail;
+    }
+
+    QuickGame_Destroy(text);
+    return manifest;
+
+fail:
+    QuickGame_Destroy(text);
+    QuickGame_Manifest_Destroy(&manifest);
+    return NULL;
+}
+
+/**
+ * @brief Orders the reads and starts loading in the background
+ *
+ * @param manifest Manifest
+ * @param callback Progress callback -- may be NULL
+ * @param user User data passed to callback
+ * @return i32 < 0 if the manifest was already started
+ */
+i32 QuickGame_Manifest_Start(QGManifest_t manifest, QGManifestCallback callback, anyopaque* user) {
+    if(manifest == NULL || manifest->started)
+        return -1;
+
+    manifest->callback = callback;
+    manifest->user = user;
+    manifest->started = true;
+
+    usize reads = 0;
+    for(usize i = 0; i < manifest->count; i++) {
+        QGAsset* asset = &manifest->assets[i];
+
+        if(!needs_read(asset)) {
+            set_state(asset, QG_ASSET_DECODED);
+            continue;
+        }
+
+        // On a UMD the first private word is the file's starting sector
+        SceIoStat stat;
+        memset(&stat, 0, sizeof(SceIoStat));
+        if(sceIoGetstat(asset->path, &stat) >= 0)
+            asset->sector = stat.st_private[0];
+
+        // Insertion sort by sector then path, manifests are short
+        usize j = reads++;
+        for(; j > 0; j--) {
+            QGAsset* prev = &manifest->assets[manifest->order[j - 1]];
+            if(prev->sector < asset->sector || (prev->sector == asset->sector && strcmp(prev->path, asset->path) <= 0))
+                break;
+
+            manifest->order[j] = manifest->order[j - 1];
+        }
+        manifest->order[j] = i;
+    }
+
+    manifest->reads = reads;
+    QuickGame_Manifest_Update(manifest);
+    return 0;
+}
+
+static void submit_reads(QGManifest_t manifest) {
+    while(manifest->submitted < manifest->reads) {
+        usize in_flight = 0;
+        for(usize i = 0; i < manifest->submitted; i++) {
+            u32 state = asset_state(&manifest->assets[manifest->order[i]]);
+            if(state == QG_ASSET_LOADING || state == QG_ASSET_DECODED)
+                in_flight++;
+        }
+
+        if(in_flight >= QG_MANIFEST_IN_FLIGHT)
+            return;
+
+        QGAsset* asset = &manifest->assets[manifest->order[manifest->submitted]];
+        QGJobCounter* previous = NULL;
+        if(manifest->submitted > 0)
+            previous = &manifest->assets[manifest->order[manifest->submitted - 1]].read;
+
+        // Each read waits on the one before it, so the disc is read in order even with several workers
+        set_state(asset, QG_ASSET_LOADING);
+        if(QuickGame_Jobs_Submit(read_job, asset, &asset->read, previous) < 0) {
+            set_state(asset, QG_ASSET_PENDING);
+            return;
+        }
+
+        manifest->submitted++;
+    }
+}
+
+static void report(QGManifest_t manifest, QGAsset* asset, bool ready) {
+    set_state(asset, ready ? QG_ASSET_READY : QG_ASSET_FAILED);
+    manifest->done++;
+    if(!ready)
+        manifest->failed++;
+
+    if(manifest->callback != NULL)
+        manifest->callback(asset, manifest->done, manifest->count, manifest->user);
+}
+
+static bool finish_map(QGAsset* asset, QGAsset* texture) {
+    asset->map_atlas = QuickGame_Atlas_Create(texture->texture, asset->atlas);
+    if(asset->map_atlas == NULL)
+        return false;
+
+    asset->world = QuickGame_World_Load(asset->path, asset->map_atlas, asset->budget);
+    if(asset->world == NULL) {
+        QuickGame_Atlas_Destroy(&asset->map_atlas);
+        return false;
+    }
+
+    return true;
+}
+
+static bool finish(QGAsset* asset) {
+    switch(asset->type) {
+        case QG_ASSET_TEXTURE:
+            if(asset->texture == NULL)
+                return false;
+
+            // Stays in RAM if VRAM is full
+            if(asset->options & QG_ASSET_VRAM)
+                QuickGame_Texture_Move_VRAM(asset->texture);
+            return true;
+
+        case QG_ASSET_SOUND: {
+            bool looping = (asset->options & QG_ASSET_LOOP) != 0;
+            if(asset->options & QG_ASSET_STREAM) {
+                asset->clip = QuickGame_Audio_Load(asset->path, looping, true);
+            } else {
+                asset->clip = QuickGame_Audio_Load_Memory(asset->path, asset->data, asset->size, looping);
+                QuickGame_Destroy(asset->data);
+                asset->data = NULL;
+                asset->size = 0;
+            }
+            return asset->clip != NULL;
+        }
+
+        case QG_ASSET_SCRIPT:
+            return asset->data != NULL;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Finishes decoded assets, queues more reads and reports progress. Call once per frame
+ * while drawing the loading screen, the workers decode while the main thread waits on vsync.
+ *
+ * @param manifest Manifest
+ */
+void QuickGame_Manifest_Update(QGManifest_t manifest) {
+    if(manifest == NULL || !manifest->started)
+        return;
+
+    for(usize i = 0; i < manifest->count; i++) {
+        QGAsset* asset = &manifest->assets[i];
+        if(asset->type != QG_ASSET_MAP && asset_state(asset) == QG_ASSET_DECODED)
+            report(manifest, asset, finish(asset));
+    }
+
+    // Maps go last so a texture finished above is used right away
+    for(usize i = 0; i < manifest->count; i++) {
+        QGAsset* asset = &manifest->assets[i];
+        if(asset->type != QG_ASSET_MAP || asset_state(asset) != QG_ASSET_DECODED)
+            continue;
+
+        QGAsset* texture = QuickGame_Manifest_Find(manifest, asset->dependency);
+        u32 state = asset_state(texture);
+        if(state == QG_ASSET_FAILED)
+            report(manifest, asset, false);
+        else if(state == QG_ASSET_READY)
+            report(manifest, asset, finish_map(asset, texture));
+    }
+
+    submit_reads(manifest);
+}
+
+/**
+ * @brief Loads everything before returning, updating on the calling thread
+ *
+ * @param manifest Manifest, started if needed
+ */
+void QuickGame_Manifest_Wait(QGManifest_t manifest) {
+    if(manifest == NULL)
+        return;
+
+    if(!manifest->started)
+        QuickGame_Manifest_Start(manifest, NULL, NULL);
+
+    while(!QuickGame_Manifest_Done(manifest)) {
+        for(usize i = 0; i < manifest->submitted; i++) {
+            QGAsset* asset = &manifest->assets[manifest->order[i]];
+            QuickGame_Jobs_Wait(&asset->read);
+            QuickGame_Jobs_Wait(&asset->decode);
+        }
+
+        QuickGame_Manifest_Update(manifest);
+    }
+}
+
+/**
+ * @brief Gets the fraction of finished assets
+ *
+ * @param manifest Manifest
+ * @return f32 Progress in [0, 1]
+ */
+f32 QuickGame_Manifest_Progress(QGManifest_t manifest) {
+    if(manifest == NULL || manifest->count == 0)
+        return 1.0f;
+
+    return (f32)manifest->done / (f32)manifest->count;
+}
+
+/**
+ * @brief Tells whether every asset is ready or failed
+ *
+ * @param manifest Manifest
+ * @return true Loading is over
+ */
+bool QuickGame_Manifest_Done(QGManifest_t manifest) {
+    return manifest == NULL || manifest->done == manifest->count;
+}
+
+/**
+ * @brief Finds an asset by name
+ *
+ * @param manifest Manifest
+ * @param name Asset name
+ * @return QGAsset* Asset or NULL if there is none with that name
+ */
+QGAsset* QuickGame_Manifest_Find(QGManifest_t manifest, const char* name) {
+    if(manifest == NULL || name == NULL)
+        return NULL;
+
+    for(usize i = 0; i < manifest->count; i++) {
+        if(strcmp(manifest->assets[i].name, name) == 0)
+            return &manifest->assets[i];
+    }
+
+    return NULL;
+}
+
+static QGAsset* find_ready(QGManifest_t manifest, const char* name, u8 type) {
+    QGAsset* asset = QuickGame_Manifest_Find(manifest, name);
+    if(asset == NULL || asset->type != type || asset_state(asset) != QG_ASSET_READY)
+        return NULL;
+
+    return asset;
+}
+
+/**
+ * @brief Typed lookups, NULL until the asset is ready and after it was taken
+ *
+ * @param manifest Manifest
+ * @param name Asset name
+ */
+QGTexture_t QuickGame_Manifest_Get_Texture(QGManifest_t manifest, const char* name) {
+    QGAsset* asset = find_ready(manifest, name, QG_ASSET_TEXTURE);
+    return asset != NULL ? asset->texture : NULL;
+}
+
+QGAudioClip_t QuickGame_Manifest_Get_Clip(QGManifest_t manifest, const char* name) {
+    QGAsset* asset = find_ready(manifest, name, QG_ASSET_SOUND);
+    return asset != NULL ? asset->clip : NULL;
+}
+
+QGWorld_t QuickGame_Manifest_Get_World(QGManifest_t manifest, const char* name) {
+    QGAsset* asset = find_ready(manifest, name, QG_ASSET_MAP);
+    return asset != NULL ? asset->world : NULL;
+}
+
+/**
+ * @brief Gets the contents of a script
+ *
+ * @param manifest Manifest
+ * @param name Asset name
+ * @param size Size of the contents in bytes
+ * @return const u8* Contents or NULL until the script is ready
+ */
+const u8* QuickGame_Manifest_Get_Data(QGManifest_t manifest, const char* name, usize* size) {
+    QGAsset* asset = find_ready(manifest, name, QG_ASSET_SCRIPT);
+    if(size != NULL)
+        *size = asset != NULL ? asset->size : 0;
+
+    return asset != NULL ? asset->data : NULL;
+}
+
+/**
+ * @brief Takes a ready texture or sound out of the manifest, the caller destroys it.
+ * Take textures once the maps using them are ready, maps fail without their texture.
+ *
+ * @param manifest Manifest
+ * @param name Asset name
+ * @return anyopaque* QGTexture_t or QGAudioClip_t, NULL if not ready or already taken
+ */
+anyopaque* QuickGame_Manifest_Take(QGManifest_t manifest, const char* name) {
+    QGAsset* asset = QuickGame_Manifest_Find(manifest, name);
+    if(asset == NULL || asset_state(asset) != QG_ASSET_READY)
+        return NULL;
+
+    anyopaque* resource = NULL;
+    if(asset->type == QG_ASSET_TEXTURE) {
+        resource = asset->texture;
+        asset->texture = NULL;
+    } else if(asset->type == QG_ASSET_SOUND) {
+        resource = asset->clip;
+        asset->clip = NULL;
+    }
+
+    return resource;
+}
+
+/**
+ * @brief Waits for running jobs and destroys a manifest with the assets it still owns
+ *
+ * @param manifest Manifest to destroy -- also gets set to null.
+ */
+void QuickGame_Manifest_Destroy(QGManifest_t* manifest) {
+    if(manifest == NULL || (*manifest) == NULL)
+        return;
+
+    QGManifest_t m = *manifest;
+
+    if(m->assets != NULL) {
+        for(usize i = 0; i < m->submitted; i++) {
+            QGAsset* asset = &m->assets[m->order[i]];
+            QuickGame_Jobs_Wait(&asset->read);
+            QuickGame_Jobs_Wait(&asset->decode);
+        }
+
+        // Worlds go before the textures their atlases point to
+        for(usize i = 0; i < m->count; i++) {
+            QGAsset* asset = &m->assets[i];
+            if(asset->type == QG_ASSET_MAP) {
+                QuickGame_World_Destroy(&asset->world);
+                QuickGame_Atlas_Destroy(&asset->map_atlas);
+            }
+        }
+
+        for(usize i = 0; i < m->count; i++) {
+            QGAsset* asset = &m->assets[i];
+            if(asset->type == QG_ASSET_TEXTURE)
+                QuickGame_Texture_Destroy(&asset->texture);
+            else if(asset->type == QG_ASSET_SOUND)
+                QuickGame_Audio_Destroy(&asset->clip);
+
+            QuickGame_Destroy(asset->data);
+        }
+    }
+
+    QuickGame_Destroy(m->assets);
+    QuickGame_Destroy(m->order);
+    QuickGame_Destroy(m);
+    *manifest = NULL;
+}
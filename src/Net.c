@@ -0,0 +1,791 @@
+#include <QuickGame.h>
+#include <Net.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#ifdef __PSP__
+#include <pspkernel.h>
+#include <psputility.h>
+#include <pspnet.h>
+#include <pspnet_inet.h>
+#include <pspnet_apctl.h>
+#else
+#include <fcntl.h>
+#include <time.h>
+#endif
+
+#define QG_NET_MAGIC 0x5147
+#define QG_NET_VERSION 1
+#define QG_NET_HEADER_SIZE 26
+#define QG_NET_STATS_WINDOW_MS 1000
+
+/**
+ * Packet layout, little endian:
+ * magic (2) | version (1) | reserved (1) | tick (4) | baseline (4) | ack (4) | time (4) | echo (4) | hold (2) | delta
+ * baseline is the tick the delta was encoded against, 0 for a full snapshot. echo is the time of
+ * the newest packet received from the destination and hold how long ago it arrived, giving the RTT.
+ */
+typedef struct {
+    u32 tick;
+    u32 baseline;
+    u32 ack;
+    u32 time;
+    u32 echo;
+    u16 hold;
+} QGNetHeader;
+
+static bool net_initialized = false;
+
+static u32 clock_ms() {
+#ifdef __PSP__
+    return (u32)(sceKernelGetSystemTimeWide() / 1000);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u32)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+#endif
+}
+
+// Milliseconds since the endpoint was created, starting at 1 so 0 can mean none
+static inline u32 net_time(QGNet_t net) {
+    return clock_ms() - net->start + 1;
+}
+
+static inline void put_u16(u8* p, u16 v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static inline void put_u32(u8* p, u32 v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static inline u16 get_u16(const u8* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static inline u32 get_u32(const u8* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((u32)p[3] << 24);
+}
+
+/**
+ * @brief Brings up networking. On PSP loads the network modules and connects to the access point
+ * of a network configuration, blocking until an address is obtained. Does nothing on other hosts.
+ *
+ * @param config Network configuration index from the system settings, starting at 1
+ * @param timeout_ms Time to wait for the access point
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Net_Init(i32 config, u32 timeout_ms) {
+    if(net_initialized)
+        return 0;
+
+#ifdef __PSP__
+    if(sceUtilityLoadNetModule(PSP_NET_MODULE_COMMON) < 0)
+        return -1;
+
+    if(sceUtilityLoadNetModule(PSP_NET_MODULE_INET) < 0) {
+        sceUtilityUnloadNetModule(PSP_NET_MODULE_COMMON);
+        return -1;
+    }
+
+    if(sceNetInit(128 * 1024, 42, 4 * 1024, 42, 4 * 1024) < 0)
+        goto unload;
+
+    if(sceNetInetInit() < 0)
+        goto term_net;
+
+    if(sceNetApctlInit(0x8000, 48) < 0)
+        goto term_inet;
+
+    if(sceNetApctlConnect(config) < 0)
+        goto term_apctl;
+
+    u32 start = clock_ms();
+    while(true) {
+        int state;
+        if(sceNetApctlGetState(&state) < 0)
+            goto term_apctl;
+
+        if(state == PSP_NET_APCTL_STATE_GOT_IP)
+            break;
+
+        if(clock_ms() - start > timeout_ms) {
+            sceNetApctlDisconnect();
+            goto term_apctl;
+        }
+
+        sceKernelDelayThread(50 * 1000);
+    }
+
+    net_initialized = true;
+    return 0;
+
+term_apctl:
+    sceNetApctlTerm();
+term_inet:
+    sceNetInetTerm();
+term_net:
+    sceNetTerm();
+unload:
+    sceUtilityUnloadNetModule(PSP_NET_MODULE_INET);
+    sceUtilityUnloadNetModule(PSP_NET_MODULE_COMMON);
+    return -1;
+#else
+    net_initialized = true;
+    return 0;
+#endif
+}
+
+/**
+ * @brief Disconnects from the access point and unloads the network modules
+ *
+ */
+void QuickGame_Net_Terminate() {
+    if(!net_initialized)
+        return;
+
+#ifdef __PSP__
+    sceNetApctlDisconnect();
+    sceNetApctlTerm();
+    sceNetInetTerm();
+    sceNetTerm();
+    sceUtilityUnloadNetModule(PSP_NET_MODULE_INET);
+    sceUtilityUnloadNetModule(PSP_NET_MODULE_COMMON);
+#endif
+
+    net_initialized = false;
+}
+
+/**
+ * @brief Parses a dotted IPv4 address
+ *
+ * @param ip Address such as "192.168.1.20"
+ * @param port Port
+ * @param address Parsed address
+ * @return i32 < 0 if ip is not a dotted IPv4 address
+ */
+i32 QuickGame_Net_Address(const char* ip, u16 port, QGNetAddress* address) {
+    if(ip == NULL || address == NULL)
+        return -1;
+
+    u32 result = 0;
+    for(usize part = 0; part < 4; part++) {
+        if(*ip < '0' || *ip > '9')
+            return -1;
+
+        u32 value = 0;
+        usize digits = 0;
+        while(*ip >= '0' && *ip <= '9') {
+            value = value * 10 + (*ip++ - '0');
+            if(++digits > 3 || value > 255)
+                return -1;
+        }
+
+        result = (result << 8) | value;
+        if(part < 3 && *ip++ != '.')
+            return -1;
+    }
+
+    if(*ip != '\0')
+        return -1;
+
+    address->ip = result;
+    address->port = port;
+    return 0;
+}
+
+/**
+ * @brief Opens a non-blocking UDP endpoint
+ *
+ * @param port Port to bind, 0 for any
+ * @param tick_rate Snapshots sent per second
+ * @return QGNet_t Endpoint or NULL on failure
+ */
+QGNet_t QuickGame_Net_Create(u16 port, u32 tick_rate) {
+    if(tick_rate == 0 || tick_rate > 1000)
+        return NULL;
+
+    QGNet_t net = QuickGame_Allocate(sizeof(QGNet));
+    if(!net)
+        return NULL;
+
+    net->socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if(net->socket < 0) {
+        QuickGame_Destroy(net);
+        return NULL;
+    }
+
+#ifdef __PSP__
+    i32 nonblocking = 1;
+    setsockopt(net->socket, SOL_SOCKET, SO_NONBLOCK, &nonblocking, sizeof(nonblocking));
+#else
+    fcntl(net->socket, F_SETFL, fcntl(net->socket, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    socklen_t length = sizeof(addr);
+    if(bind(net->socket, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+       getsockname(net->socket, (struct sockaddr*)&addr, &length) < 0) {
+        close(net->socket);
+        QuickGame_Destroy(net);
+        return NULL;
+    }
+
+    net->port = ntohs(addr.sin_port);
+    net->tick_rate = tick_rate;
+    net->tick_ms = 1000 / tick_rate;
+    net->timeout_ms = QG_NET_DEFAULT_TIMEOUT_MS;
+    net->interp_ticks = QG_NET_DEFAULT_INTERP_TICKS;
+    net->start = clock_ms();
+    net->next_tick = net_time(net);
+
+    return net;
+}
+
+/**
+ * @brief Registers game state sent every tick. Register the same blocks in the same order on every end.
+ *
+ * @param net Endpoint
+ * @param data State, read on every tick and written by QuickGame_Net_Read()
+ * @param size Size in bytes
+ * @param type QGNetBlockType, QG_NET_BLOCK_F32 sizes must be a multiple of 4
+ * @return i32 Block index or < 0 if there are QG_NET_MAX_BLOCKS blocks or the snapshot gets over QG_NET_SNAPSHOT_MAX
+ */
+i32 QuickGame_Net_Register(QGNet_t net, anyopaque* data, usize size, u8 type) {
+    if(!net || !data || size == 0 || net->block_count >= QG_NET_MAX_BLOCKS)
+        return -1;
+
+    if(type == QG_NET_BLOCK_F32 && size % sizeof(f32) != 0)
+        return -1;
+
+    // Floats are read in place from snapshots, keep them aligned
+    usize offset = net->snapshot_size;
+    if(type == QG_NET_BLOCK_F32)
+        offset = (offset + sizeof(f32) - 1) & ~(sizeof(f32) - 1);
+
+    if(offset + size > QG_NET_SNAPSHOT_MAX)
+        return -1;
+
+    QGNetBlock* block = &net->blocks[net->block_count];
+    block->data = data;
+    block->offset = offset;
+    block->size = size;
+    block->type = type;
+
+    net->snapshot_size = offset + size;
+    return net->block_count++;
+}
+
+/**
+ * @brief Lets unknown senders become peers, for the hosting end
+ *
+ * @param net Endpoint
+ * @param accept Accept new peers
+ */
+void QuickGame_Net_Accept(QGNet_t net, bool accept) {
+    if(!net)
+        return;
+
+    net->accept = accept;
+}
+
+static i32 add_peer(QGNet_t net, const QGNetAddress* address, u8 state) {
+    for(i32 i = 0; i < QG_NET_MAX_PEERS; i++) {
+        QGNetPeer* peer = &net->peers[i];
+        if(peer->state != QG_NET_PEER_FREE)
+            continue;
+
+        memset(peer, 0, sizeof(QGNetPeer));
+        peer->state = state;
+        peer->address = *address;
+        peer->last_heard = net_time(net);
+        peer->window_start = peer->last_heard;
+        return i;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Adds a peer, snapshots are sent to it from the next tick
+ *
+ * @param net Endpoint
+ * @param address Peer address
+ * @return i32 Peer index or < 0 if there are QG_NET_MAX_PEERS peers
+ */
+i32 QuickGame_Net_Connect(QGNet_t net, const QGNetAddress* address) {
+    if(!net || !address)
+        return -1;
+
+    return add_peer(net, address, QG_NET_PEER_CONNECTING);
+}
+
+/**
+ * @brief Removes a peer
+ *
+ * @param net Endpoint
+ * @param peer Peer index
+ */
+void QuickGame_Net_Disconnect(QGNet_t net, i32 peer) {
+    if(!net || peer < 0 || peer >= QG_NET_MAX_PEERS)
+        return;
+
+    net->peers[peer].state = QG_NET_PEER_FREE;
+}
+
+/**
+ * @brief Encodes current as its XOR with base, zero runs and literal runs prefixed by a length byte
+ *
+ * @param base Baseline, NULL for all zero
+ * @param current State to encode
+ * @param size Size of both in bytes
+ * @param out Encoded bytes
+ * @param capacity Size of out, size + size / 128 + 1 always fits
+ * @return i32 Encoded size or < 0 if out is too small
+ */
+i32 QuickGame_Net_Delta_Encode(const u8* base, const u8* current, usize size, u8* out, usize capacity) {
+    // Run byte: high bit set for (low bits + 1) unchanged bytes, clear for (low bits + 1) literal bytes
+    #define DELTA(i) (base ? current[i] ^ base[i] : current[i])
+
+    usize i = 0, o = 0;
+    while(i < size) {
+        usize run = 0;
+        while(i + run < size && run < 128 && DELTA(i + run) == 0)
+            run++;
+
+        if(run > 0) {
+            if(o + 1 > capacity)
+                return -1;
+
+            out[o++] = 0x80 | (run - 1);
+            i += run;
+            continue;
+        }
+
+        // A lone unchanged byte is cheaper inside the literal than ending it
+        while(i + run < size && run < 128) {
+            if(DELTA(i + run) == 0 && (i + run + 1 >= size || DELTA(i + run + 1) == 0))
+                break;
+            run++;
+        }
+
+        if(o + 1 + run > capacity)
+            return -1;
+
+        out[o++] = run - 1;
+        for(usize k = 0; k < run; k++)
+            out[o++] = DELTA(i + k);
+        i += run;
+    }
+
+    #undef DELTA
+    return o;
+}
+
+/**
+ * @brief Decodes a delta produced by QuickGame_Net_Delta_Encode()
+ *
+ * @param base Baseline, NULL for all zero
+ * @param in Encoded bytes
+ * @param length Encoded size
+ * @param out Decoded state, may not alias base
+ * @param size Size of base and out
+ * @return i32 < 0 if the delta is malformed or does not decode to size bytes
+ */
+i32 QuickGame_Net_Delta_Decode(const u8* base, const u8* in, usize length, u8* out, usize size) {
+    usize i = 0, o = 0;
+    while(i < length) {
+        u8 c = in[i++];
+        usize run = (c & 0x7F) + 1;
+        if(o + run > size)
+            return -1;
+
+        if(c & 0x80) {
+            if(base)
+                memcpy(out + o, base + o, run);
+            else
+                memset(out + o, 0, run);
+        } else {
+            if(i + run > length)
+                return -1;
+
+            if(base) {
+                for(usize k = 0; k < run; k++)
+                    out[o + k] = in[i + k] ^ base[o + k];
+            } else {
+                memcpy(out + o, in + i, run);
+            }
+            i += run;
+        }
+
+        o += run;
+    }
+
+    return o == size ? 0 : -1;
+}
+
+static void update_window(QGNetPeer* peer, u32 now) {
+    u32 elapsed = now - peer->window_start;
+    if(elapsed < QG_NET_STATS_WINDOW_MS)
+        return;
+
+    peer->stats.bytes_in_per_second = peer->window_in * 1000.0f / elapsed;
+    peer->stats.bytes_out_per_second = peer->window_out * 1000.0f / elapsed;
+    peer->window_in = 0;
+    peer->window_out = 0;
+    peer->window_start = now;
+}
+
+static void send_snapshot(QGNet_t net, QGNetPeer* peer, const QGNetSnapshot* snapshot, u32 now) {
+    u8 packet[QG_NET_PACKET_MAX];
+
+    // Deltas are only taken against a snapshot the peer has, and that we still have
+    const u8* base = NULL;
+    u32 baseline = 0;
+    if(peer->acked != 0 && snapshot->tick - peer->acked < QG_NET_HISTORY) {
+        const QGNetSnapshot* acked = &net->history[peer->acked % QG_NET_HISTORY];
+        if(acked->tick == peer->acked) {
+            base = acked->data;
+            baseline = peer->acked;
+        }
+    }
+
+    i32 length = QuickGame_Net_Delta_Encode(base, snapshot->data, net->snapshot_size,
+                                            packet + QG_NET_HEADER_SIZE, QG_NET_PACKET_MAX - QG_NET_HEADER_SIZE);
+    if(length < 0)
+        return;
+
+    u32 hold = peer->echo_time != 0 ? now - peer->echo_arrival : 0;
+
+    put_u16(packet, QG_NET_MAGIC);
+    packet[2] = QG_NET_VERSION;
+    packet[3] = 0;
+    put_u32(packet + 4, snapshot->tick);
+    put_u32(packet + 8, baseline);
+    put_u32(packet + 12, peer->received);
+    put_u32(packet + 16, now);
+    put_u32(packet + 20, peer->echo_time);
+    put_u16(packet + 24, hold > 0xFFFF ? 0xFFFF : hold);
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(peer->address.port);
+    addr.sin_addr.s_addr = htonl(peer->address.ip);
+
+    usize size = QG_NET_HEADER_SIZE + length;
+    if(sendto(net->socket, packet, size, 0, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+        return;
+
+    peer->stats.bytes_out += size;
+    peer->stats.packets_out++;
+    peer->window_out += size;
+    if(base == NULL)
+        peer->stats.full_snapshots++;
+}
+
+static void take_snapshot(QGNet_t net, u32 tick) {
+    QGNetSnapshot* snapshot = &net->history[tick % QG_NET_HISTORY];
+    snapshot->tick = tick;
+
+    for(usize i = 0; i < net->block_count; i++) {
+        QGNetBlock* block = &net->blocks[i];
+        memcpy(snapshot->data + block->offset, block->data, block->size);
+    }
+
+    u32 now = net_time(net);
+    for(usize i = 0; i < QG_NET_MAX_PEERS; i++) {
+        if(net->peers[i].state != QG_NET_PEER_FREE)
+            send_snapshot(net, &net->peers[i], snapshot, now);
+    }
+}
+
+static QGNetPeer* find_peer(QGNet_t net, const QGNetAddress* address) {
+    for(usize i = 0; i < QG_NET_MAX_PEERS; i++) {
+        QGNetPeer* peer = &net->peers[i];
+        if(peer->state != QG_NET_PEER_FREE && peer->address.ip == address->ip && peer->address.port == address->port)
+            return peer;
+    }
+
+    if(!net->accept)
+        return NULL;
+
+    i32 idx = add_peer(net, address, QG_NET_PEER_CONNECTED);
+    return idx < 0 ? NULL : &net->peers[idx];
+}
+
+static void receive_packet(QGNet_t net, QGNetPeer* peer, const u8* packet, usize size, u32 now) {
+    peer->stats.bytes_in += size;
+    peer->stats.packets_in++;
+    peer->window_in += size;
+
+    QGNetHeader header;
+    header.tick = get_u32(packet + 4);
+    header.baseline = get_u32(packet + 8);
+    header.ack = get_u32(packet + 12);
+    header.time = get_u32(packet + 16);
+    header.echo = get_u32(packet + 20);
+    header.hold = get_u16(packet + 24);
+
+    if(header.tick == 0 || header.baseline >= header.tick) {
+        peer->stats.packets_dropped++;
+        return;
+    }
+
+    peer->state = QG_NET_PEER_CONNECTED;
+    peer->last_heard = now;
+
+    // Acks can arrive out of order, only move forward and never past what we sent
+    if(header.ack > peer->acked && header.ack <= net->tick)
+        peer->acked = header.ack;
+
+    if(header.echo != 0) {
+        u32 elapsed = now - header.echo;
+        if(elapsed >= header.hold && elapsed - header.hold < net->timeout_ms) {
+            f32 sample = elapsed - header.hold;
+            if(peer->stats.rtt == 0.0f) {
+                peer->stats.rtt = sample;
+                peer->stats.rtt_variance = sample / 2.0f;
+            } else {
+                f32 error = sample - peer->stats.rtt;
+                peer->stats.rtt_variance += ((error < 0 ? -error : error) - peer->stats.rtt_variance) / 4.0f;
+                peer->stats.rtt += error / 8.0f;
+            }
+        }
+    }
+
+    if(header.tick <= peer->received) {
+        peer->stats.packets_dropped++;
+        return;
+    }
+
+    peer->echo_time = header.time;
+    peer->echo_arrival = now;
+
+    const u8* base = NULL;
+    if(header.baseline != 0) {
+        const QGNetSnapshot* baseline = &peer->history[header.baseline % QG_NET_HISTORY];
+        if(baseline->tick != header.baseline || header.tick - header.baseline >= QG_NET_HISTORY) {
+            peer->stats.packets_dropped++;
+            return;
+        }
+        base = baseline->data;
+    }
+
+    QGNetSnapshot* snapshot = &peer->history[header.tick % QG_NET_HISTORY];
+    if(QuickGame_Net_Delta_Decode(base, packet + QG_NET_HEADER_SIZE, size - QG_NET_HEADER_SIZE,
+                                  snapshot->data, net->snapshot_size) < 0) {
+        snapshot->tick = 0;
+        peer->stats.packets_dropped++;
+        return;
+    }
+
+    if(peer->received != 0 && header.tick > peer->received + 1)
+        peer->stats.packets_lost += header.tick - peer->received - 1;
+
+    snapshot->tick = header.tick;
+    snapshot->arrival = now;
+    peer->received = header.tick;
+}
+
+static void receive_all(QGNet_t net) {
+    u8 packet[QG_NET_PACKET_MAX];
+
+    while(true) {
+        struct sockaddr_in addr;
+        socklen_t length = sizeof(addr);
+        i32 size = recvfrom(net->socket, packet, sizeof(packet), 0, (struct sockaddr*)&addr, &length);
+        if(size < 0)
+            break;
+
+        if(size < QG_NET_HEADER_SIZE || get_u16(packet) != QG_NET_MAGIC || packet[2] != QG_NET_VERSION)
+            continue;
+
+        QGNetAddress address = { .ip = ntohl(addr.sin_addr.s_addr), .port = ntohs(addr.sin_port) };
+        QGNetPeer* peer = find_peer(net, &address);
+        if(peer)
+            receive_packet(net, peer, packet, size, net_time(net));
+    }
+}
+
+/**
+ * @brief Receives pending packets, then sends a snapshot if a tick elapsed. Peers that
+ * were not heard from for the timeout are removed. Call once per frame.
+ *
+ * @param net Endpoint
+ * @return i32 1 if a snapshot was sent. Ticks missed during a long frame are skipped, not sent one by one.
+ */
+i32 QuickGame_Net_Update(QGNet_t net) {
+    if(!net)
+        return 0;
+
+    receive_all(net);
+
+    u32 now = net_time(net);
+    for(usize i = 0; i < QG_NET_MAX_PEERS; i++) {
+        QGNetPeer* peer = &net->peers[i];
+        if(peer->state == QG_NET_PEER_FREE)
+            continue;
+
+        if(now - peer->last_heard > net->timeout_ms) {
+            peer->state = QG_NET_PEER_FREE;
+            continue;
+        }
+
+        update_window(peer, now);
+    }
+
+    if((i32)(now - net->next_tick) < 0)
+        return 0;
+
+    u32 elapsed = (now - net->next_tick) / net->tick_ms + 1;
+    net->next_tick += elapsed * net->tick_ms;
+    net->tick += elapsed;
+    take_snapshot(net, net->tick);
+    return 1;
+}
+
+/**
+ * @brief Takes a snapshot and sends it to every peer now, outside of the tick schedule
+ *
+ * @param net Endpoint
+ */
+void QuickGame_Net_Send(QGNet_t net) {
+    if(!net)
+        return;
+
+    net->tick++;
+    take_snapshot(net, net->tick);
+}
+
+/**
+ * @brief Reads a block of a peer's state, interpolated at interp_ticks behind the newest snapshot.
+ * F32 blocks are blended between the two snapshots around that time, raw blocks come from the older one.
+ *
+ * @param net Endpoint
+ * @param peer Peer index
+ * @param block Block index
+ * @param out Destination, the size of the block -- may be the registered data
+ * @return i32 < 0 if nothing was received from the peer yet
+ */
+i32 QuickGame_Net_Read(QGNet_t net, i32 peer, i32 block, anyopaque* out) {
+    if(!net || !out || peer < 0 || peer >= QG_NET_MAX_PEERS || block < 0 || block >= (i32)net->block_count)
+        return -1;
+
+    QGNetPeer* p = &net->peers[peer];
+    if(p->state == QG_NET_PEER_FREE || p->received == 0)
+        return -1;
+
+    // Play back at the peer's current tick, estimated from the newest arrival, minus the delay
+    const QGNetSnapshot* newest = &p->history[p->received % QG_NET_HISTORY];
+    f32 target = (f32)p->received + (f32)(net_time(net) - newest->arrival) / net->tick_ms - net->interp_ticks;
+
+    const QGNetSnapshot* older = NULL;
+    const QGNetSnapshot* newer = NULL;
+    for(usize i = 0; i < QG_NET_HISTORY; i++) {
+        const QGNetSnapshot* s = &p->history[i];
+        if(s->tick == 0)
+            continue;
+
+        if((f32)s->tick <= target) {
+            if(!older || s->tick > older->tick)
+                older = s;
+        } else if(!newer || s->tick < newer->tick) {
+            newer = s;
+        }
+    }
+
+    const QGNetBlock* b = &net->blocks[block];
+    if(!older || !newer || b->type != QG_NET_BLOCK_F32) {
+        const QGNetSnapshot* s = older ? older : newer;
+        memcpy(out, s->data + b->offset, b->size);
+        return 0;
+    }
+
+    f32 t = (target - older->tick) / (f32)(newer->tick - older->tick);
+    const f32* from = (const f32*)(older->data + b->offset);
+    const f32* to = (const f32*)(newer->data + b->offset);
+    f32* result = out;
+    for(usize i = 0; i < b->size / sizeof(f32); i++)
+        result[i] = from[i] + (to[i] - from[i]) * t;
+
+    return 0;
+}
+
+/**
+ * @brief Sets how far behind the newest snapshot reads play back. More ticks hide more jitter and loss.
+ *
+ * @param net Endpoint
+ * @param ticks Ticks of delay
+ */
+void QuickGame_Net_Set_Interpolation(QGNet_t net, u32 ticks) {
+    if(!net)
+        return;
+
+    net->interp_ticks = ticks;
+}
+
+/**
+ * @brief Sets the time after which a silent peer is removed
+ *
+ * @param net Endpoint
+ * @param timeout_ms Milliseconds
+ */
+void QuickGame_Net_Set_Timeout(QGNet_t net, u32 timeout_ms) {
+    if(!net)
+        return;
+
+    net->timeout_ms = timeout_ms;
+}
+
+/**
+ * @brief Gets a peer
+ *
+ * @param net Endpoint
+ * @param peer Peer index
+ * @return QGNetPeer* Peer or NULL if the slot is free
+ */
+QGNetPeer* QuickGame_Net_Peer(QGNet_t net, i32 peer) {
+    if(!net || peer < 0 || peer >= QG_NET_MAX_PEERS || net->peers[peer].state == QG_NET_PEER_FREE)
+        return NULL;
+
+    return &net->peers[peer];
+}
+
+/**
+ * @brief Gets the round trip time, bandwidth and loss of a peer
+ *
+ * @param net Endpoint
+ * @param peer Peer index
+ * @return const QGNetStats* Stats or NULL if the slot is free
+ */
+const QGNetStats* QuickGame_Net_Stats(QGNet_t net, i32 peer) {
+    QGNetPeer* p = QuickGame_Net_Peer(net, peer);
+    return p ? &p->stats : NULL;
+}
+
+/**
+ * @brief Closes the endpoint
+ *
+ * @param net Endpoint to destroy -- also gets set to null.
+ */
+void QuickGame_Net_Destroy(QGNet_t* net) {
+    if(!net || !*net)
+        return;
+
+    close((*net)->socket);
+    QuickGame_Destroy(*net);
+    *net = NULL;
+}
@@ -0,0 +1,198 @@
+#include <QuickGame.h>
+#include <NineSlice.h>
+#include <stddef.h>
+#include <gu2gl.h>
+#include <pspkernel.h>
+
+static QGNineSlice_t create_slice(QGVector2 position, QGVector2 size, QGTexture_t texture, const f32* uv, QGInsets insets) {
+    QGNineSlice_t slice = (QGNineSlice_t)QuickGame_Allocate(sizeof(QGNineSlice));
+    if(slice == NULL)
+        return NULL;
+
+    slice->mesh = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_TEXTURED, 16, 54);
+    if(slice->mesh == NULL) {
+        QuickGame_Destroy(slice);
+        return NULL;
+    }
+
+    slice->transform.position = position;
+    slice->transform.scale = size;
+    slice->color.color = 0xFFFFFFFF;
+    slice->texture = texture;
+    slice->insets = insets;
+    for(usize i = 0; i < QG_ATLAS_UV_STRIDE; i++)
+        slice->uv[i] = uv[i];
+
+    // Texture coordinates never change, the borders are fixed in texels
+    f32 du = (uv[2] >= uv[0] ? 1.0f : -1.0f) / (f32)texture->pWidth;
+    f32 dv = (uv[3] >= uv[1] ? 1.0f : -1.0f) / (f32)texture->pHeight;
+    f32 us[4] = {uv[0], uv[0] + insets.left * du, uv[2] - insets.right * du, uv[2]};
+    f32 vs[4] = {uv[1], uv[1] + insets.bottom * dv, uv[3] - insets.top * dv, uv[3]};
+
+    QGTexturedVertex* verts = slice->mesh->data;
+    u16* indices = slice->mesh->indices;
+
+    for(usize row = 0; row < 4; row++) {
+        for(usize col = 0; col < 4; col++) {
+            verts[col + row * 4].u = us[col];
+            verts[col + row * 4].v = vs[row];
+            verts[col + row * 4].z = 0.0f;
+        }
+    }
+
+    for(usize row = 0; row < 3; row++) {
+        for(usize col = 0; col < 3; col++) {
+            u16 a = col + row * 4;
+            u16* idx = &indices[(col + row * 3) * 6];
+
+            idx[0] = a;
+            idx[1] = a + 1;
+            idx[2] = a + 5;
+            idx[3] = a + 5;
+            idx[4] = a + 4;
+            idx[5] = a;
+        }
+    }
+
+    // Forces the first update to write the positions
+    slice->built_size.x = -1.0f;
+    QuickGame_Nine_Slice_Update(slice);
+
+    return slice;
+}
+
+/**
+ * @brief Creates a nine-slice from a region of a texture
+ *
+ * @param position Center of the panel
+ * @param size Size of the panel in pixels
+ * @param texture Texture to use
+ * @param x Left of the region in pixels
+ * @param y Top of the region in pixels
+ * @param w Width of the region in pixels
+ * @param h Height of the region in pixels
+ * @param insets Border sizes in texels
+ * @return QGNineSlice_t Nine-slice or NULL on failure
+ */
+QGNineSlice_t QuickGame_Nine_Slice_Create(QGVector2 position, QGVector2 size, QGTexture_t texture, f32 x, f32 y, f32 w, f32 h, QGInsets insets) {
+    if(texture == NULL)
+        return NULL;
+
+    // Same orientation as sprites, the bottom of the region is the bottom of the quad
+    f32 uv[QG_ATLAS_UV_STRIDE] = {
+        x / (f32)texture->pWidth,
+        (y + h) / (f32)texture->pHeight,
+        (x + w) / (f32)texture->pWidth,
+        y / (f32)texture->pHeight
+    };
+
+    return create_slice(position, size, texture, uv, insets);
+}
+
+/**
+ * @brief Creates a nine-slice from a tile of an atlas
+ *
+ * @param position Center of the panel
+ * @param size Size of the panel in pixels
+ * @param atlas Atlas to take the tile from, its texture is used
+ * @param idx Index of the tile in the atlas
+ * @param insets Border sizes in texels
+ * @return QGNineSlice_t Nine-slice or NULL on failure
+ */
+QGNineSlice_t QuickGame_Nine_Slice_Create_Atlas(QGVector2 position, QGVector2 size, QGAtlas_t atlas, usize idx, QGInsets insets) {
+    const f32* uv = QuickGame_Atlas_UV(atlas, idx);
+    if(uv == NULL || atlas->texture == NULL)
+        return NULL;
+
+    return create_slice(position, size, atlas->texture, uv, insets);
+}
+
+/**
+ * @brief Rebuilds the vertex positions if the size changed since the last build.
+ * Borders shrink evenly when the panel is smaller than them.
+ *
+ * @param slice Nine-slice
+ */
+void QuickGame_Nine_Slice_Update(QGNineSlice_t slice) {
+    if(slice == NULL)
+        return;
+
+    QGVector2 size = slice->transform.scale;
+    if(size.x == slice->built_size.x && size.y == slice->built_size.y)
+        return;
+
+    f32 w = size.x;
+    f32 h = size.y;
+    f32 left = slice->insets.left;
+    f32 right = slice->insets.right;
+    f32 bottom = slice->insets.bottom;
+    f32 top = slice->insets.top;
+
+    if(left + right > w && left + right > 0.0f) {
+        f32 k = w / (left + right);
+        left *= k;
+        right *= k;
+    }
+
+    if(bottom + top > h && bottom + top > 0.0f) {
+        f32 k = h / (bottom + top);
+        bottom *= k;
+        top *= k;
+    }
+
+    f32 xs[4] = {-w * 0.5f, -w * 0.5f + left, w * 0.5f - right, w * 0.5f};
+    f32 ys[4] = {-h * 0.5f, -h * 0.5f + bottom, h * 0.5f - top, h * 0.5f};
+
+    QGTexturedVertex* verts = slice->mesh->data;
+    for(usize row = 0; row < 4; row++) {
+        for(usize col = 0; col < 4; col++) {
+            verts[col + row * 4].x = xs[col];
+            verts[col + row * 4].y = ys[row];
+        }
+    }
+
+    sceKernelDcacheWritebackRange(verts, sizeof(QGTexturedVertex) * 16);
+    sceKernelDcacheWritebackRange(slice->mesh->indices, sizeof(u16) * 54);
+    slice->built_size = size;
+}
+
+/**
+ * @brief Draws a nine-slice, updating it first. Off screen panels are culled.
+ *
+ * @param slice Nine-slice to draw
+ */
+void QuickGame_Nine_Slice_Draw(QGNineSlice_t slice) {
+    if(slice == NULL || QuickGame_Graphics_Cull(slice->transform))
+        return;
+
+    QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_SPRITE, slice->transform);
+    QuickGame_Nine_Slice_Update(slice);
+
+    glMatrixMode(GL_MODEL);
+    glLoadIdentity();
+
+    ScePspFVector3 v1 = {slice->transform.position.x, slice->transform.position.y, slice->layer};
+    gluTranslate(&v1);
+
+    gluRotateZ(slice->transform.rotation / 180.0f * GL_PI);
+
+    glColor(slice->color.color);
+
+    QuickGame_Texture_Bind(slice->texture);
+    QuickGame_Graphics_Draw_Mesh(slice->mesh);
+    QuickGame_Texture_Unbind();
+}
+
+/**
+ * @brief Destroys a nine-slice
+ *
+ * @param slice Nine-slice to destroy -- also gets set to null.
+ */
+void QuickGame_Nine_Slice_Destroy(QGNineSlice_t* slice) {
+    if(slice == NULL || (*slice) == NULL)
+        return;
+
+    QuickGame_Graphics_Destroy_Mesh(&(*slice)->mesh);
+    QuickGame_Destroy(*slice);
+    *slice = NULL;
+}
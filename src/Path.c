@@ -0,0 +1,547 @@
+#include <QuickGame.h>
+#include <Path.h>
+#include <stddef.h>
+#include <string.h>
+#include <float.h>
+
+#define SQRT2 1.41421356f
+#define UNREACHABLE FLT_MAX
+
+static const i8 dir_x[8] = { 1, -1, 0,  0, 1, -1,  1, -1 };
+static const i8 dir_y[8] = { 0,  0, 1, -1, 1,  1, -1, -1 };
+
+static inline bool walkable(QGPathfinder_t pf, i32 x, i32 y) {
+    return x >= 0 && y >= 0 && x < (i32)pf->width && y < (i32)pf->height && pf->walkable[x + y * pf->width];
+}
+
+static inline bool can_step(QGPathfinder_t pf, i32 x, i32 y, i32 dx, i32 dy) {
+    if(!walkable(pf, x + dx, y + dy))
+        return false;
+
+    // Diagonal moves may not cut a blocked corner
+    return dx == 0 || dy == 0 || (walkable(pf, x + dx, y) && walkable(pf, x, y + dy));
+}
+
+static inline f32 octile(i32 dx, i32 dy) {
+    if(dx < 0) dx = -dx;
+    if(dy < 0) dy = -dy;
+    i32 lo = dx < dy ? dx : dy;
+    i32 hi = dx < dy ? dy : dx;
+    return (f32)lo * SQRT2 + (f32)(hi - lo);
+}
+
+static inline i32 sign(i32 v) {
+    return (v > 0) - (v < 0);
+}
+
+/**
+ * Indexed binary min-heap over cell indices, ordered by key[cell]
+ */
+static void heap_sift_up(QGPathfinder_t pf, const f32* key, u32 pos) {
+    u32 node = pf->heap[pos];
+    while(pos > 0) {
+        u32 up = (pos - 1) / 2;
+        if(key[pf->heap[up]] <= key[node])
+            break;
+
+        pf->heap[pos] = pf->heap[up];
+        pf->heap_index[pf->heap[pos]] = pos;
+        pos = up;
+    }
+    pf->heap[pos] = node;
+    pf->heap_index[node] = pos;
+}
+
+static void heap_sift_down(QGPathfinder_t pf, const f32* key, u32 pos) {
+    u32 node = pf->heap[pos];
+    for(;;) {
+        u32 child = pos * 2 + 1;
+        if(child >= pf->heap_count)
+            break;
+        if(child + 1 < pf->heap_count && key[pf->heap[child + 1]] < key[pf->heap[child]])
+            child++;
+        if(key[node] <= key[pf->heap[child]])
+            break;
+
+        pf->heap[pos] = pf->heap[child];
+        pf->heap_index[pf->heap[pos]] = pos;
+        pos = child;
+    }
+    pf->heap[pos] = node;
+    pf->heap_index[node] = pos;
+}
+
+static void heap_push(QGPathfinder_t pf, const f32* key, u32 node) {
+    pf->heap[pf->heap_count] = node;
+    heap_sift_up(pf, key, pf->heap_count++);
+}
+
+static u32 heap_pop(QGPathfinder_t pf, const f32* key) {
+    u32 top = pf->heap[0];
+    if(--pf->heap_count > 0) {
+        pf->heap[0] = pf->heap[pf->heap_count];
+        heap_sift_down(pf, key, 0);
+    }
+    return top;
+}
+
+static void begin_query(QGPathfinder_t pf) {
+    pf->heap_count = 0;
+    pf->generation++;
+
+    // Stamps wrapped around, old values could look current
+    if(pf->generation == 0) {
+        memset(pf->stamp, 0, sizeof(u16) * pf->width * pf->height);
+        memset(pf->closed, 0, sizeof(u16) * pf->width * pf->height);
+        pf->generation = 1;
+    }
+}
+
+/**
+ * @brief Creates a pathfinder for a tilemap and reads its collision data
+ *
+ * @param tilemap Tilemap to navigate -- must outlive the pathfinder
+ * @return QGPathfinder_t Pathfinder or NULL on failure
+ */
+QGPathfinder_t QuickGame_Path_Create(QGTilemap_t tilemap) {
+    if(tilemap == NULL)
+        return NULL;
+
+    QGPathfinder_t pf = (QGPathfinder_t)QuickGame_Allocate(sizeof(QGPathfinder));
+    if(pf == NULL)
+        return NULL;
+
+    pf->tilemap = tilemap;
+    pf->width = tilemap->size.x;
+    pf->height = tilemap->size.y;
+
+    usize n = pf->width * pf->height;
+    pf->walkable = (u8*)QuickGame_Allocate(n);
+    pf->heap = (u32*)QuickGame_Allocate(sizeof(u32) * n);
+    pf->heap_index = (u32*)QuickGame_Allocate(sizeof(u32) * n);
+    pf->g = (f32*)QuickGame_Allocate(sizeof(f32) * n);
+    pf->f = (f32*)QuickGame_Allocate(sizeof(f32) * n);
+    pf->parent = (u32*)QuickGame_Allocate(sizeof(u32) * n);
+    pf->stamp = (u16*)QuickGame_Allocate(sizeof(u16) * n);
+    pf->closed = (u16*)QuickGame_Allocate(sizeof(u16) * n);
+    pf->flow_cost = (f32*)QuickGame_Allocate(sizeof(f32) * n);
+    pf->flow = (u8*)QuickGame_Allocate(n);
+
+    if(n == 0 || !pf->walkable || !pf->heap || !pf->heap_index || !pf->g || !pf->f || !pf->parent ||
+       !pf->stamp || !pf->closed || !pf->flow_cost || !pf->flow) {
+        QuickGame_Path_Destroy(&pf);
+        return NULL;
+    }
+
+    QuickGame_Path_Refresh(pf);
+    return pf;
+}
+
+/**
+ * @brief Re-reads the collision data of a single tile, invalidating cached results only if it changed
+ *
+ * @param pathfinder Pathfinder
+ * @param x Column of the tile
+ * @param y Row of the tile
+ */
+void QuickGame_Path_Update_Tile(QGPathfinder_t pathfinder, usize x, usize y) {
+    if(pathfinder == NULL || x >= pathfinder->width || y >= pathfinder->height)
+        return;
+
+    usize idx = x + y * pathfinder->width;
+    u8 open = !pathfinder->tilemap->tile_array[idx].collide;
+    if(open == pathfinder->walkable[idx])
+        return;
+
+    pathfinder->walkable[idx] = open;
+    if(!pathfinder->flow_valid)
+        return;
+
+    // A blocked tile matters if the field went through it, an opened one if it touches the field
+    if(!open) {
+        if(pathfinder->flow_cost[idx] != UNREACHABLE)
+            pathfinder->flow_valid = false;
+        return;
+    }
+
+    for(usize d = 0; d < 8; d++) {
+        i32 nx = (i32)x + dir_x[d];
+        i32 ny = (i32)y + dir_y[d];
+        if(walkable(pathfinder, nx, ny) && pathfinder->flow_cost[nx + ny * pathfinder->width] != UNREACHABLE) {
+            pathfinder->flow_valid = false;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Re-reads the collision data of every tile
+ *
+ * @param pathfinder Pathfinder
+ */
+void QuickGame_Path_Refresh(QGPathfinder_t pathfinder) {
+    if(pathfinder == NULL)
+        return;
+
+    usize n = pathfinder->width * pathfinder->height;
+    for(usize i = 0; i < n; i++)
+        pathfinder->walkable[i] = !pathfinder->tilemap->tile_array[i].collide;
+
+    pathfinder->flow_valid = false;
+}
+
+static bool jump_straight(QGPathfinder_t pf, i32 x, i32 y, i32 dx, i32 dy, i32 gx, i32 gy, bool turn) {
+    for(;;) {
+        if(!walkable(pf, x, y))
+            return false;
+        if(x == gx && y == gy)
+            return true;
+
+        if(dx != 0) {
+            if((walkable(pf, x, y - 1) && !walkable(pf, x - dx, y - 1)) ||
+               (walkable(pf, x, y + 1) && !walkable(pf, x - dx, y + 1)))
+                return true;
+        } else {
+            if((walkable(pf, x - 1, y) && !walkable(pf, x - 1, y - dy)) ||
+               (walkable(pf, x + 1, y) && !walkable(pf, x + 1, y - dy)))
+                return true;
+
+            // Without corner cutting, vertical runs must also look for horizontal jump points
+            if(turn && (jump_straight(pf, x + 1, y, 1, 0, gx, gy, false) || jump_straight(pf, x - 1, y, -1, 0, gx, gy, false)))
+                return true;
+        }
+
+        x += dx;
+        y += dy;
+    }
+}
+
+static bool jump(QGPathfinder_t pf, i32 x, i32 y, i32 dx, i32 dy, i32 gx, i32 gy, i32* ox, i32* oy) {
+    if(dx == 0 || dy == 0) {
+        // Straight jumps report the first point they stop at
+        for(;;) {
+            if(!walkable(pf, x, y))
+                return false;
+            if(x == gx && y == gy)
+                break;
+
+            bool forced;
+            if(dx != 0) {
+                forced = (walkable(pf, x, y - 1) && !walkable(pf, x - dx, y - 1)) ||
+                         (walkable(pf, x, y + 1) && !walkable(pf, x - dx, y + 1));
+            } else {
+                forced = (walkable(pf, x - 1, y) && !walkable(pf, x - 1, y - dy)) ||
+                         (walkable(pf, x + 1, y) && !walkable(pf, x + 1, y - dy)) ||
+                         jump_straight(pf, x + 1, y, 1, 0, gx, gy, false) ||
+                         jump_straight(pf, x - 1, y, -1, 0, gx, gy, false);
+            }
+            if(forced)
+                break;
+
+            x += dx;
+            y += dy;
+        }
+    } else {
+        for(;;) {
+            if(!walkable(pf, x, y))
+                return false;
+            if(x == gx && y == gy)
+                break;
+
+            if(jump_straight(pf, x + dx, y, dx, 0, gx, gy, true) || jump_straight(pf, x, y + dy, 0, dy, gx, gy, true))
+                break;
+
+            if(!walkable(pf, x + dx, y) || !walkable(pf, x, y + dy))
+                return false;
+
+            x += dx;
+            y += dy;
+        }
+    }
+
+    *ox = x;
+    *oy = y;
+    return true;
+}
+
+static usize find_neighbours(QGPathfinder_t pf, u32 node, i32* nx, i32* ny) {
+    i32 x = node % pf->width;
+    i32 y = node / pf->width;
+    usize count = 0;
+
+    u32 p = pf->parent[node];
+    if(p == node) {
+        for(usize d = 0; d < 8; d++) {
+            if(can_step(pf, x, y, dir_x[d], dir_y[d])) {
+                nx[count] = x + dir_x[d];
+                ny[count] = y + dir_y[d];
+                count++;
+            }
+        }
+        return count;
+    }
+
+    i32 dx = sign(x - (i32)(p % pf->width));
+    i32 dy = sign(y - (i32)(p / pf->width));
+
+    #define PUSH(a, b) do { nx[count] = (a); ny[count] = (b); count++; } while(0)
+
+    if(dx != 0 && dy != 0) {
+        bool vertical = walkable(pf, x, y + dy);
+        bool horizontal = walkable(pf, x + dx, y);
+        if(vertical) PUSH(x, y + dy);
+        if(horizontal) PUSH(x + dx, y);
+        if(vertical && horizontal && walkable(pf, x + dx, y + dy)) PUSH(x + dx, y + dy);
+    } else if(dx != 0) {
+        bool next = walkable(pf, x + dx, y);
+        bool top = walkable(pf, x, y + 1);
+        bool bottom = walkable(pf, x, y - 1);
+        if(next) {
+            PUSH(x + dx, y);
+            if(top && walkable(pf, x + dx, y + 1)) PUSH(x + dx, y + 1);
+            if(bottom && walkable(pf, x + dx, y - 1)) PUSH(x + dx, y - 1);
+        }
+        if(top) PUSH(x, y + 1);
+        if(bottom) PUSH(x, y - 1);
+    } else {
+        bool next = walkable(pf, x, y + dy);
+        bool right = walkable(pf, x + 1, y);
+        bool left = walkable(pf, x - 1, y);
+        if(next) {
+            PUSH(x, y + dy);
+            if(right && walkable(pf, x + 1, y + dy)) PUSH(x + 1, y + dy);
+            if(left && walkable(pf, x - 1, y + dy)) PUSH(x - 1, y + dy);
+        }
+        if(right) PUSH(x + 1, y);
+        if(left) PUSH(x - 1, y);
+    }
+
+    #undef PUSH
+    return count;
+}
+
+/**
+ * @brief Finds a path with A* and jump point search
+ *
+ * @param pathfinder Pathfinder
+ * @param start Start tile
+ * @param goal Goal tile
+ * @param out Waypoints from the first jump point to the goal, consecutive waypoints are joined by straight or diagonal lines
+ * @param max Maximum number of waypoints to write
+ * @return i32 Number of waypoints in the full path (may exceed max), 0 if start is the goal, < 0 if there is no path
+ */
+i32 QuickGame_Path_Find(QGPathfinder_t pathfinder, QGVector2 start, QGVector2 goal, QGVector2* out, usize max) {
+    QGPathfinder_t pf = pathfinder;
+    if(pf == NULL)
+        return -1;
+
+    i32 sx = start.x, sy = start.y;
+    i32 gx = goal.x, gy = goal.y;
+    if(!walkable(pf, sx, sy) || !walkable(pf, gx, gy))
+        return -1;
+
+    if(sx == gx && sy == gy)
+        return 0;
+
+    begin_query(pf);
+
+    u32 s = sx + sy * pf->width;
+    u32 target = gx + gy * pf->width;
+
+    pf->g[s] = 0.0f;
+    pf->f[s] = octile(gx - sx, gy - sy);
+    pf->parent[s] = s;
+    pf->stamp[s] = pf->generation;
+    heap_push(pf, pf->f, s);
+
+    i32 nx[8], ny[8];
+
+    while(pf->heap_count > 0) {
+        u32 node = heap_pop(pf, pf->f);
+        pf->closed[node] = pf->generation;
+
+        if(node == target) {
+            i32 count = 0;
+            for(u32 n = target; n != s; n = pf->parent[n])
+                count++;
+
+            i32 k = count;
+            for(u32 n = target; n != s; n = pf->parent[n]) {
+                k--;
+                if(out != NULL && (usize)k < max) {
+                    out[k].x = n % pf->width;
+                    out[k].y = n / pf->width;
+                }
+            }
+            return count;
+        }
+
+        i32 x = node % pf->width;
+        i32 y = node / pf->width;
+        usize neighbours = find_neighbours(pf, node, nx, ny);
+
+        for(usize i = 0; i < neighbours; i++) {
+            i32 jx, jy;
+            if(!jump(pf, nx[i], ny[i], nx[i] - x, ny[i] - y, gx, gy, &jx, &jy))
+                continue;
+
+            u32 j = jx + jy * pf->width;
+            if(pf->closed[j] == pf->generation)
+                continue;
+
+            f32 ng = pf->g[node] + octile(jx - x, jy - y);
+
+            if(pf->stamp[j] != pf->generation) {
+                pf->stamp[j] = pf->generation;
+                pf->g[j] = ng;
+                pf->f[j] = ng + octile(gx - jx, gy - jy);
+                pf->parent[j] = node;
+                heap_push(pf, pf->f, j);
+            } else if(ng < pf->g[j]) {
+                pf->g[j] = ng;
+                pf->f[j] = ng + octile(gx - jx, gy - jy);
+                pf->parent[j] = node;
+                heap_sift_up(pf, pf->f, pf->heap_index[j]);
+            }
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Builds a flow field towards a goal for many agents, does nothing if the cached field is still valid
+ *
+ * @param pathfinder Pathfinder
+ * @param goal Goal tile
+ * @return i32 < 0 on failure, 0 on success
+ */
+i32 QuickGame_Path_Flow_Build(QGPathfinder_t pathfinder, QGVector2 goal) {
+    QGPathfinder_t pf = pathfinder;
+    if(pf == NULL)
+        return -1;
+
+    i32 gx = goal.x, gy = goal.y;
+    if(!walkable(pf, gx, gy))
+        return -1;
+
+    if(pf->flow_valid && pf->flow_goal_x == gx && pf->flow_goal_y == gy)
+        return 0;
+
+    usize n = pf->width * pf->height;
+    for(usize i = 0; i < n; i++)
+        pf->flow_cost[i] = UNREACHABLE;
+    memset(pf->flow, QG_PATH_NO_DIRECTION, n);
+
+    begin_query(pf);
+
+    // Dijkstra outwards from the goal
+    u32 g = gx + gy * pf->width;
+    pf->flow_cost[g] = 0.0f;
+    pf->stamp[g] = pf->generation;
+    heap_push(pf, pf->flow_cost, g);
+
+    while(pf->heap_count > 0) {
+        u32 node = heap_pop(pf, pf->flow_cost);
+        pf->closed[node] = pf->generation;
+
+        i32 x = node % pf->width;
+        i32 y = node / pf->width;
+
+        for(usize d = 0; d < 8; d++) {
+            if(!can_step(pf, x, y, dir_x[d], dir_y[d]))
+                continue;
+
+            u32 next = (x + dir_x[d]) + (y + dir_y[d]) * pf->width;
+            if(pf->closed[next] == pf->generation)
+                continue;
+
+            f32 cost = pf->flow_cost[node] + (d < 4 ? 1.0f : SQRT2);
+            if(pf->stamp[next] != pf->generation) {
+                pf->stamp[next] = pf->generation;
+                pf->flow_cost[next] = cost;
+                heap_push(pf, pf->flow_cost, next);
+            } else if(cost < pf->flow_cost[next]) {
+                pf->flow_cost[next] = cost;
+                heap_sift_up(pf, pf->flow_cost, pf->heap_index[next]);
+            }
+        }
+    }
+
+    // Every reachable tile points at the neighbour it reaches the goal cheapest through, step included
+    for(u32 node = 0; node < n; node++) {
+        if(pf->flow_cost[node] == UNREACHABLE || node == g)
+            continue;
+
+        i32 x = node % pf->width;
+        i32 y = node / pf->width;
+        f32 best = UNREACHABLE;
+
+        for(usize d = 0; d < 8; d++) {
+            if(!can_step(pf, x, y, dir_x[d], dir_y[d]))
+                continue;
+
+            f32 remaining = pf->flow_cost[(x + dir_x[d]) + (y + dir_y[d]) * pf->width];
+            if(remaining == UNREACHABLE)
+                continue;
+
+            f32 cost = remaining + (d < 4 ? 1.0f : SQRT2);
+            if(cost < best) {
+                best = cost;
+                pf->flow[node] = d;
+            }
+        }
+    }
+
+    pf->flow_goal_x = gx;
+    pf->flow_goal_y = gy;
+    pf->flow_valid = true;
+    return 0;
+}
+
+/**
+ * @brief Gets the step to take from a tile to follow the flow field
+ *
+ * @param pathfinder Pathfinder
+ * @param tile Tile the agent is on
+ * @return QGVector2 Step in tiles (each component -1, 0 or 1), zero at the goal or when unreachable
+ */
+QGVector2 QuickGame_Path_Flow_Direction(QGPathfinder_t pathfinder, QGVector2 tile) {
+    QGVector2 step = {0.0f, 0.0f};
+
+    i32 x = tile.x, y = tile.y;
+    if(pathfinder == NULL || !pathfinder->flow_valid || x < 0 || y < 0 || x >= (i32)pathfinder->width || y >= (i32)pathfinder->height)
+        return step;
+
+    u8 d = pathfinder->flow[x + y * pathfinder->width];
+    if(d == QG_PATH_NO_DIRECTION)
+        return step;
+
+    step.x = dir_x[d];
+    step.y = dir_y[d];
+    return step;
+}
+
+/**
+ * @brief Destroys a pathfinder
+ *
+ * @param pathfinder Pathfinder to destroy -- also gets set to null.
+ */
+void QuickGame_Path_Destroy(QGPathfinder_t* pathfinder) {
+    if(pathfinder == NULL || (*pathfinder) == NULL)
+        return;
+
+    QGPathfinder_t pf = *pathfinder;
+    QuickGame_Destroy(pf->walkable);
+    QuickGame_Destroy(pf->heap);
+    QuickGame_Destroy(pf->heap_index);
+    QuickGame_Destroy(pf->g);
+    QuickGame_Destroy(pf->f);
+    QuickGame_Destroy(pf->parent);
+    QuickGame_Destroy(pf->stamp);
+    QuickGame_Destroy(pf->closed);
+    QuickGame_Destroy(pf->flow_cost);
+    QuickGame_Destroy(pf->flow);
+    QuickGame_Destroy(pf);
+    *pathfinder = NULL;
+}
@@ -19,17 +19,24 @@ QGSimpleVertex create_simple_vert(float x, float y, float z){
 }
 
 /**
- * @brief Initialize Primitive Drawings
+ * @brief Initialize Primitive Drawings, does nothing if they are already initialized.
+ * Drawing or queueing the first primitive calls it.
  * 
  * returns int < 0 on failure.
  */
 int QuickGame_Primitive_Init() {
+    if(_quickgame_rect != NULL)
+        return 0;
+
+    u64 start = QuickGame_Boot_Time();
     _quickgame_rect = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_SIMPLE, 4, 6);
     _quickgame_tri = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_SIMPLE, 3, 4);
     _quickgame_circle = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_SIMPLE, 22, 63);
 
-    if(_quickgame_rect == NULL || _quickgame_tri == NULL || _quickgame_circle == NULL)
-        return 0;
+    if(_quickgame_rect == NULL || _quickgame_tri == NULL || _quickgame_circle == NULL) {
+        QuickGame_Primitive_Terminate();
+        return -1;
+    }
 
     ((QGSimpleVertex*)_quickgame_rect->data)[0] = create_simple_vert(-0.5f, -0.5f, 0.0f);
     ((QGSimpleVertex*)_quickgame_rect->data)[1] = create_simple_vert( 0.5f, -0.5f, 0.0f);
@@ -45,8 +52,8 @@ int QuickGame_Primitive_Init() {
 
 
     ((QGSimpleVertex*)_quickgame_tri->data)[0] = create_simple_vert( 0, 0.5f, 0.0f);
-    ((QGSimpleVertex*)_quickgame_tri->data)[1] = create_simple_vert( 0.70f, -0.5f, 0.0f);
-    ((QGSimpleVertex*)_quickgame_tri->data)[2] = create_simple_vert( -0.70f, -0.5f, 0.0f);
+    ((QGSimpleVertex*)_quickgame_tri->data)[1] = create_simple_vert( QG_TRIANGLE_HALF_WIDTH, -0.5f, 0.0f);
+    ((QGSimpleVertex*)_quickgame_tri->data)[2] = create_simple_vert(-QG_TRIANGLE_HALF_WIDTH, -0.5f, 0.0f);
 
     _quickgame_tri->indices[0] = 0;
     _quickgame_tri->indices[1] = 2;
@@ -72,6 +79,7 @@ int QuickGame_Primitive_Init() {
     }
 
     sceKernelDcacheWritebackInvalidateAll();
+    QuickGame_Boot_Phase("primitives", start);
 
     return 0;
 }
@@ -83,6 +91,11 @@ void QuickGame_Primitive_Terminate() {
 }
 
 void QuickGame_Primitive_Draw_Rectangle(QGTransform2D transform, QGColor color) {
+    if(QuickGame_Graphics_Cull(transform) || QuickGame_Primitive_Init() < 0)
+        return;
+
+    QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_PRIMITIVE, transform);
+
     glMatrixMode(GL_MODEL);
     glLoadIdentity();
 
@@ -100,6 +113,12 @@ void QuickGame_Primitive_Draw_Rectangle(QGTransform2D transform, QGColor color)
 }
 
 void QuickGame_Primitive_Draw_Triangle(QGTransform2D transform, QGColor color) {
+    QGVector2 extent = { QG_TRIANGLE_HALF_WIDTH, 0.5f };
+    if(QuickGame_Graphics_Cull_Extent(transform, extent) || QuickGame_Primitive_Init() < 0)
+        return;
+
+    QuickGame_Graphics_Estimate_Coverage_Extent(QG_COVERAGE_PRIMITIVE, transform, extent);
+
     glMatrixMode(GL_MODEL);
     glLoadIdentity();
 
@@ -117,6 +136,11 @@ void QuickGame_Primitive_Draw_Triangle(QGTransform2D transform, QGColor color) {
 }
 
 void QuickGame_Primitive_Draw_Circle(QGTransform2D transform, QGColor color) {
+    if(QuickGame_Graphics_Cull(transform) || QuickGame_Primitive_Init() < 0)
+        return;
+
+    QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_PRIMITIVE, transform);
+
     glMatrixMode(GL_MODEL);
     glLoadIdentity();
 
@@ -0,0 +1,298 @@
+#include <QuickGame.h>
+#include <Profile.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <psprtc.h>
+#include <pspiofilemgr.h>
+
+#define REPORT_MAX 4096
+
+typedef struct {
+    const char* name;
+    u32* samples; // Microseconds per frame
+    u64 entered; // Tick of the open Begin, 0 when closed
+    u32 current; // Microseconds so far this frame
+} QGProfileSection;
+
+static const char* scenario_name = NULL;
+static u32* frame_samples = NULL;
+static usize frame_capacity = 0;
+static usize frame_count = 0;
+static u64 frame_start = 0;
+static u64 tick_resolution = 0;
+
+static QGProfileSection sections[QG_PROFILE_SECTIONS_MAX];
+static usize section_count = 0;
+
+static u64 profile_tick() {
+    u64 tick;
+    sceRtcGetCurrentTick(&tick);
+    return tick;
+}
+
+static u32 profile_micros(u64 ticks) {
+    return ticks * 1000000ULL / tick_resolution;
+}
+
+/**
+ * @brief Starts a run, the first frame starts now. A previous run is discarded.
+ *
+ * @param scenario Name written to the report -- must outlive the run, a string literal
+ * @param frames Number of frames to record
+ * @return i32 < 0 on failure
+ */
+i32 QuickGame_Profile_Start(const char* scenario, usize frames) {
+    if(frames == 0)
+        return -1;
+
+    QuickGame_Profile_Stop();
+
+    frame_samples = QuickGame_Allocate(frames * sizeof(u32));
+    if(frame_samples == NULL)
+        return -1;
+
+    scenario_name = scenario;
+    frame_capacity = frames;
+    frame_count = 0;
+    tick_resolution = sceRtcGetTickResolution();
+
+    // Registered in QGProfileBuiltin order
+    if(QuickGame_Profile_Section("input") != QG_PROFILE_INPUT || QuickGame_Profile_Section("present") != QG_PROFILE_PRESENT) {
+        QuickGame_Profile_Stop();
+        return -1;
+    }
+
+    frame_start = profile_tick();
+    return 0;
+}
+
+/**
+ * @brief Ends the run and frees the recorded frames
+ *
+ */
+void QuickGame_Profile_Stop() {
+    for(usize i = 0; i < section_count; i++)
+        QuickGame_Destroy(sections[i].samples);
+
+    if(frame_samples != NULL)
+        QuickGame_Destroy(frame_samples);
+
+    memset(sections, 0, sizeof(sections));
+    section_count = 0;
+    frame_samples = NULL;
+    frame_capacity = 0;
+    frame_count = 0;
+    scenario_name = NULL;
+}
+
+/**
+ * @brief Registers a section, or finds it if the name is already registered
+ *
+ * @param name Section name -- must outlive the run, a string literal
+ * @return i32 Section index or < 0 if there is no run or QG_PROFILE_SECTIONS_MAX sections
+ */
+i32 QuickGame_Profile_Section(const char* name) {
+    if(frame_samples == NULL || name == NULL)
+        return -1;
+
+    for(usize i = 0; i < section_count; i++) {
+        if(strcmp(sections[i].name, name) == 0)
+            return i;
+    }
+
+    if(section_count >= QG_PROFILE_SECTIONS_MAX)
+        return -1;
+
+    QGProfileSection* section = &sections[section_count];
+    section->samples = QuickGame_Allocate(frame_capacity * sizeof(u32));
+    if(section->samples == NULL)
+        return -1;
+
+    section->name = name;
+    section->entered = 0;
+    section->current = 0;
+
+    return section_count++;
+}
+
+/**
+ * @brief Starts timing a section. A section can be entered several times per frame, the times add up.
+ *
+ * @param section Section index
+ */
+void QuickGame_Profile_Begin(i32 section) {
+    if(section < 0 || (usize)section >= section_count)
+        return;
+
+    sections[section].entered = profile_tick();
+}
+
+/**
+ * @brief Stops timing a section
+ *
+ * @param section Section index
+ */
+void QuickGame_Profile_End(i32 section) {
+    if(section < 0 || (usize)section >= section_count || sections[section].entered == 0)
+        return;
+
+    QGProfileSection* s = &sections[section];
+    s->current += profile_micros(profile_tick() - s->entered);
+    s->entered = 0;
+}
+
+/**
+ * @brief Ends the current frame and starts the next one. Call once per frame, after presenting.
+ *
+ * @return true The run recorded all of its frames
+ * @return false The run needs more frames, or there is no run
+ */
+bool QuickGame_Profile_Frame() {
+    if(frame_samples == NULL)
+        return false;
+
+    if(frame_count >= frame_capacity)
+        return true;
+
+    u64 now = profile_tick();
+    frame_samples[frame_count] = profile_micros(now - frame_start);
+    frame_start = now;
+
+    for(usize i = 0; i < section_count; i++) {
+        sections[i].samples[frame_count] = sections[i].current;
+        sections[i].current = 0;
+    }
+
+    frame_count++;
+    return frame_count >= frame_capacity;
+}
+
+static int compare_u32(const void* a, const void* b) {
+    u32 x = *(const u32*)a;
+    u32 y = *(const u32*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Sorts a copy of the samples of a section
+ *
+ * @return u32* Sorted samples to destroy, NULL if nothing was recorded
+ */
+static u32* sorted_samples(i32 section) {
+    if(frame_count == 0 || section < -1 || section >= (i32)section_count)
+        return NULL;
+
+    u32* sorted = QuickGame_Allocate(frame_count * sizeof(u32));
+    if(sorted == NULL)
+        return NULL;
+
+    memcpy(sorted, section < 0 ? frame_samples : sections[section].samples, frame_count * sizeof(u32));
+    qsort(sorted, frame_count, sizeof(u32), compare_u32);
+    return sorted;
+}
+
+// Nearest rank percentile of sorted samples, in milliseconds
+static f32 rank(const u32* sorted, f32 percentile) {
+    if(percentile < 0.0f)
+        percentile = 0.0f;
+    if(percentile > 100.0f)
+        percentile = 100.0f;
+
+    usize idx = (usize)(percentile / 100.0f * (frame_count - 1) + 0.5f);
+    return sorted[idx] / 1000.0f;
+}
+
+/**
+ * @brief Gets a percentile of the recorded frames
+ *
+ * @param section Section index, -1 for the whole frame
+ * @param percentile Percentile in [0, 100]
+ * @return f32 Milliseconds, 0 if nothing was recorded
+ */
+f32 QuickGame_Profile_Percentile(i32 section, f32 percentile) {
+    u32* sorted = sorted_samples(section);
+    if(sorted == NULL)
+        return 0.0f;
+
+    f32 result = rank(sorted, percentile);
+    QuickGame_Destroy(sorted);
+    return result;
+}
+
+/**
+ * @brief Appends the statistics of a section to the report
+ *
+ * @return usize New length of the report
+ */
+static usize report_stats(char* report, usize length, const char* name, i32 section) {
+    u32* sorted = sorted_samples(section);
+    if(sorted == NULL)
+        return length;
+
+    u64 total = 0;
+    for(usize i = 0; i < frame_count; i++)
+        total += sorted[i];
+
+    int written = snprintf(report + length, REPORT_MAX - length,
+        "%s{\"name\":\"%s\",\"mean_ms\":%.3f,\"p50_ms\":%.3f,\"p90_ms\":%.3f,\"p99_ms\":%.3f,\"max_ms\":%.3f}",
+        section > 0 ? "," : "", name, (f64)total / frame_count / 1000.0,
+        rank(sorted, 50.0f), rank(sorted, 90.0f), rank(sorted, 99.0f), rank(sorted, 100.0f));
+
+    QuickGame_Destroy(sorted);
+
+    if(written < 0 || length + written >= REPORT_MAX)
+        return REPORT_MAX;
+    return length + written;
+}
+
+/**
+ * @brief Writes the frame and section percentiles of the run as JSON
+ *
+ * @param filename File to write, NULL for stdout
+ * @return i32 < 0 if the report could not be written
+ */
+i32 QuickGame_Profile_Report(const char* filename) {
+    if(frame_count == 0)
+        return -1;
+
+    char* report = QuickGame_Allocate(REPORT_MAX);
+    if(report == NULL)
+        return -1;
+
+    usize length = snprintf(report, REPORT_MAX, "{\"scenario\":\"%s\",\"frames\":%u,\"frame\":",
+        scenario_name != NULL ? scenario_name : "", (u32)frame_count);
+
+    // The frame entry is written with section -1, so it takes no leading comma
+    length = report_stats(report, length, "frame", -1);
+    if(length < REPORT_MAX)
+        length += snprintf(report + length, REPORT_MAX - length, ",\"sections\":[");
+
+    for(usize i = 0; i < section_count && length < REPORT_MAX; i++)
+        length = report_stats(report, length, sections[i].name, i);
+
+    if(length < REPORT_MAX)
+        length += snprintf(report + length, REPORT_MAX - length, "]}\n");
+
+    if(length >= REPORT_MAX) {
+        QuickGame_Destroy(report);
+        return -1;
+    }
+
+    i32 result = 0;
+    if(filename == NULL) {
+        if(fwrite(report, 1, length, stdout) != length)
+            result = -1;
+        fflush(stdout);
+    } else {
+        SceUID fd = sceIoOpen(filename, PSP_O_WRONLY | PSP_O_CREAT | PSP_O_TRUNC, 0777);
+        if(fd < 0 || sceIoWrite(fd, report, length) != (int)length)
+            result = -1;
+        if(fd >= 0)
+            sceIoClose(fd);
+    }
+
+    QuickGame_Destroy(report);
+    return result;
+}
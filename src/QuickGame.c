@@ -54,31 +54,67 @@ void QuickGame_Request_Exit() {
     exitRequest = true;
 }
 
-i32 QuickGame_Init() {
+static i32 init_engine(const QGDisplayConfig* config) {
+    QuickGame_Boot_Start();
+    u64 start = QuickGame_Boot_Time();
+
     if(setupCallbacks() < 0){
         return -1;
     }
+    QuickGame_Boot_Phase("callbacks", start);
+
+    start = QuickGame_Boot_Time();
+    if(config == NULL) {
+        // Technically this could fail
+        // FIXME: Handle Fail Case
+        QuickGame_Graphics_Init();
+    } else if(QuickGame_Graphics_Init_Alt(config) < 0) {
+        QuickGame_Log(QG_LOG_ERROR, QG_LOG_GRAPHICS, "Display configuration rejected");
+        return -1;
+    }
+    QuickGame_Boot_Phase("graphics", start);
 
-    // Technically this could fail
-    // FIXME: Handle Fail Case
-    QuickGame_Graphics_Init();
+    // Something is on screen before anything else loads
+    QuickGame_Boot_Splash();
 
     // Initialize input
+    start = QuickGame_Boot_Time();
     QuickGame_Input_Init();
+    QuickGame_Boot_Phase("input", start);
 
-    // Init Audio
-    QuickGame_Audio_Init();
+    // Audio and primitives initialize on first use
 
-    if(QuickGame_Primitive_Init() < 0){
+    // Workers fill the time the main thread spends waiting on the GE and vsync
+    start = QuickGame_Boot_Time();
+    if(QuickGame_Jobs_Init(0) < 0){
+        QuickGame_Log(QG_LOG_ERROR, QG_LOG_CORE, "Could not start the job workers");
         return -1;
     }
+    QuickGame_Boot_Phase("jobs", start);
 
     return 0;
 }
 
+i32 QuickGame_Init() {
+    return init_engine(NULL);
+}
+
+i32 QuickGame_Init_Alt(const QGDisplayConfig* config) {
+    if(config == NULL)
+        return -1;
+
+    return init_engine(config);
+}
+
 void QuickGame_Terminate() {
+    QuickGame_Profile_Stop();
+    QuickGame_Jobs_Terminate();
+    QuickGame_Net_Terminate();
     QuickGame_Audio_Terminate();
+    QuickGame_Primitive_Terminate();
     QuickGame_Graphics_Terminate();
+    QuickGame_Handle_Terminate();
+    QuickGame_Log_Terminate();
     sceKernelExitGame();
 }
 
@@ -0,0 +1,526 @@
+#include <QuickGame.h>
+#include <RenderQueue.h>
+#include <stddef.h>
+#include <string.h>
+#include <gu2gl.h>
+
+extern QGVMesh_t _quickgame_rect;
+extern QGVMesh_t _quickgame_tri;
+extern QGVMesh_t _quickgame_circle;
+
+/**
+ * @brief Creates a render queue
+ *
+ * @param capacity Maximum number of draws per frame (at most QG_RENDER_QUEUE_MAX)
+ * @return QGRenderQueue_t Render queue or NULL on failure
+ */
+QGRenderQueue_t QuickGame_Render_Queue_Create(usize capacity) {
+    if(capacity == 0 || capacity > QG_RENDER_QUEUE_MAX)
+        return NULL;
+
+    QGRenderQueue_t queue = (QGRenderQueue_t)QuickGame_Allocate(sizeof(QGRenderQueue));
+    if(queue == NULL)
+        return NULL;
+
+    queue->capacity = capacity;
+    queue->commands = (QGDrawCommand*)QuickGame_Allocate(sizeof(QGDrawCommand) * capacity);
+    queue->keys = (u64*)QuickGame_Allocate(sizeof(u64) * capacity);
+    queue->scratch = (u64*)QuickGame_Allocate(sizeof(u64) * capacity);
+
+    if(queue->commands == NULL || queue->keys == NULL || queue->scratch == NULL) {
+        QuickGame_Render_Queue_Destroy(&queue);
+        return NULL;
+    }
+
+    return queue;
+}
+
+static inline u64 texture_hash(QGTexture_t texture) {
+    if(texture == NULL)
+        return 0;
+
+    // Fibonacci hashing of the pointer, collisions only cost extra binds
+    u32 h = (u32)((uintptr_t)texture >> 4) * 2654435761u;
+    return (h >> 18) | 1;
+}
+
+/**
+ * @brief Builds the sort key of a draw, without the submission index
+ *
+ * @param layer Layer in [-128, 127], lower layers draw first
+ * @param blend Blend mode
+ * @param texture Texture or NULL
+ * @param depth Depth within a layer and texture, lower draws first
+ * @return u64 Sort key
+ */
+u64 QuickGame_Render_Key(i32 layer, u8 blend, QGTexture_t texture, u16 depth) {
+    if(layer < -128) layer = -128;
+    if(layer > 127) layer = 127;
+
+    return ((u64)(layer + 128) << QG_RENDER_KEY_LAYER_SHIFT) |
+           ((u64)(blend & 0x3) << QG_RENDER_KEY_BLEND_SHIFT) |
+           (texture_hash(texture) << QG_RENDER_KEY_TEXTURE_SHIFT) |
+           ((u64)depth << QG_RENDER_KEY_DEPTH_SHIFT);
+}
+
+static u8 texture_alpha(QGTexture_t texture) {
+    return texture == NULL ? QG_ALPHA_OPAQUE : texture->alpha_mode;
+}
+
+static u8 classify(const QGDrawCommand* command) {
+    if(command->blend == QG_BLEND_NONE)
+        return QG_ALPHA_OPAQUE;
+
+    if(command->blend == QG_BLEND_ADD || command->color.rgba.a != 0xFF)
+        return QG_ALPHA_BLEND;
+
+    switch(command->type) {
+        case QG_DRAW_SPRITE:
+        case QG_DRAW_NINE_SLICE:
+            return texture_alpha(command->texture);
+
+        case QG_DRAW_TILEMAP:
+            // Tile colors end up in the vertices, builds count the translucent ones
+            if(command->tilemap->translucent_tiles > 0)
+                return QG_ALPHA_BLEND;
+            return texture_alpha(command->texture);
+
+        case QG_DRAW_MESH:
+            if(command->mesh == NULL || command->mesh->type != QG_VERTEX_TYPE_TEXTURED)
+                return QG_ALPHA_BLEND;
+            return texture_alpha(command->texture);
+
+        default:
+            return QG_ALPHA_OPAQUE;
+    }
+}
+
+/**
+ * @brief Queues a draw command
+ *
+ * @param queue Render queue
+ * @param command Draw command, copied
+ * @param layer Layer in [-128, 127], lower layers draw first
+ * @param depth Depth within a layer and texture, lower draws first
+ * @return i32 < 0 if the queue is full
+ */
+i32 QuickGame_Render_Queue_Submit(QGRenderQueue_t queue, const QGDrawCommand* command, i32 layer, u16 depth) {
+    if(queue == NULL || command == NULL || queue->count == queue->capacity)
+        return -1;
+
+    // Primitive meshes are created on first use, never while the queue executes
+    bool primitive = command->type == QG_DRAW_RECTANGLE || command->type == QG_DRAW_TRIANGLE || command->type == QG_DRAW_CIRCLE;
+    if(primitive && QuickGame_Primitive_Init() < 0)
+        return -1;
+
+    usize idx = queue->count++;
+    queue->commands[idx] = *command;
+    queue->commands[idx].alpha_mode = classify(command);
+    queue->keys[idx] = QuickGame_Render_Key(layer, command->blend, command->texture, depth) | idx;
+    queue->sorted = false;
+
+    return 0;
+}
+
+/**
+ * @brief Queues a sprite on its own layer with alpha blending, sprites off screen are culled
+ *
+ * @param queue Render queue
+ * @param sprite Sprite to draw
+ * @param flip Flip type
+ * @return i32 < 0 if the queue is full
+ */
+i32 QuickGame_Render_Queue_Submit_Sprite(QGRenderQueue_t queue, QGSprite_t sprite, u8 flip) {
+    if(sprite == NULL)
+        return -1;
+
+    // Off-screen draws never reach the sort
+    if(QuickGame_Graphics_Cull(sprite->transform))
+        return 0;
+
+    QGDrawCommand command = {
+        .type = QG_DRAW_SPRITE,
+        .blend = QG_BLEND_ALPHA,
+        .flip = flip,
+        .transform = sprite->transform,
+        .color = sprite->color,
+        .texture = sprite->texture,
+        .sprite = sprite
+    };
+
+    return QuickGame_Render_Queue_Submit(queue, &command, sprite->layer, 0);
+}
+
+/**
+ * @brief Queues a nine-slice on its own layer with alpha blending, panels off screen are culled
+ *
+ * @param queue Render queue
+ * @param slice Nine-slice to draw
+ * @return i32 < 0 if the queue is full
+ */
+i32 QuickGame_Render_Queue_Submit_Nine_Slice(QGRenderQueue_t queue, QGNineSlice_t slice) {
+    if(slice == NULL)
+        return -1;
+
+    if(QuickGame_Graphics_Cull(slice->transform))
+        return 0;
+
+    QGDrawCommand command = {
+        .type = QG_DRAW_NINE_SLICE,
+        .blend = QG_BLEND_ALPHA,
+        .transform = slice->transform,
+        .color = slice->color,
+        .texture = slice->texture,
+        .nine_slice = slice
+    };
+
+    return QuickGame_Render_Queue_Submit(queue, &command, slice->layer, 0);
+}
+
+/**
+ * @brief Queues a tilemap with alpha blending
+ *
+ * @param queue Render queue
+ * @param tilemap Tilemap to draw
+ * @param layer Layer in [-128, 127]
+ * @return i32 < 0 if the queue is full
+ */
+i32 QuickGame_Render_Queue_Submit_Tilemap(QGRenderQueue_t queue, QGTilemap_t tilemap, i32 layer) {
+    if(tilemap == NULL)
+        return -1;
+
+    QGDrawCommand command = {
+        .type = QG_DRAW_TILEMAP,
+        .blend = QG_BLEND_ALPHA,
+        .transform = tilemap->transform,
+        .color.color = 0xFFFFFFFF,
+        .texture = tilemap->texture,
+        .tilemap = tilemap
+    };
+
+    return QuickGame_Render_Queue_Submit(queue, &command, layer, 0);
+}
+
+/**
+ * @brief Queues a primitive shape, shapes off screen are culled
+ *
+ * @param queue Render queue
+ * @param type QG_DRAW_RECTANGLE, QG_DRAW_TRIANGLE or QG_DRAW_CIRCLE
+ * @param transform Position, Rotation, Size
+ * @param color Color to draw with
+ * @param layer Layer in [-128, 127]
+ * @return i32 < 0 if the queue is full or type is not a primitive
+ */
+i32 QuickGame_Render_Queue_Submit_Primitive(QGRenderQueue_t queue, u8 type, QGTransform2D transform, QGColor color, i32 layer) {
+    if(type != QG_DRAW_RECTANGLE && type != QG_DRAW_TRIANGLE && type != QG_DRAW_CIRCLE)
+        return -1;
+
+    QGVector2 extent = { type == QG_DRAW_TRIANGLE ? QG_TRIANGLE_HALF_WIDTH : 0.5f, 0.5f };
+    if(QuickGame_Graphics_Cull_Extent(transform, extent))
+        return 0;
+
+    QGDrawCommand command = {
+        .type = type,
+        .blend = QG_BLEND_ALPHA,
+        .transform = transform,
+        .color = color
+    };
+
+    return QuickGame_Render_Queue_Submit(queue, &command, layer, 0);
+}
+
+#define SORT_FIRST_BYTE (QG_RENDER_KEY_INDEX_BITS / 8)
+#define SORT_PASSES (8 - SORT_FIRST_BYTE)
+
+/**
+ * @brief Sorts the queued draws by key with a radix sort, skipping bytes every key shares
+ *
+ * @param queue Render queue
+ */
+void QuickGame_Render_Queue_Sort(QGRenderQueue_t queue) {
+    if(queue == NULL || queue->sorted)
+        return;
+
+    queue->sorted = true;
+    usize n = queue->count;
+    if(n < 2)
+        return;
+
+    // Keys are submitted in index order and LSD radix sort is stable, so the index bytes never need a pass
+    u32 histogram[SORT_PASSES][256];
+    memset(histogram, 0, sizeof(histogram));
+
+    for(usize i = 0; i < n; i++) {
+        u64 key = queue->keys[i];
+        for(usize p = 0; p < SORT_PASSES; p++)
+            histogram[p][(key >> ((SORT_FIRST_BYTE + p) * 8)) & 0xFF]++;
+    }
+
+    u64* src = queue->keys;
+    u64* dst = queue->scratch;
+
+    for(usize p = 0; p < SORT_PASSES; p++) {
+        usize shift = (SORT_FIRST_BYTE + p) * 8;
+        u32* counts = histogram[p];
+
+        // Every key has the same byte here
+        if(counts[(src[0] >> shift) & 0xFF] == n)
+            continue;
+
+        u32 offset = 0;
+        for(usize b = 0; b < 256; b++) {
+            u32 c = counts[b];
+            counts[b] = offset;
+            offset += c;
+        }
+
+        for(usize i = 0; i < n; i++) {
+            u64 key = src[i];
+            dst[counts[(key >> shift) & 0xFF]++] = key;
+        }
+
+        u64* tmp = src;
+        src = dst;
+        dst = tmp;
+        queue->stats.sort_passes++;
+    }
+
+    queue->keys = src;
+    queue->scratch = dst;
+}
+
+static void set_blend(u8 blend) {
+    if(blend == QG_BLEND_NONE) {
+        glDisable(GL_BLEND);
+        return;
+    }
+
+    glEnable(GL_BLEND);
+    if(blend == QG_BLEND_ADD)
+        glBlendFunc(GU_ADD, GU_SRC_ALPHA, GU_FIX, 0, 0xFFFFFFFF);
+    else
+        glBlendFunc(GU_ADD, GU_SRC_ALPHA, GU_ONE_MINUS_SRC_ALPHA, 0, 0);
+}
+
+static void load_transform(const QGTransform2D* transform, u8 flip, f32 z) {
+    glMatrixMode(GL_MODEL);
+    glLoadIdentity();
+
+    ScePspFVector3 v1 = {transform->position.x, transform->position.y, z};
+    gluTranslate(&v1);
+
+    if(flip == QG_FLIP_HORIZONTAL || flip == QG_FLIP_BOTH)
+        gluRotateY(GL_PI);
+
+    if(flip == QG_FLIP_VERTICAL || flip == QG_FLIP_BOTH)
+        gluRotateX(GL_PI);
+
+    gluRotateZ(transform->rotation / 180.0f * GL_PI);
+
+    ScePspFVector3 v = {transform->scale.x, transform->scale.y, 1.0f};
+    gluScale(&v);
+}
+
+// Draw depth from the rank in key order, inside the -30 to 30 range of the projection
+static inline f32 rank_depth(usize rank, usize count) {
+    return -29.0f + 58.0f * (f32)(rank + 1) / (f32)(count + 1);
+}
+
+static void draw_command(QGRenderQueue_t queue, QGDrawCommand* command, f32 z, u8* blend, QGTexture_t* bound) {
+    if(command->blend != *blend) {
+        set_blend(command->blend);
+        *blend = command->blend;
+        queue->stats.blend_changes++;
+    }
+
+    if(command->texture != NULL && command->texture != *bound) {
+        QuickGame_Texture_Bind(command->texture);
+        *bound = command->texture;
+        queue->stats.texture_binds++;
+    }
+
+    switch(command->type) {
+        case QG_DRAW_SPRITE:
+            if(command->flip == QG_FLIP_HORIZONTAL || command->flip == QG_FLIP_VERTICAL)
+                glFrontFace(GL_CW);
+
+            QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_SPRITE, command->transform);
+            load_transform(&command->transform, command->flip, z);
+            glColor(command->color.color);
+            QuickGame_Graphics_Draw_Mesh(command->sprite->mesh);
+
+            if(command->flip == QG_FLIP_HORIZONTAL || command->flip == QG_FLIP_VERTICAL)
+                glFrontFace(GL_CCW);
+            break;
+
+        case QG_DRAW_TILEMAP:
+            QuickGame_Tilemap_Estimate_Coverage(command->tilemap);
+            load_transform(&command->transform, QG_FLIP_NONE, z);
+            QuickGame_Graphics_Draw_Mesh(command->tilemap->mesh);
+            break;
+
+        // Primitives already passed culling at submission
+        case QG_DRAW_RECTANGLE:
+            QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_PRIMITIVE, command->transform);
+            load_transform(&command->transform, QG_FLIP_NONE, z);
+            glColor(command->color.color);
+            QuickGame_Graphics_Draw_Mesh(_quickgame_rect);
+            break;
+
+        case QG_DRAW_TRIANGLE:
+            QuickGame_Graphics_Estimate_Coverage_Extent(QG_COVERAGE_PRIMITIVE, command->transform, (QGVector2){ QG_TRIANGLE_HALF_WIDTH, 0.5f });
+            load_transform(&command->transform, QG_FLIP_NONE, z);
+            glColor(command->color.color);
+            QuickGame_Graphics_Draw_Mesh(_quickgame_tri);
+            break;
+
+        case QG_DRAW_CIRCLE:
+            QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_PRIMITIVE, command->transform);
+            load_transform(&command->transform, QG_FLIP_NONE, z);
+            glColor(command->color.color);
+            QuickGame_Graphics_Draw_Mesh(_quickgame_circle);
+            break;
+
+        case QG_DRAW_NINE_SLICE: {
+            QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_SPRITE, command->transform);
+            QuickGame_Nine_Slice_Update(command->nine_slice);
+
+            // The mesh is already built at its size
+            QGTransform2D transform = command->transform;
+            transform.scale.x = 1.0f;
+            transform.scale.y = 1.0f;
+            load_transform(&transform, QG_FLIP_NONE, z);
+            glColor(command->color.color);
+            QuickGame_Graphics_Draw_Mesh(command->nine_slice->mesh);
+            break;
+        }
+
+        case QG_DRAW_MESH:
+            load_transform(&command->transform, command->flip, z);
+            glColor(command->color.color);
+            QuickGame_Graphics_Draw_Mesh(command->mesh);
+
+            // Colored meshes unbind the texture
+            if(command->mesh != NULL && command->mesh->type == QG_VERTEX_TYPE_COLORED)
+                *bound = NULL;
+            break;
+    }
+
+    queue->stats.draws++;
+}
+
+/**
+ * @brief Draws the queue, only changing blend state and textures when they differ. Sorts first if needed.
+ * Each draw gets a depth from its place in key order. Opaque and cutout draws go first, front to back
+ * with depth writes and blending off, so hidden pixels are rejected before shading. Translucent draws
+ * follow back to front, depth tested against them. Clears the depth buffer when there are opaque draws.
+ * Must be called inside of StartFrame() EndFrame().
+ *
+ * @param queue Render queue
+ */
+void QuickGame_Render_Queue_Execute(QGRenderQueue_t queue) {
+    if(queue == NULL)
+        return;
+
+    QuickGame_Render_Queue_Sort(queue);
+
+    QGTexture_t bound = NULL;
+    u8 blend = QG_BLEND_ALPHA;
+    usize mask = QG_RENDER_QUEUE_MAX - 1;
+    usize n = queue->count;
+
+    usize opaque = 0;
+    for(usize i = 0; i < n; i++) {
+        if(queue->commands[queue->keys[i] & mask].alpha_mode != QG_ALPHA_BLEND)
+            opaque++;
+    }
+
+    if(opaque > 0) {
+        glClear(GL_DEPTH_BUFFER_BIT);
+        glEnable(GL_DEPTH_TEST);
+        glDepthFunc(GU_GREATER);
+        sceGuDepthMask(GU_FALSE);
+        glAlphaFunc(GU_GREATER, 0, 0xFF);
+
+        // Nearest first, walking the key order backwards with blending off
+        set_blend(QG_BLEND_NONE);
+        blend = QG_BLEND_NONE;
+
+        bool cutout = false;
+        for(usize i = n; i-- > 0;) {
+            QGDrawCommand* command = &queue->commands[queue->keys[i] & mask];
+            if(command->alpha_mode == QG_ALPHA_BLEND)
+                continue;
+
+            if((command->alpha_mode == QG_ALPHA_CUTOUT) != cutout) {
+                cutout = !cutout;
+                if(cutout)
+                    glEnable(GL_ALPHA_TEST);
+                else
+                    glDisable(GL_ALPHA_TEST);
+            }
+
+            u8 command_blend = command->blend;
+            command->blend = QG_BLEND_NONE;
+            draw_command(queue, command, rank_depth(i, n), &blend, &bound);
+            command->blend = command_blend;
+        }
+
+        if(cutout)
+            glDisable(GL_ALPHA_TEST);
+
+        queue->stats.opaque_draws += opaque;
+
+        // Translucent draws are tested against the opaque ones but leave depth alone
+        sceGuDepthMask(GU_TRUE);
+    }
+
+    for(usize i = 0; i < n && opaque < n; i++) {
+        QGDrawCommand* command = &queue->commands[queue->keys[i] & mask];
+        if(command->alpha_mode != QG_ALPHA_BLEND)
+            continue;
+
+        draw_command(queue, command, rank_depth(i, n), &blend, &bound);
+    }
+
+    if(opaque > 0) {
+        sceGuDepthMask(GU_FALSE);
+        glDisable(GL_DEPTH_TEST);
+    }
+
+    if(blend != QG_BLEND_ALPHA)
+        set_blend(QG_BLEND_ALPHA);
+
+    if(bound != NULL)
+        QuickGame_Texture_Unbind();
+}
+
+/**
+ * @brief Removes all queued draws and resets the stats
+ *
+ * @param queue Render queue
+ */
+void QuickGame_Render_Queue_Clear(QGRenderQueue_t queue) {
+    if(queue == NULL)
+        return;
+
+    queue->count = 0;
+    queue->sorted = true;
+    memset(&queue->stats, 0, sizeof(QGRenderStats));
+}
+
+/**
+ * @brief Destroys a render queue
+ *
+ * @param queue Render queue to destroy -- also gets set to null.
+ */
+void QuickGame_Render_Queue_Destroy(QGRenderQueue_t* queue) {
+    if(queue == NULL || (*queue) == NULL)
+        return;
+
+    QuickGame_Destroy((*queue)->commands);
+    QuickGame_Destroy((*queue)->keys);
+    QuickGame_Destroy((*queue)->scratch);
+    QuickGame_Destroy(*queue);
+    *queue = NULL;
+}
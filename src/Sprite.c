@@ -2,6 +2,8 @@
 #include <Sprite.h>
 #include <Types.h>
 #include <stddef.h>
+#include <string.h>
+#include <math.h>
 #include <gu2gl.h>
 #include <pspkernel.h>
 
@@ -43,6 +45,10 @@ QGSprite_t QuickGame_Sprite_Create(QGVector2 position, QGVector2 size, QGTexture
     sprite->transform.scale = size;
     sprite->aabb_size = size;
     sprite->texture = texture;
+    sprite->tex_origin.x = 0.0f;
+    sprite->tex_origin.y = 0.0f;
+    sprite->tex_extent.x = texture->width;
+    sprite->tex_extent.y = texture->height;
 
     sprite->mesh = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_TEXTURED, 4, 6);
     if(!sprite->mesh) {
@@ -100,7 +106,7 @@ QGSprite_t QuickGame_Sprite_Create(QGVector2 position, QGVector2 size, QGTexture
  * @param sprite Pointer to Sprite
  */
 void QuickGame_Sprite_Destroy(QGSprite_t* sprite) {
-    if(sprite != NULL)
+    if(sprite == NULL || *sprite == NULL)
         return;
     
     QuickGame_Graphics_Destroy_Mesh(&(*sprite)->mesh);
@@ -129,6 +135,10 @@ QGSprite_t QuickGame_Sprite_Create_Drakonchik(QGVector2 position, QGVector2 size
     sprite->transform.scale = size;
     sprite->aabb_size = size;
     sprite->texture = texture;
+    sprite->tex_origin.x = u1;
+    sprite->tex_origin.y = v1 + h;
+    sprite->tex_extent.x = w;
+    sprite->tex_extent.y = -h;
 
     sprite->mesh = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_TEXTURED, 4, 6);
     if(!sprite->mesh) {
@@ -188,10 +198,53 @@ QGSprite_t QuickGame_Sprite_Create_Drakonchik(QGVector2 position, QGVector2 size
     return sprite;
 }
 
-void QuickGame_Sprite_Draw(QGSprite_t sprite) {
+QGSprite_t QuickGame_Sprite_Create_Atlas(QGVector2 position, QGVector2 size, QGAtlas_t atlas, usize idx) {
+    if(!atlas)
+        return NULL;
+
+    QGSprite_t sprite = QuickGame_Sprite_Create(position, size, atlas->texture);
     if(!sprite)
+        return NULL;
+
+    QuickGame_Sprite_Set_Atlas_Index(sprite, atlas, idx);
+    return sprite;
+}
+
+void QuickGame_Sprite_Set_Atlas_Index(QGSprite_t sprite, QGAtlas_t atlas, usize idx) {
+    if(!sprite || !atlas)
+        return;
+
+    const f32* uv = QuickGame_Atlas_UV(atlas, idx);
+
+    f32 pw = atlas->texture->pWidth;
+    f32 ph = atlas->texture->pHeight;
+    sprite->tex_origin.x = uv[0] * pw;
+    sprite->tex_origin.y = uv[1] * ph;
+    sprite->tex_extent.x = (uv[2] - uv[0]) * pw;
+    sprite->tex_extent.y = (uv[3] - uv[1]) * ph;
+
+    QGTexturedVertex* verts = sprite->mesh->data;
+    verts[0].u = uv[0];
+    verts[0].v = uv[1];
+
+    verts[1].u = uv[2];
+    verts[1].v = uv[1];
+
+    verts[2].u = uv[2];
+    verts[2].v = uv[3];
+
+    verts[3].u = uv[0];
+    verts[3].v = uv[3];
+
+    sceKernelDcacheWritebackRange(verts, sizeof(QGTexturedVertex) * 4);
+}
+
+void QuickGame_Sprite_Draw(QGSprite_t sprite) {
+    if(!sprite || QuickGame_Graphics_Cull(sprite->transform))
         return;
 
+    QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_SPRITE, sprite->transform);
+
     glMatrixMode(GL_MODEL);
     glLoadIdentity();
 
@@ -213,9 +266,11 @@ void QuickGame_Sprite_Draw(QGSprite_t sprite) {
 
 
 void QuickGame_Sprite_Draw_Flipped(QGSprite_t sprite, uint8_t flip){
-    if(!sprite)
+    if(!sprite || QuickGame_Graphics_Cull(sprite->transform))
         return;
 
+    QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_SPRITE, sprite->transform);
+
     glMatrixMode(GL_MODEL);
     glLoadIdentity();
 
@@ -269,6 +324,250 @@ bool QuickGame_Sprite_Intersects(QGSprite_t a, QGSprite_t b) {
     );
 }
 
+// 32 mask bits starting at any column of a row, zero outside the mask
+static u32 mask_bits(const QGTexture_t texture, i32 row, i32 start) {
+    if(row < 0 || row >= (i32)texture->height)
+        return 0;
+
+    const u32* words = texture->mask + row * texture->mask_stride;
+    i32 stride = texture->mask_stride;
+    i32 w = start >> 5;
+    u32 shift = start & 31;
+
+    u32 lo = (w >= 0 && w < stride) ? words[w] : 0;
+    if(shift == 0)
+        return lo;
+
+    u32 hi = (w + 1 >= 0 && w + 1 < stride) ? words[w + 1] : 0;
+    return (lo >> shift) | (hi << (32 - shift));
+}
+
+static bool mask_test(const QGSprite_t sprite, f32 lx, f32 ly) {
+    if(lx < -0.5f || lx > 0.5f || ly < -0.5f || ly > 0.5f)
+        return false;
+
+    i32 tx = (i32)floorf(sprite->tex_origin.x + (lx + 0.5f) * sprite->tex_extent.x);
+    i32 ty = (i32)floorf(sprite->tex_origin.y + (ly + 0.5f) * sprite->tex_extent.y);
+    return (mask_bits(sprite->texture, ty, tx) & 1) != 0;
+}
+
+static void bounds(const QGSprite_t sprite, f32* min_x, f32* min_y, f32* max_x, f32* max_y) {
+    f32 r = sprite->transform.rotation / 180.0f * GL_PI;
+    f32 c = fabsf(cosf(r));
+    f32 s = fabsf(sinf(r));
+    f32 hx = fabsf(sprite->transform.scale.x) * 0.5f;
+    f32 hy = fabsf(sprite->transform.scale.y) * 0.5f;
+    f32 bx = c * hx + s * hy;
+    f32 by = s * hx + c * hy;
+
+    *min_x = sprite->transform.position.x - bx;
+    *max_x = sprite->transform.position.x + bx;
+    *min_y = sprite->transform.position.y - by;
+    *max_y = sprite->transform.position.y + by;
+}
+
+static bool one_to_one(const QGSprite_t sprite) {
+    return sprite->transform.rotation == 0.0f &&
+           sprite->tex_extent.x > 0.0f && sprite->transform.scale.x == sprite->tex_extent.x &&
+           fabsf(sprite->transform.scale.y) == fabsf(sprite->tex_extent.y);
+}
+
+static inline i32 texel_column(const QGSprite_t sprite, f32 x) {
+    f32 left = sprite->transform.position.x - sprite->transform.scale.x * 0.5f;
+    return (i32)floorf(sprite->tex_origin.x + (x - left));
+}
+
+static inline i32 texel_row(const QGSprite_t sprite, f32 y) {
+    f32 ly = (y - sprite->transform.position.y) / sprite->transform.scale.y;
+    return (i32)floorf(sprite->tex_origin.y + (ly + 0.5f) * sprite->tex_extent.y);
+}
+
+// Texel coordinates along one axis are linear in screen coordinates: u = origin + (x - position) * slope
+typedef struct {
+    f32 origin;
+    f32 position;
+    f32 slope;
+} TexelAxis;
+
+static inline TexelAxis texel_axis_x(const QGSprite_t sprite) {
+    f32 slope = sprite->tex_extent.x / sprite->transform.scale.x;
+    return (TexelAxis){ sprite->tex_origin.x + sprite->tex_extent.x * 0.5f, sprite->transform.position.x, slope };
+}
+
+static inline TexelAxis texel_axis_y(const QGSprite_t sprite) {
+    f32 slope = sprite->tex_extent.y / sprite->transform.scale.y;
+    return (TexelAxis){ sprite->tex_origin.y + sprite->tex_extent.y * 0.5f, sprite->transform.position.y, slope };
+}
+
+static inline f32 texel_at(TexelAxis axis, f32 x) {
+    return axis.origin + (x - axis.position) * axis.slope;
+}
+
+// Screen coordinate past x where the texel index along the axis changes
+static inline f32 next_texel_edge(TexelAxis axis, f32 x) {
+    f32 u = texel_at(axis, x);
+    f32 edge = axis.slope > 0.0f ? floorf(u) + 1.0f : ceilf(u) - 1.0f;
+    return x + (edge - u) / axis.slope;
+}
+
+#define QG_MASK_ROW_WORDS 16 // 512 texels, the widest PSP texture
+
+static inline void set_bits(u32* row, i32 first, i32 last) {
+    for(i32 i = first; i <= last; i++)
+        row[i >> 5] |= 1u << (i & 31);
+}
+
+/**
+ * Unrotated sprites at any scale or mirroring. Each pair of texel rows meeting in the overlap is
+ * tested once: the columns of the coarser sprite are spread into a row of bits over the texel
+ * columns of the finer one, and that row is ANDed with the finer mask a word at a time.
+ * Returns -1 when the overlap is wider than QG_MASK_ROW_WORDS.
+ */
+static i32 intersects_unrotated(QGSprite_t a, QGSprite_t b, f32 x0, f32 y0, f32 x1, f32 y1) {
+    QGSprite_t fine = a, coarse = b;
+    if(fabsf(b->tex_extent.x / b->transform.scale.x) > fabsf(a->tex_extent.x / a->transform.scale.x)) {
+        fine = b;
+        coarse = a;
+    }
+
+    TexelAxis fx = texel_axis_x(fine), cx = texel_axis_x(coarse);
+    TexelAxis fy = texel_axis_y(fine), cy = texel_axis_y(coarse);
+
+    f32 fu0 = texel_at(fx, x0), fu1 = texel_at(fx, x1);
+    i32 first = (i32)floorf(fminf(fu0, fu1));
+    i32 count = (i32)ceilf(fmaxf(fu0, fu1)) - first;
+    if(count > QG_MASK_ROW_WORDS * 32)
+        return -1;
+
+    f32 cu0 = texel_at(cx, x0), cu1 = texel_at(cx, x1);
+    f32 cu_min = fminf(cu0, cu1), cu_max = fmaxf(cu0, cu1);
+
+    // Coarse texel columns to fine ones
+    f32 scale = fx.slope / cx.slope;
+    f32 offset = texel_at(fx, cx.position) - cx.origin * scale;
+
+    u32 row[QG_MASK_ROW_WORDS];
+    i32 words = (count + 31) / 32;
+
+    for(f32 y = y0; y < y1;) {
+        f32 next = fminf(y1, fminf(next_texel_edge(fy, y), next_texel_edge(cy, y)));
+        if(next <= y)
+            next = y + 1e-3f;
+
+        f32 mid = (y + next) * 0.5f;
+        i32 row_fine = (i32)floorf(texel_at(fy, mid));
+        i32 row_coarse = (i32)floorf(texel_at(cy, mid));
+        y = next;
+
+        memset(row, 0, sizeof(u32) * words);
+        bool any = false;
+
+        for(i32 col = (i32)floorf(cu_min); col < cu_max; col++) {
+            if(!(mask_bits(coarse->texture, row_coarse, col) & 1))
+                continue;
+
+            f32 e0 = fmaxf((f32)col, cu_min) * scale + offset;
+            f32 e1 = fminf((f32)(col + 1), cu_max) * scale + offset;
+            i32 k0 = (i32)floorf(fminf(e0, e1)) - first;
+            i32 k1 = (i32)ceilf(fmaxf(e0, e1)) - 1 - first;
+            if(k0 < 0)
+                k0 = 0;
+            if(k1 >= count)
+                k1 = count - 1;
+
+            if(k0 <= k1) {
+                set_bits(row, k0, k1);
+                any = true;
+            }
+        }
+
+        if(!any)
+            continue;
+
+        for(i32 w = 0; w < words; w++) {
+            if(row[w] & mask_bits(fine->texture, row_fine, first + w * 32))
+                return 1;
+        }
+    }
+
+    return 0;
+}
+
+bool QuickGame_Sprite_Intersects_Pixel(QGSprite_t a, QGSprite_t b) {
+    if(!QuickGame_Sprite_Intersects(a, b))
+        return false;
+
+    if(!a->texture->mask || !b->texture->mask)
+        return true;
+
+    f32 ax0, ay0, ax1, ay1, bx0, by0, bx1, by1;
+    bounds(a, &ax0, &ay0, &ax1, &ay1);
+    bounds(b, &bx0, &by0, &bx1, &by1);
+
+    f32 x0 = floorf(fmaxf(ax0, bx0));
+    f32 y0 = floorf(fmaxf(ay0, by0));
+    f32 x1 = ceilf(fminf(ax1, bx1));
+    f32 y1 = ceilf(fminf(ay1, by1));
+    if(x1 <= x0 || y1 <= y0)
+        return false;
+
+    if(one_to_one(a) && one_to_one(b)) {
+        i32 width = (i32)(x1 - x0);
+        i32 col_a = texel_column(a, x0 + 0.5f);
+        i32 col_b = texel_column(b, x0 + 0.5f);
+
+        for(f32 y = y0 + 0.5f; y < y1; y += 1.0f) {
+            i32 row_a = texel_row(a, y);
+            i32 row_b = texel_row(b, y);
+
+            for(i32 i = 0; i < width; i += 32) {
+                u32 bits = mask_bits(a->texture, row_a, col_a + i) & mask_bits(b->texture, row_b, col_b + i);
+                if(width - i < 32)
+                    bits &= (1u << (width - i)) - 1;
+
+                if(bits)
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    if(a->transform.rotation == 0.0f && b->transform.rotation == 0.0f) {
+        // The exact overlap, the texel edges inside it split the rows
+        i32 hit = intersects_unrotated(a, b, fmaxf(ax0, bx0), fmaxf(ay0, by0), fminf(ax1, bx1), fminf(ay1, by1));
+        if(hit >= 0)
+            return hit;
+    }
+
+    // Rotated: samples one texel of the finer sprite apart, so features a texel thin are not stepped over
+    f32 step = fminf(fminf(fabsf(a->transform.scale.x / a->tex_extent.x), fabsf(a->transform.scale.y / a->tex_extent.y)),
+                     fminf(fabsf(b->transform.scale.x / b->tex_extent.x), fabsf(b->transform.scale.y / b->tex_extent.y)));
+    if(!(step > 0.0f))
+        return true;
+
+    f32 ra = a->transform.rotation / 180.0f * GL_PI;
+    f32 rb = b->transform.rotation / 180.0f * GL_PI;
+    f32 ca = cosf(ra), sa = sinf(ra);
+    f32 cb = cosf(rb), sb = sinf(rb);
+
+    for(f32 y = y0 + step * 0.5f; y < y1; y += step) {
+        for(f32 x = x0 + step * 0.5f; x < x1; x += step) {
+            f32 dx = x - a->transform.position.x;
+            f32 dy = y - a->transform.position.y;
+            if(!mask_test(a, (ca * dx + sa * dy) / a->transform.scale.x, (-sa * dx + ca * dy) / a->transform.scale.y))
+                continue;
+
+            dx = x - b->transform.position.x;
+            dy = y - b->transform.position.y;
+            if(mask_test(b, (cb * dx + sb * dy) / b->transform.scale.x, (-sb * dx + cb * dy) / b->transform.scale.y))
+                return true;
+        }
+    }
+
+    return false;
+}
+
 bool QuickGame_Intersect_Transform(QGTransform2D a, QGTransform2D b) {
     float aMinX = a.position.x - a.scale.x / 2.0f;
     float aMinY = a.position.y - a.scale.y / 2.0f;
@@ -3,6 +3,9 @@
 #include <stb_image.h>
 #include <gu2gl.h>
 #include <pspkernel.h>
+#include <pspge.h>
+#include <stdint.h>
+#include <string.h>
 
 void swizzle_fast(u8 *out, const u8 *in, const u32 width, const u32 height) {
     u32 blockx, blocky;
@@ -50,20 +53,60 @@ void copy_texture_data(void* dest, const void* src, const int pW, const int widt
     }
 }
 
-QGTexture_t QuickGame_Texture_Load_Alt(const QGTexInfo tex_info){
-    return QuickGame_Texture_Load(tex_info.filename, tex_info.flip, tex_info.vram);
+static u8 scan_alpha(const u8* pixels, usize count) {
+    u8 mode = QG_ALPHA_OPAQUE;
+
+    for(usize i = 0; i < count; i++) {
+        u8 a = pixels[i * 4 + 3];
+        if(a == 0xFF)
+            continue;
+        if(a != 0)
+            return QG_ALPHA_BLEND;
+
+        mode = QG_ALPHA_CUTOUT;
+    }
+
+    return mode;
 }
 
-QGTexture_t QuickGame_Texture_Load(const char* filename, const bool flip, const bool vram) {
-    
-    int width, height, nrChannels;    
-    stbi_set_flip_vertically_on_load(flip);
-    unsigned char *data = stbi_load(filename, &width, &height,
-                                    &nrChannels, STBI_rgb_alpha);
+static u32* build_mask(const u8* pixels, u32 width, u32 height, u32 stride) {
+    u32* mask = QuickGame_Allocate(sizeof(u32) * stride * height);
+    if(!mask)
+        return NULL;
 
+    for(u32 y = 0; y < height; y++) {
+        u32* row = mask + y * stride;
+        for(u32 x = 0; x < width; x++) {
+            if(pixels[(x + y * width) * 4 + 3] >= 128)
+                row[x >> 5] |= 1u << (x & 31);
+        }
+    }
+
+    return mask;
+}
+
+// stb_image keeps its flip flag in a global, flipping here lets jobs decode while the main thread loads
+static void flip_rows(u8* pixels, u32 width, u32 height) {
+    u32* top = (u32*)pixels;
+    u32* bottom = (u32*)pixels + (height - 1) * width;
+
+    for(; top < bottom; top += width, bottom -= width) {
+        for(u32 x = 0; x < width; x++) {
+            u32 t = top[x];
+            top[x] = bottom[x];
+            bottom[x] = t;
+        }
+    }
+}
+
+// Takes ownership of the decoded RGBA pixels
+static QGTexture_t create_texture(unsigned char* data, const int width, const int height, const bool flip, const bool vram, const bool mask) {
     if(!data)
         return NULL;
 
+    if(flip)
+        flip_rows(data, width, height);
+
     QGTexture_t tex = (QGTexture_t)QuickGame_Allocate(sizeof(QGTexture));
     if(!tex) {
         stbi_image_free(data);
@@ -74,10 +117,22 @@ QGTexture_t QuickGame_Texture_Load(const char* filename, const bool flip, const
     tex->height = height;
     tex->pWidth = pow2(width);
     tex->pHeight = pow2(height);
+    tex->alpha_mode = scan_alpha(data, (usize)width * height);
+
+    if(mask) {
+        tex->mask_stride = (width + 31) / 32;
+        tex->mask = build_mask(data, width, height, tex->mask_stride);
+        if(!tex->mask) {
+            stbi_image_free(data);
+            QuickGame_Destroy(tex);
+            return NULL;
+        }
+    }
 
     u32 *dataBuffer = QuickGame_Allocate_Aligned(16, tex->pHeight * tex->pWidth * 4);
     if(!dataBuffer) {
         stbi_image_free(data);
+        QuickGame_Destroy(tex->mask);
         QuickGame_Destroy(tex);
         return NULL;
     }
@@ -97,6 +152,7 @@ QGTexture_t QuickGame_Texture_Load(const char* filename, const bool flip, const
 
     if(!swizzled_pixels) {
         QuickGame_Destroy(dataBuffer);
+        QuickGame_Destroy(tex->mask);
         QuickGame_Destroy(tex);
         return NULL;
     }
@@ -111,11 +167,151 @@ QGTexture_t QuickGame_Texture_Load(const char* filename, const bool flip, const
     return tex;
 }
 
+static QGTexture_t load_texture(const char* filename, const bool flip, const bool vram, const bool mask) {
+    int width, height, nrChannels;
+    unsigned char *data = stbi_load(filename, &width, &height,
+                                    &nrChannels, STBI_rgb_alpha);
+    if(!data)
+        QuickGame_Log(QG_LOG_ERROR, QG_LOG_ASSET, "Could not load texture %s: %s", filename, stbi_failure_reason());
+
+    return create_texture(data, width, height, flip, vram, mask);
+}
+
+QGTexture_t QuickGame_Texture_Load_Alt(const QGTexInfo tex_info){
+    return load_texture(tex_info.filename, tex_info.flip, tex_info.vram, tex_info.mask);
+}
+
+QGTexture_t QuickGame_Texture_Load(const char* filename, const bool flip, const bool vram) {
+    return load_texture(filename, flip, vram, false);
+}
+
+QGTexture_t QuickGame_Texture_Load_Memory(const u8* buffer, const usize size, const QGTexInfo tex_info) {
+    if(buffer == NULL || size == 0)
+        return NULL;
+
+    int width, height, nrChannels;
+    unsigned char *data = stbi_load_from_memory(buffer, size, &width, &height,
+                                                &nrChannels, STBI_rgb_alpha);
+
+    return create_texture(data, width, height, tex_info.flip, tex_info.vram, tex_info.mask);
+}
+
+i32 QuickGame_Texture_Move_VRAM(QGTexture_t texture) {
+    if(texture == NULL || texture->staging != NULL)
+        return -1;
+
+    size_t size = texture->pHeight * texture->pWidth * 4;
+    u32* vram = getStaticVramTexture(texture->pWidth, texture->pHeight, GU_PSM_8888);
+    if(!vram)
+        return -1;
+
+    memcpy(vram, texture->data, size);
+    sceKernelDcacheWritebackRange(vram, size);
+
+    QuickGame_Destroy(texture->data);
+    texture->data = vram;
+
+    return 0;
+}
+
+QGTexture_t QuickGame_Texture_Create_Dynamic(const u32 width, const u32 height, const bool vram) {
+    if(width == 0 || height == 0)
+        return NULL;
+
+    QGTexture_t tex = (QGTexture_t)QuickGame_Allocate(sizeof(QGTexture));
+    if(!tex)
+        return NULL;
+
+    tex->width = width;
+    tex->height = height;
+    // Blocks are 4 pixels wide, a pitch below that would not swizzle
+    tex->pWidth = pow2(width < 4 ? 4 : width);
+    tex->pHeight = pow2(height < 8 ? 8 : height);
+    tex->alpha_mode = QG_ALPHA_BLEND;
+
+    size_t size = tex->pHeight * tex->pWidth * 4;
+    tex->staging = QuickGame_Allocate_Aligned(16, size);
+    if(vram){
+        tex->data = getStaticVramTexture(tex->pWidth, tex->pHeight, GU_PSM_8888);
+    } else {
+        tex->data = QuickGame_Allocate_Aligned(16, size);
+    }
+
+    if(!tex->staging || !tex->data) {
+        QuickGame_Destroy(tex->staging);
+        if(!vram)
+            QuickGame_Destroy(tex->data);
+        QuickGame_Destroy(tex);
+        return NULL;
+    }
+
+    memset(tex->staging, 0, size);
+    memset(tex->data, 0, size);
+    sceKernelDcacheWritebackRange(tex->data, size);
+    tex->dirty = true;
+
+    return tex;
+}
+
+u32* QuickGame_Texture_Staging(QGTexture_t texture) {
+    if(!texture)
+        return NULL;
+
+    return texture->staging;
+}
+
+void QuickGame_Texture_Update_Rect(QGTexture_t texture, u32 x, u32 y, u32 w, u32 h) {
+    if(!texture || !texture->staging || x >= texture->pWidth || y >= texture->pHeight || w == 0 || h == 0)
+        return;
+
+    if(w > texture->pWidth - x)
+        w = texture->pWidth - x;
+    if(h > texture->pHeight - y)
+        h = texture->pHeight - y;
+
+    // A block is 16 bytes (4 pixels) by 8 rows, blocks are stored row after row
+    u32 width_blocks = texture->pWidth / 4;
+    u32 bx0 = x / 4;
+    u32 bx1 = (x + w - 1) / 4;
+    u32 by0 = y / 8;
+    u32 by1 = (y + h - 1) / 8;
+
+    for(u32 by = by0; by <= by1; by++) {
+        u32* row_start = (u32*)texture->data + (by * width_blocks + bx0) * 32;
+        u32* dst = row_start;
+
+        for(u32 bx = bx0; bx <= bx1; bx++) {
+            const u32* src = texture->staging + by * 8 * texture->pWidth + bx * 4;
+
+            for(u32 j = 0; j < 8; j++) {
+                *(dst++) = src[0];
+                *(dst++) = src[1];
+                *(dst++) = src[2];
+                *(dst++) = src[3];
+                src += texture->pWidth;
+            }
+        }
+
+        // The touched blocks of a block row are contiguous
+        sceKernelDcacheWritebackRange(row_start, (bx1 - bx0 + 1) * 128);
+    }
+
+    texture->dirty = true;
+}
+
+// VRAM textures come from a static allocator and are never freed
+static bool in_vram(const void* p) {
+    return (uintptr_t)p - (uintptr_t)sceGeEdramGetAddr() < sceGeEdramGetSize();
+}
+
 void QuickGame_Texture_Destroy(QGTexture_t* texture) {
     if(!texture || !*texture)
         return;
     
-    QuickGame_Destroy((*texture)->data);
+    QuickGame_Destroy((*texture)->staging);
+    QuickGame_Destroy((*texture)->mask);
+    if(!in_vram((*texture)->data))
+        QuickGame_Destroy((*texture)->data);
     QuickGame_Destroy(*texture);
     *texture = NULL;
 }
@@ -130,6 +326,12 @@ void QuickGame_Texture_Bind(const QGTexture_t texture) {
     glTexFilter(GL_NEAREST, GL_NEAREST);
     glTexWrap(GL_REPEAT, GL_REPEAT);
     glTexImage(0, texture->pWidth, texture->pHeight, texture->pWidth, texture->data);
+
+    // The GE may still cache texels from before the last update
+    if(texture->dirty) {
+        sceGuTexFlush();
+        texture->dirty = false;
+    }
 }
 
 void QuickGame_Texture_Unbind() {
@@ -3,6 +3,8 @@
 #include <stddef.h>
 #include <gu2gl.h>
 #include <string.h>
+#include <math.h>
+#include <pspkernel.h>
 
 /**
  * @brief Gets texture coordinates from an atlas given a position
@@ -15,8 +17,12 @@ void QuickGame_Atlas_Index_Coords(const QGTextureAtlas atlas, f32* buf, const us
     if(buf == NULL)
         return;
     
-    float x = (f32)(idx % 16) / atlas.x;
-    float y = (f32)(idx / 16) / atlas.y;
+    usize columns = (usize)atlas.x;
+    if(columns == 0)
+        return;
+
+    float x = (f32)(idx % columns) / atlas.x;
+    float y = (f32)(idx / columns) / atlas.y;
     float w = x + 1.0f / atlas.x;
     float h = y + 1.0f / atlas.y;
 
@@ -33,33 +39,46 @@ void QuickGame_Atlas_Index_Coords(const QGTextureAtlas atlas, f32* buf, const us
     buf[7] = y;
 }
 
-/**
- * @brief Create a tilemap
- * 
- * @param texture_atlas Texture Atlas size 
- * @param texture Texture to use
- * @param size Size of tile map
- * @return QGTilemap_t Created tilemap or NULL on failure
- */
-QGTilemap_t QuickGame_Tilemap_Create(QGTextureAtlas texture_atlas, QGTexture_t texture, QGVector2 size) {
+// Indices never change, so they are only written once per mesh
+static void write_indices(QGVMesh_t mesh, usize count) {
+    for(usize idx = 0; idx < count; idx++){
+        mesh->indices[idx * 6 + 0] = (idx * 4) + 0;
+        mesh->indices[idx * 6 + 1] = (idx * 4) + 1;
+        mesh->indices[idx * 6 + 2] = (idx * 4) + 2;
+        mesh->indices[idx * 6 + 3] = (idx * 4) + 2;
+        mesh->indices[idx * 6 + 4] = (idx * 4) + 3;
+        mesh->indices[idx * 6 + 5] = (idx * 4) + 0;
+    }
+    sceKernelDcacheWritebackRange(mesh->indices, sizeof(u16) * count * 6);
+}
+
+static QGTilemap_t create_tilemap(QGAtlas_t layout, bool contained, QGVector2 size) {
     QGTilemap_t tilemap = (QGTilemap*)QuickGame_Allocate(sizeof(QGTilemap));
     if(tilemap == NULL)
         return NULL;
 
-    tilemap->tile_array = (QGTile*)QuickGame_Allocate(sizeof(QGTile) * size.x * size.y);
+    usize count = size.x * size.y;
+
+    tilemap->tile_array = (QGTile*)QuickGame_Allocate(sizeof(QGTile) * count);
     if(tilemap->tile_array == NULL){
         QuickGame_Destroy(tilemap);
         return NULL;
     }
     
-    tilemap->mesh = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_FULL, size.x * size.y * 4, size.x * size.y * 6);
+    tilemap->mesh = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_FULL, count * 4, count * 6);
     if(tilemap->mesh == NULL){
         QuickGame_Destroy(tilemap->tile_array);
         QuickGame_Destroy(tilemap);
+        return NULL;
     }
 
-    tilemap->atlas = texture_atlas;
-    tilemap->texture = texture;
+    write_indices(tilemap->mesh, count);
+
+    tilemap->layout = layout;
+    tilemap->contained = contained;
+    tilemap->atlas.x = layout->info.columns;
+    tilemap->atlas.y = layout->info.rows;
+    tilemap->texture = layout->texture;
     tilemap->size = size;
 
     tilemap->transform.position.x = 0;
@@ -71,6 +90,40 @@ QGTilemap_t QuickGame_Tilemap_Create(QGTextureAtlas texture_atlas, QGTexture_t t
     return tilemap;
 }
 
+/**
+ * @brief Create a tilemap
+ * 
+ * @param texture_atlas Texture Atlas size 
+ * @param texture Texture to use
+ * @param size Size of tile map
+ * @return QGTilemap_t Created tilemap or NULL on failure
+ */
+QGTilemap_t QuickGame_Tilemap_Create(QGTextureAtlas texture_atlas, QGTexture_t texture, QGVector2 size) {
+    QGAtlas_t layout = QuickGame_Atlas_Create_Alt(texture, texture_atlas);
+    if(layout == NULL)
+        return NULL;
+
+    QGTilemap_t tilemap = create_tilemap(layout, true, size);
+    if(tilemap == NULL)
+        QuickGame_Atlas_Destroy(&layout);
+
+    return tilemap;
+}
+
+/**
+ * @brief Create a tilemap from an atlas
+ * 
+ * @param atlas Atlas to use -- not owned by the tilemap, can be shared
+ * @param size Size of tile map
+ * @return QGTilemap_t Created tilemap or NULL on failure
+ */
+QGTilemap_t QuickGame_Tilemap_Create_Alt(QGAtlas_t atlas, QGVector2 size) {
+    if(atlas == NULL)
+        return NULL;
+
+    return create_tilemap(atlas, false, size);
+}
+
 QGFullVertex create_vert(float u, float v, unsigned int color, float x, float y, float z){
     QGFullVertex vert = {
         .u = u,
@@ -113,6 +166,128 @@ void QuickGame_Tilemap_Draw_String(QGTilemap_t tilemap, const char* str, QGVecto
     }
 }
 
+static QGTileAnimation* find_animation(QGTilemap_t tilemap, usize atlas_idx) {
+    if(tilemap->animation_lookup == NULL || atlas_idx >= tilemap->layout->count)
+        return NULL;
+
+    u16 slot = tilemap->animation_lookup[atlas_idx];
+    if(slot == 0)
+        return NULL;
+
+    return &tilemap->animations[slot - 1];
+}
+
+static usize display_index(QGTilemap_t tilemap, usize atlas_idx) {
+    QGTileAnimation* anim = find_animation(tilemap, atlas_idx);
+    if(anim == NULL)
+        return atlas_idx;
+
+    return anim->frames[anim->current];
+}
+
+static bool add_cell(QGTileAnimation* anim, usize idx) {
+    if(anim->cell_count == anim->cell_capacity) {
+        usize capacity = anim->cell_capacity ? anim->cell_capacity * 2 : 16;
+        usize* cells = (usize*)QuickGame_Allocate(sizeof(usize) * capacity);
+        if(cells == NULL)
+            return false;
+
+        if(anim->cells != NULL) {
+            memcpy(cells, anim->cells, sizeof(usize) * anim->cell_count);
+            QuickGame_Destroy(anim->cells);
+        }
+
+        anim->cells = cells;
+        anim->cell_capacity = capacity;
+    }
+
+    anim->cells[anim->cell_count++] = idx;
+    return true;
+}
+
+static void remove_cell(QGTileAnimation* anim, usize idx) {
+    for(usize i = 0; i < anim->cell_count; i++) {
+        if(anim->cells[i] == idx) {
+            anim->cells[i] = anim->cells[--anim->cell_count];
+            return;
+        }
+    }
+}
+
+static void track_cells(QGTilemap_t tilemap) {
+    for(usize i = 0; i < tilemap->animation_count; i++)
+        tilemap->animations[i].cell_count = 0;
+
+    usize count = tilemap->size.x * tilemap->size.y;
+    for(usize idx = 0; idx < count; idx++) {
+        QGTileAnimation* anim = find_animation(tilemap, tilemap->tile_array[idx].atlas_idx);
+        if(anim != NULL)
+            add_cell(anim, idx);
+    }
+}
+
+static void write_tile(QGTilemap_t tilemap, QGFullVertex* verts, usize idx) {
+    QGTile* tile = &tilemap->tile_array[idx];
+
+    unsigned int color = tile->color.color;
+    const f32* uv = QuickGame_Atlas_UV(tilemap->layout, display_index(tilemap, tile->atlas_idx));
+
+    float tx = tile->position.x;
+    float ty = tile->position.y;
+    float tw = tx + tile->scale.x;
+    float th = ty + tile->scale.y;
+
+    verts[0] = create_vert(uv[0], uv[1], color, tx, ty, 0.0f);
+    verts[1] = create_vert(uv[2], uv[1], color, tw, ty, 0.0f);
+    verts[2] = create_vert(uv[2], uv[3], color, tw, th, 0.0f);
+    verts[3] = create_vert(uv[0], uv[3], color, tx, th, 0.0f);
+}
+
+#define QG_MAX_PENDING_BUILDS 32
+
+static QGTilemap_t pending_builds[QG_MAX_PENDING_BUILDS];
+static usize pending_count;
+
+static inline u32 build_state(QGTilemap_t tilemap) {
+    return __atomic_load_n(&tilemap->build_state, __ATOMIC_ACQUIRE);
+}
+
+static inline void set_build_state(QGTilemap_t tilemap, u32 state) {
+    __atomic_store_n(&tilemap->build_state, state, __ATOMIC_RELEASE);
+}
+
+static void unregister_build(QGTilemap_t tilemap) {
+    for(usize i = 0; i < pending_count; i++) {
+        if(pending_builds[i] == tilemap) {
+            pending_builds[i] = pending_builds[--pending_count];
+            return;
+        }
+    }
+}
+
+static inline bool tile_translucent(const QGTile* tile) {
+    return tile->color.rgba.a != 0xFF;
+}
+
+static usize count_translucent(QGTilemap_t tilemap) {
+    usize count = tilemap->size.x * tilemap->size.y;
+    usize translucent = 0;
+
+    for(usize idx = 0; idx < count; idx++)
+        translucent += tile_translucent(&tilemap->tile_array[idx]);
+
+    return translucent;
+}
+
+static void cancel_async(QGTilemap_t tilemap) {
+    QuickGame_Jobs_Wait(&tilemap->build_counter);
+
+    if(build_state(tilemap) != QG_TILEMAP_BUILD_IDLE) {
+        unregister_build(tilemap);
+        set_build_state(tilemap, QG_TILEMAP_BUILD_IDLE);
+    }
+}
+
 /**
  * @brief Builds a tilemap to render
  * 
@@ -121,37 +296,297 @@ void QuickGame_Tilemap_Draw_String(QGTilemap_t tilemap, const char* str, QGVecto
 void QuickGame_Tilemap_Build(QGTilemap_t tilemap) {
     if(!tilemap)
         return;
+
+    // A synchronous build supersedes a pending asynchronous one
+    cancel_async(tilemap);
     
-    for(usize y = 0; y < tilemap->size.y; y++)
-    for(usize x = 0; x < tilemap->size.x; x++){
-        usize idx = x + y * tilemap->size.x;
+    usize count = tilemap->size.x * tilemap->size.y;
+    QGFullVertex* verts = (QGFullVertex*)tilemap->mesh->data;
+
+    usize translucent = 0;
+    for(usize idx = 0; idx < count; idx++) {
+        write_tile(tilemap, &verts[idx * 4], idx);
+        translucent += tile_translucent(&tilemap->tile_array[idx]);
+    }
+
+    sceKernelDcacheWritebackRange(verts, sizeof(QGFullVertex) * count * 4);
+    tilemap->translucent_tiles = translucent;
+
+    if(tilemap->animation_count > 0)
+        track_cells(tilemap);
+}
+
+/**
+ * @brief Sets a single tile and patches only its vertices in the built mesh
+ * 
+ * @param tilemap Tilemap
+ * @param x Column of the tile
+ * @param y Row of the tile
+ * @param tile New tile
+ */
+void QuickGame_Tilemap_Set_Tile(QGTilemap_t tilemap, usize x, usize y, QGTile tile) {
+    if(!tilemap || x >= (usize)tilemap->size.x || y >= (usize)tilemap->size.y)
+        return;
+
+    usize idx = x + y * (usize)tilemap->size.x;
+
+    QGTileAnimation* old_anim = find_animation(tilemap, tilemap->tile_array[idx].atlas_idx);
+    QGTileAnimation* new_anim = find_animation(tilemap, tile.atlas_idx);
+    if(old_anim != new_anim) {
+        if(old_anim != NULL)
+            remove_cell(old_anim, idx);
+        if(new_anim != NULL)
+            add_cell(new_anim, idx);
+    }
+
+    // The worker reads the tile array, so let it finish before editing
+    QuickGame_Jobs_Wait(&tilemap->build_counter);
+
+    i32 translucent = (i32)tile_translucent(&tile) - (i32)tile_translucent(&tilemap->tile_array[idx]);
+    tilemap->tile_array[idx] = tile;
+    tilemap->translucent_tiles += translucent;
 
-        QGTile* tile = &tilemap->tile_array[idx];
+    QGFullVertex* verts = &((QGFullVertex*)tilemap->mesh->data)[idx * 4];
+    write_tile(tilemap, verts, idx);
 
-        unsigned int color = tile->color.color;
+    sceKernelDcacheWritebackRange(verts, sizeof(QGFullVertex) * 4);
 
-        f32 buf[8];
-        QuickGame_Atlas_Index_Coords(tilemap->atlas, buf, tile->atlas_idx);
+    // Keep the edit when the pending build gets swapped in
+    if(build_state(tilemap) != QG_TILEMAP_BUILD_IDLE) {
+        tilemap->back_translucent_tiles += translucent;
+        verts = &((QGFullVertex*)tilemap->back_mesh->data)[idx * 4];
+        write_tile(tilemap, verts, idx);
 
-        float tx = tile->position.x;
-        float ty = tile->position.y;
-        float tw = tx + tile->scale.x;
-        float th = ty + tile->scale.y;
+        sceKernelDcacheWritebackRange(verts, sizeof(QGFullVertex) * 4);
+    }
+}
 
-        float wRatio = (float)tilemap->texture->width / (float)tilemap->texture->pWidth;
-        float hRatio = (float)tilemap->texture->height / (float)tilemap->texture->pHeight;
+static void patch_cells(QGTilemap_t tilemap, QGTileAnimation* anim) {
+    QGFullVertex* verts = (QGFullVertex*)tilemap->mesh->data;
+    const f32* uv = QuickGame_Atlas_UV(tilemap->layout, anim->frames[anim->current]);
 
-        ((QGFullVertex*)tilemap->mesh->data)[idx * 4 + 0] = create_vert(buf[0] * wRatio, buf[1] * hRatio, color, tx, ty, 0.0f);
-        ((QGFullVertex*)tilemap->mesh->data)[idx * 4 + 1] = create_vert(buf[2] * wRatio, buf[3] * hRatio, color, tw, ty, 0.0f);
-        ((QGFullVertex*)tilemap->mesh->data)[idx * 4 + 2] = create_vert(buf[4] * wRatio, buf[5] * hRatio, color, tw, th, 0.0f);
-        ((QGFullVertex*)tilemap->mesh->data)[idx * 4 + 3] = create_vert(buf[6] * wRatio, buf[7] * hRatio, color, tx, th, 0.0f);
+    for(usize c = 0; c < anim->cell_count; c++) {
+        QGFullVertex* v = &verts[anim->cells[c] * 4];
 
-        tilemap->mesh->indices[idx * 6 + 0] = (idx * 4) + 0;
-        tilemap->mesh->indices[idx * 6 + 1] = (idx * 4) + 1;
-        tilemap->mesh->indices[idx * 6 + 2] = (idx * 4) + 2;
-        tilemap->mesh->indices[idx * 6 + 3] = (idx * 4) + 2;
-        tilemap->mesh->indices[idx * 6 + 4] = (idx * 4) + 3;
-        tilemap->mesh->indices[idx * 6 + 5] = (idx * 4) + 0;
+        v[0].u = uv[0]; v[0].v = uv[1];
+        v[1].u = uv[2]; v[1].v = uv[1];
+        v[2].u = uv[2]; v[2].v = uv[3];
+        v[3].u = uv[0]; v[3].v = uv[3];
+
+        sceKernelDcacheWritebackRange(v, sizeof(QGFullVertex) * 4);
+    }
+}
+
+static void build_job(anyopaque* data) {
+    QGTilemap_t tilemap = (QGTilemap_t)data;
+
+    usize count = tilemap->size.x * tilemap->size.y;
+    QGFullVertex* verts = (QGFullVertex*)tilemap->back_mesh->data;
+
+    for(usize idx = 0; idx < count; idx++)
+        write_tile(tilemap, &verts[idx * 4], idx);
+
+    sceKernelDcacheWritebackRange(verts, sizeof(QGFullVertex) * count * 4);
+    set_build_state(tilemap, QG_TILEMAP_BUILD_READY);
+}
+
+static void build_step(QGTilemap_t tilemap) {
+    usize count = tilemap->size.x * tilemap->size.y;
+    usize first = tilemap->build_cursor;
+    usize last = first + tilemap->build_step;
+    if(last > count)
+        last = count;
+
+    QGFullVertex* verts = (QGFullVertex*)tilemap->back_mesh->data;
+    for(usize idx = first; idx < last; idx++)
+        write_tile(tilemap, &verts[idx * 4], idx);
+
+    sceKernelDcacheWritebackRange(&verts[first * 4], sizeof(QGFullVertex) * (last - first) * 4);
+
+    tilemap->build_cursor = last;
+    if(last == count)
+        set_build_state(tilemap, QG_TILEMAP_BUILD_READY);
+}
+
+static void swap_meshes(QGTilemap_t tilemap) {
+    QGVMesh_t front = tilemap->mesh;
+    tilemap->mesh = tilemap->back_mesh;
+    tilemap->back_mesh = front;
+    tilemap->translucent_tiles = tilemap->back_translucent_tiles;
+
+    set_build_state(tilemap, QG_TILEMAP_BUILD_IDLE);
+
+    // Animations may have moved on since the back mesh was written
+    if(tilemap->animation_count > 0) {
+        track_cells(tilemap);
+        for(usize i = 0; i < tilemap->animation_count; i++)
+            patch_cells(tilemap, &tilemap->animations[i]);
+    }
+}
+
+/**
+ * @brief Builds a tilemap into a back mesh without touching the mesh being drawn.
+ * The new mesh is swapped in by the first QuickGame_Graphics_Start_Frame after the build completes.
+ * Use QuickGame_Tilemap_Set_Tile to edit tiles while a build is pending.
+ * 
+ * @param tilemap Tilemap
+ * @param tiles_per_frame 0 builds on a worker job, otherwise this many tiles are built at each frame start
+ * @return i32 < 0 on failure, 0 on success
+ */
+i32 QuickGame_Tilemap_Build_Async(QGTilemap_t tilemap, usize tiles_per_frame) {
+    if(!tilemap)
+        return -1;
+
+    usize count = tilemap->size.x * tilemap->size.y;
+
+    // Restart a pending build with the current tiles
+    QuickGame_Jobs_Wait(&tilemap->build_counter);
+    bool registered = build_state(tilemap) != QG_TILEMAP_BUILD_IDLE;
+
+    if(tilemap->back_mesh == NULL) {
+        tilemap->back_mesh = QuickGame_Graphics_Create_Mesh(QG_VERTEX_TYPE_FULL, count * 4, count * 6);
+        if(tilemap->back_mesh == NULL)
+            return -1;
+
+        write_indices(tilemap->back_mesh, count);
+    }
+
+    if(!registered) {
+        if(pending_count == QG_MAX_PENDING_BUILDS)
+            return -1;
+
+        pending_builds[pending_count++] = tilemap;
+    }
+
+    tilemap->build_cursor = 0;
+    tilemap->build_step = tiles_per_frame;
+    tilemap->back_translucent_tiles = count_translucent(tilemap);
+    set_build_state(tilemap, QG_TILEMAP_BUILD_RUNNING);
+
+    if(tiles_per_frame == 0 && QuickGame_Jobs_Submit(build_job, tilemap, &tilemap->build_counter, NULL) < 0) {
+        // Queue is full, fall back to building over frames
+        tilemap->build_step = count;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Tells whether an asynchronous build has not been swapped in yet
+ * 
+ * @param tilemap Tilemap
+ * @return true A build is pending
+ */
+bool QuickGame_Tilemap_Build_Pending(QGTilemap_t tilemap) {
+    return tilemap != NULL && build_state(tilemap) != QG_TILEMAP_BUILD_IDLE;
+}
+
+/**
+ * @brief Advances frame-spread builds and swaps in completed ones -- called by QuickGame_Graphics_Start_Frame
+ * 
+ */
+void QuickGame_Tilemap_Update_Builds() {
+    for(usize i = 0; i < pending_count;) {
+        QGTilemap_t tilemap = pending_builds[i];
+
+        if(build_state(tilemap) == QG_TILEMAP_BUILD_RUNNING && tilemap->build_step > 0)
+            build_step(tilemap);
+
+        if(build_state(tilemap) == QG_TILEMAP_BUILD_READY) {
+            swap_meshes(tilemap);
+            pending_builds[i] = pending_builds[--pending_count];
+            continue;
+        }
+
+        i++;
+    }
+}
+
+/**
+ * @brief Adds a tile animation -- tiles using base_idx cycle through the frames
+ * 
+ * @param tilemap Tilemap
+ * @param base_idx Atlas index that marks animated tiles
+ * @param frames Atlas indices to display, copied
+ * @param frame_count Number of frames
+ * @param frame_duration Time per frame in seconds
+ * @return i32 < 0 on failure, 0 on success
+ */
+i32 QuickGame_Tilemap_Add_Animation(QGTilemap_t tilemap, usize base_idx, const usize* frames, usize frame_count, f32 frame_duration) {
+    if(!tilemap || !frames || frame_count == 0 || frame_duration <= 0.0f || base_idx >= tilemap->layout->count)
+        return -1;
+
+    if(find_animation(tilemap, base_idx) != NULL || tilemap->animation_count >= 0xFFFF)
+        return -1;
+
+    if(tilemap->animation_lookup == NULL) {
+        tilemap->animation_lookup = (u16*)QuickGame_Allocate(sizeof(u16) * tilemap->layout->count);
+        if(tilemap->animation_lookup == NULL)
+            return -1;
+    }
+
+    QGTileAnimation* animations = (QGTileAnimation*)QuickGame_Allocate(sizeof(QGTileAnimation) * (tilemap->animation_count + 1));
+    if(animations == NULL)
+        return -1;
+
+    usize* frame_copy = (usize*)QuickGame_Allocate(sizeof(usize) * frame_count);
+    if(frame_copy == NULL) {
+        QuickGame_Destroy(animations);
+        return -1;
+    }
+    memcpy(frame_copy, frames, sizeof(usize) * frame_count);
+
+    if(tilemap->animations != NULL) {
+        memcpy(animations, tilemap->animations, sizeof(QGTileAnimation) * tilemap->animation_count);
+        QuickGame_Destroy(tilemap->animations);
+    }
+    tilemap->animations = animations;
+
+    QGTileAnimation* anim = &tilemap->animations[tilemap->animation_count++];
+    anim->base_idx = base_idx;
+    anim->frames = frame_copy;
+    anim->frame_count = frame_count;
+    anim->frame_duration = frame_duration;
+
+    tilemap->animation_lookup[base_idx] = tilemap->animation_count;
+
+    usize count = tilemap->size.x * tilemap->size.y;
+    for(usize idx = 0; idx < count; idx++) {
+        if(tilemap->tile_array[idx].atlas_idx == base_idx)
+            add_cell(anim, idx);
+    }
+    patch_cells(tilemap, anim);
+
+    return 0;
+}
+
+/**
+ * @brief Advances tile animations, patching only the texture coordinates of animated tiles
+ * 
+ * @param tilemap Tilemap
+ * @param dt Time since the last update in seconds
+ */
+void QuickGame_Tilemap_Animate(QGTilemap_t tilemap, f32 dt) {
+    if(!tilemap)
+        return;
+
+    for(usize i = 0; i < tilemap->animation_count; i++) {
+        QGTileAnimation* anim = &tilemap->animations[i];
+
+        anim->elapsed += dt;
+        if(anim->elapsed < anim->frame_duration)
+            continue;
+
+        usize previous = anim->current;
+        while(anim->elapsed >= anim->frame_duration) {
+            anim->elapsed -= anim->frame_duration;
+            anim->current = (anim->current + 1) % anim->frame_count;
+        }
+
+        if(anim->frames[anim->current] == anim->frames[previous])
+            continue;
+
+        patch_cells(tilemap, anim);
     }
 }
 
@@ -163,14 +598,29 @@ void QuickGame_Tilemap_Build(QGTilemap_t tilemap) {
 void QuickGame_Tilemap_Destroy(QGTilemap_t* tilemap) {
     if(tilemap == NULL || (*tilemap) == NULL)
         return;
+
+    cancel_async(*tilemap);
     
     if((*tilemap)->tile_array != NULL)
         QuickGame_Destroy((*tilemap)->tile_array);
     
     if((*tilemap)->mesh != NULL)
         QuickGame_Graphics_Destroy_Mesh(&(*tilemap)->mesh);
+
+    QuickGame_Graphics_Destroy_Mesh(&(*tilemap)->back_mesh);
     
+    for(usize i = 0; i < (*tilemap)->animation_count; i++) {
+        QuickGame_Destroy((*tilemap)->animations[i].frames);
+        QuickGame_Destroy((*tilemap)->animations[i].cells);
+    }
+    QuickGame_Destroy((*tilemap)->animations);
+    QuickGame_Destroy((*tilemap)->animation_lookup);
+
+    if((*tilemap)->contained)
+        QuickGame_Atlas_Destroy(&(*tilemap)->layout);
+
     QuickGame_Destroy((*tilemap));
+    *tilemap = NULL;
 }
 
 
@@ -179,10 +629,42 @@ void QuickGame_Tilemap_Destroy(QGTilemap_t* tilemap) {
  * 
  * @param tilemap Tilemap
  */
+/**
+ * @brief Adds the on-screen area of every tile to the coverage estimate, does nothing unless it is enabled
+ * 
+ * @param tilemap Tilemap
+ */
+void QuickGame_Tilemap_Estimate_Coverage(QGTilemap_t tilemap) {
+    if(tilemap == NULL || !QuickGame_Graphics_Coverage_Enabled())
+        return;
+
+    QGTransform2D* t = &tilemap->transform;
+    f32 r = t->rotation / 180.0f * GL_PI;
+    f32 c = cosf(r);
+    f32 s = sinf(r);
+    usize count = (usize)tilemap->size.x * (usize)tilemap->size.y;
+
+    for(usize i = 0; i < count; i++) {
+        QGTile* tile = &tilemap->tile_array[i];
+
+        // Tile center in tilemap space, then through the tilemap transform
+        f32 x = (tile->position.x + tile->scale.x * 0.5f) * t->scale.x;
+        f32 y = (tile->position.y + tile->scale.y * 0.5f) * t->scale.y;
+
+        QGTransform2D world = {
+            .position = {t->position.x + c * x - s * y, t->position.y + s * x + c * y},
+            .rotation = t->rotation,
+            .scale = {tile->scale.x * t->scale.x, tile->scale.y * t->scale.y}
+        };
+        QuickGame_Graphics_Estimate_Coverage(QG_COVERAGE_TILEMAP, world);
+    }
+}
+
 void QuickGame_Tilemap_Draw(QGTilemap_t tilemap) {
     if(tilemap == NULL)
         return;
-    
+
+    QuickGame_Tilemap_Estimate_Coverage(tilemap);
 
     glMatrixMode(GL_MODEL);
     glLoadIdentity();
@@ -0,0 +1,368 @@
+#include <QuickGame.h>
+#include <World.h>
+#include <stddef.h>
+#include <string.h>
+#include <pspkernel.h>
+#include <pspiofilemgr.h>
+
+#define QG_WORLD_MARGIN 1
+
+static usize chunk_cost(usize chunk_size) {
+    usize cells = chunk_size * chunk_size;
+    return cells * (sizeof(u16) + sizeof(QGTile) + sizeof(QGFullVertex) * 4 + sizeof(u16) * 6);
+}
+
+// Chunk states and the running flag are shared with the loader thread: a state is stored after
+// the cells or coordinates it publishes and loaded before they are read.
+static inline u32 chunk_state(const QGWorldChunk* chunk) {
+    return __atomic_load_n(&chunk->state, __ATOMIC_ACQUIRE);
+}
+
+static inline void set_chunk_state(QGWorldChunk* chunk, u32 state) {
+    __atomic_store_n(&chunk->state, state, __ATOMIC_RELEASE);
+}
+
+static inline bool world_running(const QGWorld* world) {
+    return __atomic_load_n(&world->running, __ATOMIC_ACQUIRE);
+}
+
+static inline void set_running(QGWorld* world, bool running) {
+    __atomic_store_n(&world->running, running, __ATOMIC_RELEASE);
+}
+
+static int world_loader(SceSize args, void* argp) {
+    QGWorld_t world = *(QGWorld_t*)argp;
+    usize cells = world->header.chunk_size * world->header.chunk_size;
+
+    while(world_running(world)) {
+        sceKernelWaitSema(world->signal, 1, NULL);
+
+        for(usize i = 0; i < world->slot_count && world_running(world); i++) {
+            QGWorldChunk* chunk = &world->slots[i];
+            if(chunk_state(chunk) != QG_CHUNK_LOADING)
+                continue;
+
+            usize entry = (chunk->cx + chunk->cy * world->header.chunk_columns) * 2;
+            u32 offset = world->chunk_table[entry];
+            u32 size = world->chunk_table[entry + 1];
+
+            if(size == 0 || sceIoLseek32(world->file, offset, PSP_SEEK_SET) < 0 ||
+               sceIoRead(world->file, chunk->cells, cells * sizeof(u16)) != (int)(cells * sizeof(u16))) {
+                memset(chunk->cells, 0xFF, cells * sizeof(u16));
+            }
+
+            set_chunk_state(chunk, QG_CHUNK_LOADED);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Opens a world file and preallocates chunk slots within a memory budget
+ *
+ * @param filename World file to open
+ * @param atlas Atlas used to draw the tiles -- not owned by the world
+ * @param budget Maximum number of bytes used by resident chunks
+ * @return QGWorld_t World or NULL on failure
+ */
+QGWorld_t QuickGame_World_Load(const char* filename, QGAtlas_t atlas, usize budget) {
+    if(filename == NULL || atlas == NULL)
+        return NULL;
+
+    QGWorld_t world = (QGWorld_t)QuickGame_Allocate(sizeof(QGWorld));
+    if(world == NULL)
+        return NULL;
+
+    world->atlas = atlas;
+    world->builds_per_update = 2;
+    world->thread = -1;
+    world->signal = -1;
+
+    world->file = sceIoOpen(filename, PSP_O_RDONLY, 0777);
+    if(world->file < 0)
+        goto fail;
+
+    if(sceIoRead(world->file, &world->header, sizeof(QGWorldHeader)) != sizeof(QGWorldHeader) ||
+       world->header.magic != QG_WORLD_MAGIC || world->header.version != QG_WORLD_VERSION ||
+       world->header.chunk_size == 0 || world->header.chunk_size * world->header.chunk_size * 4 > 0x10000)
+        goto fail;
+
+    // The chunks must cover the map, cells past them would index past the table
+    if((u64)world->header.chunk_columns * world->header.chunk_size < world->header.width ||
+       (u64)world->header.chunk_rows * world->header.chunk_size < world->header.height)
+        goto fail;
+
+    u64 table_entries = (u64)world->header.chunk_columns * world->header.chunk_rows;
+    if(table_entries == 0 || table_entries > 0x7FFFFFFF / (2 * sizeof(u32)))
+        goto fail;
+
+    usize table_size = (usize)table_entries * 2 * sizeof(u32);
+    world->chunk_table = (u32*)QuickGame_Allocate(table_size);
+    if(world->chunk_table == NULL || sceIoRead(world->file, world->chunk_table, table_size) != (int)table_size)
+        goto fail;
+
+    world->slot_count = budget / chunk_cost(world->header.chunk_size);
+    if(world->slot_count == 0)
+        goto fail;
+
+    world->slots = (QGWorldChunk*)QuickGame_Allocate(sizeof(QGWorldChunk) * world->slot_count);
+    if(world->slots == NULL)
+        goto fail;
+
+    QGVector2 size = {.x = world->header.chunk_size, .y = world->header.chunk_size};
+    usize cells = world->header.chunk_size * world->header.chunk_size;
+
+    for(usize i = 0; i < world->slot_count; i++) {
+        QGWorldChunk* chunk = &world->slots[i];
+        chunk->cx = -1;
+        chunk->cy = -1;
+        set_chunk_state(chunk, QG_CHUNK_FREE);
+        chunk->cells = (u16*)QuickGame_Allocate(sizeof(u16) * cells);
+        chunk->tilemap = QuickGame_Tilemap_Create_Alt(atlas, size);
+
+        if(chunk->cells == NULL || chunk->tilemap == NULL)
+            goto fail;
+    }
+
+    world->signal = sceKernelCreateSema("world_signal", 0, 0, 0x7FFFFFFF, NULL);
+    if(world->signal < 0)
+        goto fail;
+
+    set_running(world, true);
+    world->thread = sceKernelCreateThread("world_loader", world_loader, 0x18, 0x4000, 0, 0);
+    if(world->thread < 0)
+        goto fail;
+
+    if(sceKernelStartThread(world->thread, sizeof(QGWorld_t), &world) < 0) {
+        sceKernelDeleteThread(world->thread);
+        world->thread = -1;
+        goto fail;
+    }
+
+    return world;
+
+fail:
+    set_running(world, false);
+    QuickGame_World_Destroy(&world);
+    return NULL;
+}
+
+static bool chunk_in_window(const QGWorldChunk* chunk, i32 x0, i32 y0, i32 x1, i32 y1) {
+    return chunk->cx >= x0 && chunk->cx <= x1 && chunk->cy >= y0 && chunk->cy <= y1;
+}
+
+static i32 chunk_distance(const QGWorldChunk* chunk, i32 cx, i32 cy) {
+    i32 dx = chunk->cx - cx;
+    i32 dy = chunk->cy - cy;
+    if(dx < 0) dx = -dx;
+    if(dy < 0) dy = -dy;
+    return dx > dy ? dx : dy;
+}
+
+static QGWorldChunk* find_chunk(QGWorld_t world, i32 cx, i32 cy) {
+    for(usize i = 0; i < world->slot_count; i++) {
+        QGWorldChunk* chunk = &world->slots[i];
+        if(chunk_state(chunk) != QG_CHUNK_FREE && chunk->cx == cx && chunk->cy == cy)
+            return chunk;
+    }
+    return NULL;
+}
+
+static QGWorldChunk* acquire_slot(QGWorld_t world, i32 x0, i32 y0, i32 x1, i32 y1, i32 cx, i32 cy) {
+    QGWorldChunk* victim = NULL;
+    i32 victim_distance = -1;
+
+    for(usize i = 0; i < world->slot_count; i++) {
+        QGWorldChunk* chunk = &world->slots[i];
+        u32 state = chunk_state(chunk);
+        if(state == QG_CHUNK_FREE)
+            return chunk;
+
+        // Chunks being read by the loader or still needed are never evicted
+        if(state == QG_CHUNK_LOADING || chunk_in_window(chunk, x0, y0, x1, y1))
+            continue;
+
+        i32 distance = chunk_distance(chunk, cx, cy);
+        if(distance > victim_distance) {
+            victim = chunk;
+            victim_distance = distance;
+        }
+    }
+
+    return victim;
+}
+
+static void build_chunk(QGWorld_t world, QGWorldChunk* chunk) {
+    usize n = world->header.chunk_size;
+    f32 tw = world->header.tile_width;
+    f32 th = world->header.tile_height;
+
+    for(usize y = 0; y < n; y++)
+    for(usize x = 0; x < n; x++) {
+        usize idx = x + y * n;
+        u16 cell = chunk->cells[idx];
+        QGTile* tile = &chunk->tilemap->tile_array[idx];
+
+        tile->position.x = (f32)(chunk->cx * n + x) * tw;
+        tile->position.y = (f32)(chunk->cy * n + y) * th;
+        tile->color.color = 0xFFFFFFFF;
+
+        if(cell == QG_WORLD_CELL_EMPTY) {
+            // Degenerate quad, nothing is rasterized
+            tile->scale.x = 0.0f;
+            tile->scale.y = 0.0f;
+            tile->atlas_idx = 0;
+            tile->collide = false;
+        } else {
+            tile->scale.x = tw;
+            tile->scale.y = th;
+            tile->atlas_idx = cell & QG_WORLD_CELL_INDEX;
+            tile->collide = (cell & QG_WORLD_CELL_COLLIDE) != 0;
+        }
+    }
+
+    QuickGame_Tilemap_Build(chunk->tilemap);
+}
+
+/**
+ * @brief Requests the chunks around the camera, builds finished chunks and evicts distant ones
+ *
+ * @param world World to update
+ * @param camera Camera to page around, or NULL for the origin
+ */
+void QuickGame_World_Update(QGWorld_t world, const QGCamera2D* camera) {
+    if(world == NULL)
+        return;
+
+    // Build chunks the loader finished, a few per update to avoid spikes
+    usize builds = 0;
+    for(usize i = 0; i < world->slot_count && builds < world->builds_per_update; i++) {
+        QGWorldChunk* chunk = &world->slots[i];
+        if(chunk_state(chunk) == QG_CHUNK_LOADED) {
+            build_chunk(world, chunk);
+            set_chunk_state(chunk, QG_CHUNK_RESIDENT);
+            builds++;
+        }
+    }
+
+    f32 chunk_w = (f32)world->header.chunk_size * world->header.tile_width;
+    f32 chunk_h = (f32)world->header.chunk_size * world->header.tile_height;
+
+    // The camera position is the bottom left of the screen
+    f32 px = camera ? camera->position.x : 0.0f;
+    f32 py = camera ? camera->position.y : 0.0f;
+
+    i32 cx = (i32)((px + 240.0f) / chunk_w);
+    i32 cy = (i32)((py + 136.0f) / chunk_h);
+
+    i32 x0 = (i32)(px / chunk_w) - QG_WORLD_MARGIN;
+    i32 y0 = (i32)(py / chunk_h) - QG_WORLD_MARGIN;
+    i32 x1 = (i32)((px + 480.0f) / chunk_w) + QG_WORLD_MARGIN;
+    i32 y1 = (i32)((py + 272.0f) / chunk_h) + QG_WORLD_MARGIN;
+
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 >= (i32)world->header.chunk_columns) x1 = world->header.chunk_columns - 1;
+    if(y1 >= (i32)world->header.chunk_rows) y1 = world->header.chunk_rows - 1;
+
+    // Request missing chunks nearest first, ring by ring
+    bool requested = false;
+    i32 rings = (x1 - x0 > y1 - y0 ? x1 - x0 : y1 - y0) + 1;
+
+    for(i32 d = 0; d <= rings; d++)
+    for(i32 y = cy - d; y <= cy + d; y++)
+    for(i32 x = cx - d; x <= cx + d; x++) {
+        if(x != cx - d && x != cx + d && y != cy - d && y != cy + d)
+            continue;
+        if(x < x0 || x > x1 || y < y0 || y > y1)
+            continue;
+        if(find_chunk(world, x, y) != NULL)
+            continue;
+
+        QGWorldChunk* chunk = acquire_slot(world, x0, y0, x1, y1, cx, cy);
+        if(chunk == NULL)
+            goto request_done;
+
+        chunk->cx = x;
+        chunk->cy = y;
+        set_chunk_state(chunk, QG_CHUNK_LOADING);
+        requested = true;
+    }
+
+request_done:
+    if(requested)
+        sceKernelSignalSema(world->signal, 1);
+}
+
+/**
+ * @brief Draws all resident chunks
+ *
+ * @param world World to draw
+ */
+void QuickGame_World_Draw(QGWorld_t world) {
+    if(world == NULL)
+        return;
+
+    for(usize i = 0; i < world->slot_count; i++) {
+        if(chunk_state(&world->slots[i]) == QG_CHUNK_RESIDENT)
+            QuickGame_Tilemap_Draw(world->slots[i].tilemap);
+    }
+}
+
+/**
+ * @brief Gets the cell at a tile position if its chunk is resident
+ *
+ * @param world World to query
+ * @param x Column in tiles
+ * @param y Row in tiles, from the bottom
+ * @return u16 Cell value, QG_WORLD_CELL_EMPTY when out of range or not resident
+ */
+u16 QuickGame_World_Get_Cell(QGWorld_t world, i32 x, i32 y) {
+    if(world == NULL || x < 0 || y < 0 || x >= (i32)world->header.width || y >= (i32)world->header.height)
+        return QG_WORLD_CELL_EMPTY;
+
+    i32 n = world->header.chunk_size;
+    QGWorldChunk* chunk = find_chunk(world, x / n, y / n);
+    if(chunk == NULL || chunk_state(chunk) != QG_CHUNK_RESIDENT)
+        return QG_WORLD_CELL_EMPTY;
+
+    return chunk->cells[(x % n) + (y % n) * n];
+}
+
+/**
+ * @brief Stops the loader and destroys a world
+ *
+ * @param world World to destroy -- also gets set to null.
+ */
+void QuickGame_World_Destroy(QGWorld_t* world) {
+    if(world == NULL || (*world) == NULL)
+        return;
+
+    QGWorld_t w = *world;
+
+    if(w->thread >= 0) {
+        set_running(w, false);
+        sceKernelSignalSema(w->signal, 1);
+        sceKernelWaitThreadEnd(w->thread, NULL);
+        sceKernelDeleteThread(w->thread);
+    }
+
+    if(w->signal >= 0)
+        sceKernelDeleteSema(w->signal);
+
+    if(w->file >= 0)
+        sceIoClose(w->file);
+
+    if(w->slots != NULL) {
+        for(usize i = 0; i < w->slot_count; i++) {
+            QuickGame_Destroy(w->slots[i].cells);
+            QuickGame_Tilemap_Destroy(&w->slots[i].tilemap);
+        }
+        QuickGame_Destroy(w->slots);
+    }
+
+    QuickGame_Destroy(w->chunk_table);
+    QuickGame_Destroy(w);
+    *world = NULL;
+}
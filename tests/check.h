@@ -0,0 +1,36 @@
+/**
+ * @file check.h
+ * @brief Assertions of the host tests, a failed check is printed and the test keeps going
+ */
+
+#ifndef _TESTS_CHECK_H_
+#define _TESTS_CHECK_H_
+
+#include <stdio.h>
+
+static int check_failures = 0;
+
+#define CHECK(condition, ...) do { \
+        if(!(condition)) { \
+            check_failures++; \
+            fprintf(stderr, "%s:%d: %s: ", __FILE__, __LINE__, #condition); \
+            fprintf(stderr, __VA_ARGS__); \
+            fputc('\n', stderr); \
+        } \
+    } while(0)
+
+/**
+ * @brief Reports the checks of a test
+ *
+ * @return int Exit code, non-zero when a check failed
+ */
+static inline int check_result(const char* test) {
+    if(check_failures > 0)
+        fprintf(stderr, "%s: %d failed checks\n", test, check_failures);
+    else
+        printf("%s: ok\n", test);
+
+    return check_failures > 0;
+}
+
+#endif
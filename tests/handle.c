@@ -0,0 +1,66 @@
+#include <QuickGame.h>
+#include "check.h"
+
+/*
+ * Handles go stale when their resource is released, and a resource that other objects hold
+ * references to outlives the destroy of its first owner.
+ */
+
+#define COUNT 100
+
+static QGTexture_t fake_texture() {
+    QGTexture_t texture = QuickGame_Allocate(sizeof(QGTexture));
+    texture->width = texture->pWidth = 16;
+    texture->height = texture->pHeight = 16;
+    return texture;
+}
+
+int main() {
+    QGTexture_t texture = fake_texture();
+    QGHandle handle = QuickGame_Handle_Create(QG_HANDLE_TEXTURE, texture);
+    CHECK(handle != QG_NULL_HANDLE && QuickGame_Handle_Get_Texture(handle) == texture, "texture not registered");
+    CHECK(QuickGame_Handle_Get_Sprite(handle) == NULL, "texture handle looked up as a sprite");
+
+    // Two sprites take references, the owner destroys it: the texture stays until the last one goes
+    CHECK(QuickGame_Handle_Retain(handle) == 0 && QuickGame_Handle_Retain(handle) == 0, "retain failed");
+    QuickGame_Handle_Destroy(handle);
+    CHECK(QuickGame_Handle_Get_Texture(handle) == texture && texture->width == 16, "texture destroyed while referenced");
+    QuickGame_Handle_Destroy(handle);
+    CHECK(QuickGame_Handle_Valid(handle), "texture destroyed while referenced");
+    QuickGame_Handle_Destroy(handle);
+    CHECK(!QuickGame_Handle_Valid(handle) && QuickGame_Handle_Count(QG_HANDLE_TEXTURE) == 0, "texture still registered after its last reference");
+    CHECK(QuickGame_Handle_Retain(handle) < 0, "stale handle retained");
+
+    // The freed slot is reused with a new generation, the stale copy stays stale
+    QGTexture_t other = fake_texture();
+    QGHandle reused = QuickGame_Handle_Create(QG_HANDLE_TEXTURE, other);
+    CHECK(reused != handle && (reused & 0xFFFF) == (handle & 0xFFFF), "slot not reused with a new generation");
+    CHECK(QuickGame_Handle_Get_Texture(handle) == NULL, "stale handle reached the new texture");
+    QuickGame_Handle_Destroy(handle);
+    CHECK(QuickGame_Handle_Get_Texture(reused) == other, "stale handle destroyed the new texture");
+
+    // Release unregisters whatever the references
+    QuickGame_Handle_Retain(reused);
+    CHECK(QuickGame_Handle_Release(reused) == other && !QuickGame_Handle_Valid(reused), "release kept the texture registered");
+    QuickGame_Texture_Destroy(&other);
+
+    // Releases keep the table packed
+    QGHandle handles[COUNT];
+    for(usize i = 0; i < COUNT; i++)
+        handles[i] = QuickGame_Handle_Create(QG_HANDLE_TEXTURE, fake_texture());
+    for(usize i = 0; i < COUNT; i += 2)
+        QuickGame_Handle_Destroy(handles[i]);
+
+    CHECK(QuickGame_Handle_Count(QG_HANDLE_TEXTURE) == COUNT / 2, "%u textures registered instead of %u",
+          QuickGame_Handle_Count(QG_HANDLE_TEXTURE), COUNT / 2);
+    for(usize i = 0; i < COUNT / 2; i++)
+        CHECK(QuickGame_Handle_At(QG_HANDLE_TEXTURE, i) != NULL, "hole at %u", i);
+    for(usize i = 1; i < COUNT; i += 2)
+        CHECK(QuickGame_Handle_Get_Texture(handles[i]) != NULL, "live handle %u lost its texture", i);
+
+    for(usize i = 1; i < COUNT; i += 2)
+        QuickGame_Handle_Destroy(handles[i]);
+    QuickGame_Handle_Terminate();
+
+    return check_result("handle");
+}
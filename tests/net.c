@@ -0,0 +1,283 @@
+#include <QuickGame.h>
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+#include "check.h"
+
+/*
+ * Two endpoints talking over loopback: connection, delta snapshots against the acked
+ * baseline and the fallback to full ones, interpolated reads, RTT and the stats.
+ * Endpoints tick once per second so only the explicit sends happen while a check runs.
+ */
+
+typedef struct {
+    f32 position[2];
+    u32 frame;
+    u8 level[256];
+} State;
+
+static State client_state, server_state, seen;
+
+static u32 rng_state = 0x2545F491;
+
+static u32 rng() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void register_state(QGNet_t net, State* state) {
+    QuickGame_Net_Register(net, state->position, sizeof(state->position), QG_NET_BLOCK_F32);
+    QuickGame_Net_Register(net, &state->frame, sizeof(state->frame), QG_NET_BLOCK_RAW);
+    QuickGame_Net_Register(net, state->level, sizeof(state->level), QG_NET_BLOCK_RAW);
+}
+
+static void read_state(QGNet_t net, i32 peer) {
+    for(i32 block = 0; block < 3; block++)
+        QuickGame_Net_Read(net, peer, block, block == 0 ? (anyopaque*)seen.position : block == 1 ? (anyopaque*)&seen.frame : (anyopaque*)seen.level);
+}
+
+// Sends a snapshot from one end and receives it on the other
+static void deliver(QGNet_t from, QGNet_t to) {
+    QuickGame_Net_Send(from);
+    QuickGame_Net_Update(to);
+}
+
+/**
+ * @brief Opens a server and a client connected to it, each the other's peer 0
+ *
+ * @param delay_us Time the first packet of the client waits before the server takes it
+ * @return i32 < 0 on failure
+ */
+static i32 connect_pair(QGNet_t* server, QGNet_t* client, u32 delay_us) {
+    *server = QuickGame_Net_Create(0, 1);
+    *client = QuickGame_Net_Create(0, 1);
+    if(!*server || !*client)
+        return -1;
+
+    memset(&client_state, 0, sizeof(State));
+    memset(&server_state, 0, sizeof(State));
+    register_state(*server, &server_state);
+    register_state(*client, &client_state);
+    QuickGame_Net_Accept(*server, true);
+
+    QGNetAddress address;
+    if(QuickGame_Net_Address("127.0.0.1", (*server)->port, &address) < 0 || QuickGame_Net_Connect(*client, &address) != 0)
+        return -1;
+
+    // The first update of each end sends tick 1: the server takes the client as a peer and answers it
+    QuickGame_Net_Update(*client);
+    usleep(delay_us);
+    QuickGame_Net_Update(*server);
+    QuickGame_Net_Update(*client);
+    return 0;
+}
+
+static void test_delta() {
+    u8 base[600], current[600], encoded[700], decoded[600];
+
+    for(usize size = 1; size <= sizeof(base); size += 37) {
+        for(usize i = 0; i < size; i++) {
+            base[i] = rng();
+            current[i] = rng() % 8 == 0 ? rng() : base[i];
+        }
+
+        usize capacity = size + size / 128 + 1;
+        i32 length = QuickGame_Net_Delta_Encode(base, current, size, encoded, capacity);
+        CHECK(length >= 0 && QuickGame_Net_Delta_Decode(base, encoded, length, decoded, size) == 0 &&
+              memcmp(decoded, current, size) == 0, "sparse delta of %u bytes did not round trip", size);
+
+        for(usize i = 0; i < size; i++)
+            current[i] = rng() | 1;
+
+        length = QuickGame_Net_Delta_Encode(NULL, current, size, encoded, capacity);
+        CHECK(length >= 0 && QuickGame_Net_Delta_Decode(NULL, encoded, length, decoded, size) == 0 &&
+              memcmp(decoded, current, size) == 0, "full snapshot of %u bytes did not round trip", size);
+
+        CHECK(QuickGame_Net_Delta_Encode(NULL, current, size, encoded, size) < 0, "encoded %u bytes with no room for run bytes", size);
+        CHECK(QuickGame_Net_Delta_Decode(NULL, encoded, length - 1, decoded, size) < 0, "truncated delta of %u bytes decoded", size);
+        CHECK(QuickGame_Net_Delta_Decode(NULL, encoded, length, decoded, size - 1) < 0, "delta of %u bytes decoded into less", size);
+    }
+
+    memcpy(current, base, sizeof(base));
+    i32 length = QuickGame_Net_Delta_Encode(base, current, sizeof(base), encoded, sizeof(encoded));
+    CHECK(length == (sizeof(base) + 127) / 128, "unchanged state took %d bytes", length);
+}
+
+static void test_connect() {
+    QGNet_t server, client;
+    CHECK(connect_pair(&server, &client, 0) == 0, "could not connect over loopback");
+    if(!server || !client)
+        return;
+
+    QGNetPeer* peer = QuickGame_Net_Peer(server, 0);
+    CHECK(peer && peer->state == QG_NET_PEER_CONNECTED && peer->address.ip == 0x7F000001 && peer->address.port == client->port,
+          "server did not take the client as peer 0");
+    CHECK(QuickGame_Net_Peer(server, 1) == NULL, "server has a second peer");
+    CHECK(QuickGame_Net_Peer(client, 0) && client->peers[0].state == QG_NET_PEER_CONNECTED, "client not connected after the answer");
+
+    CHECK(QuickGame_Net_Read(server, 1, 0, seen.position) < 0, "read from a free peer");
+    CHECK(QuickGame_Net_Read(server, 0, 3, seen.position) < 0, "read of an unregistered block");
+
+    client_state.position[0] = 3.0f;
+    client_state.position[1] = -4.5f;
+    client_state.frame = 7;
+    client_state.level[200] = 42;
+    deliver(client, server);
+
+    QuickGame_Net_Set_Interpolation(server, 0);
+    read_state(server, 0);
+    CHECK(memcmp(&seen, &client_state, sizeof(State)) == 0, "server read other state than the client sent");
+
+    server_state.frame = 9;
+    deliver(server, client);
+    QuickGame_Net_Set_Interpolation(client, 0);
+    read_state(client, 0);
+    CHECK(seen.frame == 9, "client read frame %u instead of 9", seen.frame);
+
+    QuickGame_Net_Destroy(&client);
+    QuickGame_Net_Destroy(&server);
+    CHECK(client == NULL && server == NULL, "destroy left the endpoints set");
+}
+
+static void test_baseline() {
+    QGNet_t server, client;
+    CHECK(connect_pair(&server, &client, 0) == 0, "could not connect over loopback");
+    if(!server || !client)
+        return;
+
+    const QGNetStats* sent = QuickGame_Net_Stats(client, 0);
+    const QGNetStats* received = QuickGame_Net_Stats(server, 0);
+    QuickGame_Net_Set_Interpolation(server, 0);
+    CHECK(client->peers[0].acked == 1, "client tick 1 not acked");
+
+    // Acked: deltas against it, a changed byte costs little more than the header
+    u64 bytes = sent->bytes_out;
+    client_state.level[100] = 5;
+    deliver(client, server);
+    CHECK(sent->full_snapshots == 1, "%u full snapshots instead of the first one", sent->full_snapshots);
+    CHECK(sent->bytes_out - bytes < client->snapshot_size / 4, "delta took %llu bytes", (unsigned long long)(sent->bytes_out - bytes));
+    read_state(server, 0);
+    CHECK(memcmp(&seen, &client_state, sizeof(State)) == 0, "delta decoded to other state");
+
+    // No acks for longer than the history: the baseline is gone, so full snapshots until the next ack
+    deliver(server, client);
+    CHECK(client->peers[0].acked == client->tick, "client acked %u instead of its tick %u", client->peers[0].acked, client->tick);
+    u32 full = sent->full_snapshots;
+    for(u32 i = 0; i < QG_NET_HISTORY + 8; i++) {
+        client_state.frame = 1000 + i;
+        client_state.position[0] += 1.0f;
+        client_state.level[i] = i;
+        QuickGame_Net_Send(client);
+    }
+    CHECK(sent->full_snapshots - full == 9, "%u full snapshots after the history ran out instead of 9", sent->full_snapshots - full);
+
+    QuickGame_Net_Update(server);
+    read_state(server, 0);
+    CHECK(memcmp(&seen, &client_state, sizeof(State)) == 0, "state after the fallback differs");
+    CHECK(received->packets_dropped == 0 && received->packets_lost == 0, "%u dropped, %u lost over loopback",
+          received->packets_dropped, received->packets_lost);
+
+    // The next ack brings deltas back
+    deliver(server, client);
+    full = sent->full_snapshots;
+    client_state.level[255] = 1;
+    deliver(client, server);
+    CHECK(sent->full_snapshots == full, "full snapshot sent after a fresh ack");
+    read_state(server, 0);
+    CHECK(memcmp(&seen, &client_state, sizeof(State)) == 0, "delta after the fallback decoded to other state");
+
+    QuickGame_Net_Destroy(&client);
+    QuickGame_Net_Destroy(&server);
+}
+
+static void test_interpolation() {
+    QGNet_t server, client;
+    CHECK(connect_pair(&server, &client, 0) == 0, "could not connect over loopback");
+    if(!server || !client)
+        return;
+
+    client_state.frame = 100;
+    deliver(client, server);
+    client_state.position[0] = 10.0f;
+    client_state.position[1] = -10.0f;
+    client_state.frame = 101;
+    deliver(client, server);
+
+    // Half a tick after the newest arrival, one tick behind: halfway between the two snapshots
+    QGNetPeer* peer = QuickGame_Net_Peer(server, 0);
+    peer->history[peer->received % QG_NET_HISTORY].arrival -= server->tick_ms / 2;
+
+    QuickGame_Net_Set_Interpolation(server, 1);
+    read_state(server, 0);
+    CHECK(fabsf(seen.position[0] - 5.0f) < 0.2f && fabsf(seen.position[1] + 5.0f) < 0.2f,
+          "interpolated to (%f, %f) instead of (5, -5)", seen.position[0], seen.position[1]);
+    CHECK(seen.frame == 100, "raw block read from frame %u instead of the older snapshot", seen.frame);
+
+    QuickGame_Net_Set_Interpolation(server, 0);
+    read_state(server, 0);
+    CHECK(seen.position[0] == 10.0f && seen.position[1] == -10.0f && seen.frame == 101, "newest snapshot not read without delay");
+
+    // Further behind than the history reaches: the oldest snapshot
+    QuickGame_Net_Set_Interpolation(server, 100);
+    read_state(server, 0);
+    CHECK(seen.frame == 0 && seen.position[0] == 0.0f, "read frame %u from before the history", seen.frame);
+
+    QuickGame_Net_Destroy(&client);
+    QuickGame_Net_Destroy(&server);
+}
+
+static void test_stats() {
+    QGNet_t server, client;
+    CHECK(connect_pair(&server, &client, 20000) == 0, "could not connect over loopback");
+    if(!server || !client)
+        return;
+
+    // The server held the first packet 20ms before answering
+    const QGNetStats* stats = QuickGame_Net_Stats(client, 0);
+    f32 rtt = stats->rtt;
+    CHECK(rtt >= 15.0f && rtt < 500.0f, "RTT of %f ms for a 20 ms answer", rtt);
+
+    // Time the answer waits on the server is not part of the round trip
+    QuickGame_Net_Send(client);
+    QuickGame_Net_Update(server);
+    usleep(30000);
+    deliver(server, client);
+    CHECK(stats->rtt <= rtt, "RTT grew from %f to %f ms with the hold time", rtt, stats->rtt);
+
+    // A tick that never got sent counts as lost
+    client->tick++;
+    deliver(client, server);
+
+    const QGNetStats* client_stats = QuickGame_Net_Stats(client, 0);
+    const QGNetStats* server_stats = QuickGame_Net_Stats(server, 0);
+    CHECK(server_stats->packets_lost == 1, "%u packets lost instead of 1", server_stats->packets_lost);
+    CHECK(server_stats->packets_dropped == 0 && client_stats->packets_dropped == 0, "packets dropped over loopback");
+    CHECK(client_stats->packets_out == server_stats->packets_in && client_stats->bytes_out == server_stats->bytes_in,
+          "client sent %u packets, server received %u", client_stats->packets_out, server_stats->packets_in);
+    CHECK(server_stats->packets_out == client_stats->packets_in && server_stats->bytes_out == client_stats->bytes_in,
+          "server sent %u packets, client received %u", server_stats->packets_out, client_stats->packets_in);
+
+    // Silent peers time out
+    QuickGame_Net_Set_Timeout(server, 10);
+    usleep(30000);
+    QuickGame_Net_Update(server);
+    CHECK(QuickGame_Net_Stats(server, 0) == NULL, "silent client not removed");
+
+    QuickGame_Net_Destroy(&client);
+    QuickGame_Net_Destroy(&server);
+}
+
+int main() {
+    CHECK(QuickGame_Net_Init(1, 0) == 0, "init failed");
+
+    test_delta();
+    test_connect();
+    test_baseline();
+    test_interpolation();
+    test_stats();
+
+    QuickGame_Net_Terminate();
+    return check_result("net");
+}
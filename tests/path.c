@@ -0,0 +1,116 @@
+#include <QuickGame.h>
+#include <math.h>
+#include <stdlib.h>
+#include "check.h"
+
+/*
+ * Following the flow field from any tile costs as much as the A* path from it,
+ * on random maps with obstacles so diagonals and corners matter.
+ */
+
+#define MAPS 400
+#define SIZE 24
+#define WAYPOINTS 1024
+
+static u32 rng_state = 0x9E3779B9;
+
+static u32 rng() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static f32 step_cost(f32 dx, f32 dy) {
+    dx = fabsf(dx);
+    dy = fabsf(dy);
+    f32 lo = dx < dy ? dx : dy;
+    f32 hi = dx < dy ? dy : dx;
+    return lo * 1.41421356f + (hi - lo);
+}
+
+static f32 path_cost(QGVector2 start, const QGVector2* waypoints, i32 count) {
+    f32 cost = 0.0f;
+    QGVector2 from = start;
+    for(i32 i = 0; i < count; i++) {
+        cost += step_cost(waypoints[i].x - from.x, waypoints[i].y - from.y);
+        from = waypoints[i];
+    }
+    return cost;
+}
+
+// Follows the flow field to the goal, < 0 if it never gets there
+static f32 flow_cost(QGPathfinder_t pf, QGVector2 tile, QGVector2 goal) {
+    f32 cost = 0.0f;
+    for(usize steps = 0; steps < SIZE * SIZE; steps++) {
+        if(tile.x == goal.x && tile.y == goal.y)
+            return cost;
+
+        QGVector2 step = QuickGame_Path_Flow_Direction(pf, tile);
+        if(step.x == 0.0f && step.y == 0.0f)
+            return -1.0f;
+
+        cost += step_cost(step.x, step.y);
+        tile.x += step.x;
+        tile.y += step.y;
+    }
+    return -1.0f;
+}
+
+int main() {
+    QGTexture_t texture = QuickGame_Allocate(sizeof(QGTexture));
+    texture->width = texture->pWidth = 16;
+    texture->height = texture->pHeight = 16;
+
+    QGTilemap_t tilemap = QuickGame_Tilemap_Create((QGTextureAtlas){ 1, 1 }, texture, (QGVector2){ SIZE, SIZE });
+    QGPathfinder_t pf = QuickGame_Path_Create(tilemap);
+    CHECK(pf != NULL, "pathfinder not created");
+    if(pf == NULL)
+        return check_result("path");
+
+    QGVector2* waypoints = QuickGame_Allocate(sizeof(QGVector2) * WAYPOINTS);
+    usize compared = 0, suboptimal = 0;
+
+    for(usize map = 0; map < MAPS; map++) {
+        for(usize t = 0; t < SIZE * SIZE; t++)
+            tilemap->tile_array[t].collide = rng() % 100 < 30;
+
+        QGVector2 goal = { rng() % SIZE, rng() % SIZE };
+        tilemap->tile_array[(usize)goal.x + (usize)goal.y * SIZE].collide = false;
+        QuickGame_Path_Refresh(pf);
+
+        CHECK(QuickGame_Path_Flow_Build(pf, goal) == 0, "map %u: flow field not built", map);
+
+        for(usize t = 0; t < SIZE * SIZE; t++) {
+            QGVector2 start = { t % SIZE, t / SIZE };
+            if(tilemap->tile_array[t].collide)
+                continue;
+
+            i32 count = QuickGame_Path_Find(pf, start, goal, waypoints, WAYPOINTS);
+            f32 flow = flow_cost(pf, start, goal);
+
+            if(count < 0) {
+                CHECK(flow < 0.0f, "map %u: flow reaches the goal from (%g, %g) but A* does not", map, start.x, start.y);
+                continue;
+            }
+
+            CHECK(count <= WAYPOINTS, "map %u: path longer than the buffer", map);
+            f32 best = path_cost(start, waypoints, count);
+            CHECK(flow >= 0.0f, "map %u: flow never reaches the goal from (%g, %g)", map, start.x, start.y);
+            CHECK(fabsf(pf->flow_cost[t] - best) < 1e-3f, "map %u: flow cost %f, A* cost %f", map, pf->flow_cost[t], best);
+
+            compared++;
+            if(flow >= 0.0f && fabsf(flow - best) >= 1e-3f)
+                suboptimal++;
+        }
+    }
+
+    CHECK(suboptimal == 0, "%u of %u flow directions take a longer path than A*", suboptimal, compared);
+    CHECK(compared > MAPS, "too few reachable tiles compared (%u)", compared);
+
+    QuickGame_Destroy(waypoints);
+    QuickGame_Path_Destroy(&pf);
+    QuickGame_Tilemap_Destroy(&tilemap);
+    QuickGame_Destroy(texture);
+    return check_result("path");
+}
@@ -0,0 +1,63 @@
+#include <QuickGame.h>
+#include <math.h>
+#include "check.h"
+
+/*
+ * The triangle mesh is wider than the unit square, a triangle partly on screen past the
+ * left edge is drawn and counted by its visible part, both drawn directly and queued.
+ */
+
+static void next_frame() {
+    QuickGame_Graphics_End_Frame(false);
+    QuickGame_Graphics_Start_Frame();
+}
+
+int main() {
+    CHECK(QuickGame_Init() == 0, "init failed");
+    QuickGame_Graphics_Set_Coverage_Estimate(true);
+    QuickGame_Graphics_Start_Frame();
+
+    // Spans x in [-125, 15]: the unit square at this scale would end at -5
+    QGTransform2D edge = { { -55.0f, 136.0f }, 0.0f, { 100.0f, 100.0f } };
+    QGColor color = { .color = 0xFFFFFFFF };
+
+    CHECK(!QuickGame_Graphics_Visible(edge), "unit square at x = -55 reported visible");
+    CHECK(QuickGame_Graphics_Visible_Extent(edge, (QGVector2){ QG_TRIANGLE_HALF_WIDTH, 0.5f }), "triangle at x = -55 culled");
+
+    QuickGame_Primitive_Draw_Triangle(edge, color);
+    next_frame();
+    QGCullStats cull = QuickGame_Graphics_Get_Cull_Stats();
+    QGCoverageStats coverage = QuickGame_Graphics_Get_Coverage_Stats();
+    CHECK(cull.drawn == 1 && cull.culled == 0, "triangle partly on screen: %u drawn, %u culled", cull.drawn, cull.culled);
+
+    // The visible 15 of the 140 pixel wide bounds
+    f32 expected = 100.0f * 100.0f * 15.0f / 140.0f;
+    CHECK(fabsf(coverage.pixels[QG_COVERAGE_PRIMITIVE] - expected) < 1.0f, "triangle coverage %f instead of %f",
+          coverage.pixels[QG_COVERAGE_PRIMITIVE], expected);
+
+    // Rectangles keep the unit square
+    QuickGame_Primitive_Draw_Rectangle(edge, color);
+    next_frame();
+    cull = QuickGame_Graphics_Get_Cull_Stats();
+    CHECK(cull.drawn == 0 && cull.culled == 1, "rectangle off screen: %u drawn, %u culled", cull.drawn, cull.culled);
+
+    QGRenderQueue_t queue = QuickGame_Render_Queue_Create(4);
+    CHECK(queue != NULL, "queue not created");
+    if(queue != NULL) {
+        QuickGame_Render_Queue_Submit_Primitive(queue, QG_DRAW_TRIANGLE, edge, color, 0);
+        QuickGame_Render_Queue_Submit_Primitive(queue, QG_DRAW_RECTANGLE, edge, color, 0);
+        CHECK(queue->count == 1 && queue->commands[0].type == QG_DRAW_TRIANGLE, "queue kept %u primitives instead of the triangle", queue->count);
+
+        QuickGame_Render_Queue_Execute(queue);
+        next_frame();
+        coverage = QuickGame_Graphics_Get_Coverage_Stats();
+        CHECK(fabsf(coverage.pixels[QG_COVERAGE_PRIMITIVE] - expected) < 1.0f, "queued triangle coverage %f instead of %f",
+              coverage.pixels[QG_COVERAGE_PRIMITIVE], expected);
+
+        QuickGame_Render_Queue_Destroy(&queue);
+    }
+
+    // Not QuickGame_Terminate(), it exits with 0
+    QuickGame_Graphics_End_Frame(false);
+    return check_result("primitive");
+}
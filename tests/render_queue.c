@@ -0,0 +1,65 @@
+#include <QuickGame.h>
+#include "check.h"
+
+/*
+ * Tilemaps go to the opaque or the translucent pass by the tiles their mesh was built from.
+ */
+
+#define SIZE 8
+
+static u8 submitted_alpha(QGRenderQueue_t queue, QGTilemap_t tilemap) {
+    QuickGame_Render_Queue_Clear(queue);
+    QuickGame_Render_Queue_Submit_Tilemap(queue, tilemap, 0);
+    return queue->commands[0].alpha_mode;
+}
+
+int main() {
+    QGTexture_t texture = QuickGame_Allocate(sizeof(QGTexture));
+    texture->width = texture->pWidth = 16;
+    texture->height = texture->pHeight = 16;
+    texture->alpha_mode = QG_ALPHA_OPAQUE;
+
+    QGTilemap_t tilemap = QuickGame_Tilemap_Create((QGTextureAtlas){ 1, 1 }, texture, (QGVector2){ SIZE, SIZE });
+    QGRenderQueue_t queue = QuickGame_Render_Queue_Create(4);
+    CHECK(tilemap != NULL && queue != NULL, "setup failed");
+    if(tilemap == NULL || queue == NULL)
+        return check_result("render_queue");
+
+    for(usize t = 0; t < SIZE * SIZE; t++)
+        tilemap->tile_array[t].color.color = 0xFFFFFFFF;
+
+    QuickGame_Tilemap_Build(tilemap);
+    CHECK(submitted_alpha(queue, tilemap) == QG_ALPHA_OPAQUE, "opaque tiles not in the opaque pass");
+
+    QGTile tile = tilemap->tile_array[3];
+    tile.color.color = 0x80FFFFFF;
+    QuickGame_Tilemap_Set_Tile(tilemap, 3, 0, tile);
+    CHECK(submitted_alpha(queue, tilemap) == QG_ALPHA_BLEND, "translucent tile from Set_Tile not blended");
+
+    tile.color.color = 0xFFFFFFFF;
+    QuickGame_Tilemap_Set_Tile(tilemap, 3, 0, tile);
+    CHECK(submitted_alpha(queue, tilemap) == QG_ALPHA_OPAQUE, "tilemap still blended after its translucent tile was replaced");
+
+    // Tiles edited in place only count once they are built
+    tilemap->tile_array[10].color.color = 0x00FFFFFF;
+    CHECK(submitted_alpha(queue, tilemap) == QG_ALPHA_OPAQUE, "unbuilt edit changed the pass");
+    QuickGame_Tilemap_Build(tilemap);
+    CHECK(submitted_alpha(queue, tilemap) == QG_ALPHA_BLEND, "built translucent tile not blended");
+
+    // An asynchronous build changes the pass when its mesh is swapped in
+    tilemap->tile_array[10].color.color = 0xFFFFFFFF;
+    CHECK(QuickGame_Tilemap_Build_Async(tilemap, SIZE * SIZE) == 0, "async build not started");
+    CHECK(submitted_alpha(queue, tilemap) == QG_ALPHA_BLEND, "pass changed before the async build was swapped in");
+    QuickGame_Tilemap_Update_Builds();
+    QuickGame_Tilemap_Update_Builds();
+    CHECK(!QuickGame_Tilemap_Build_Pending(tilemap), "async build still pending");
+    CHECK(submitted_alpha(queue, tilemap) == QG_ALPHA_OPAQUE, "async build of opaque tiles still blended");
+
+    texture->alpha_mode = QG_ALPHA_CUTOUT;
+    CHECK(submitted_alpha(queue, tilemap) == QG_ALPHA_CUTOUT, "texture alpha ignored");
+
+    QuickGame_Render_Queue_Destroy(&queue);
+    QuickGame_Tilemap_Destroy(&tilemap);
+    QuickGame_Destroy(texture);
+    return check_result("render_queue");
+}
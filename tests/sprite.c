@@ -0,0 +1,160 @@
+#include <QuickGame.h>
+#include <math.h>
+#include "check.h"
+
+/*
+ * Pixel collisions of scaled and mirrored sprites match a texel by texel reference, and
+ * features a texel thin are found on overlaps far wider than a few dozen pixels.
+ */
+
+#define CASES 2000
+
+static u32 rng_state = 0x6A09E667;
+
+static u32 rng() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static f32 rng_range(f32 min, f32 max) {
+    return min + (rng() & 0xFFFF) / 65535.0f * (max - min);
+}
+
+static QGTexture_t mask_texture(u32 width, u32 height) {
+    QGTexture_t texture = QuickGame_Allocate(sizeof(QGTexture));
+    texture->width = texture->pWidth = width;
+    texture->height = texture->pHeight = height;
+    texture->mask_stride = (width + 31) / 32;
+    texture->mask = QuickGame_Allocate(sizeof(u32) * texture->mask_stride * height);
+    return texture;
+}
+
+static void set_texel(QGTexture_t texture, u32 x, u32 y) {
+    texture->mask[y * texture->mask_stride + x / 32] |= 1u << (x % 32);
+}
+
+static bool texel_set(QGTexture_t texture, u32 x, u32 y) {
+    return (texture->mask[y * texture->mask_stride + x / 32] >> (x % 32)) & 1;
+}
+
+static void clear_mask(QGTexture_t texture) {
+    for(usize i = 0; i < texture->mask_stride * texture->height; i++)
+        texture->mask[i] = 0;
+}
+
+// Screen rectangle of a texel of an unrotated sprite
+static void texel_rect(QGSprite_t sprite, u32 x, u32 y, f32* x0, f32* y0, f32* x1, f32* y1) {
+    f32 ax = sprite->transform.position.x + (((f32)x - sprite->tex_origin.x) / sprite->tex_extent.x - 0.5f) * sprite->transform.scale.x;
+    f32 bx = sprite->transform.position.x + (((f32)x + 1.0f - sprite->tex_origin.x) / sprite->tex_extent.x - 0.5f) * sprite->transform.scale.x;
+    f32 ay = sprite->transform.position.y + (((f32)y - sprite->tex_origin.y) / sprite->tex_extent.y - 0.5f) * sprite->transform.scale.y;
+    f32 by = sprite->transform.position.y + (((f32)y + 1.0f - sprite->tex_origin.y) / sprite->tex_extent.y - 0.5f) * sprite->transform.scale.y;
+    *x0 = fminf(ax, bx);
+    *x1 = fmaxf(ax, bx);
+    *y0 = fminf(ay, by);
+    *y1 = fmaxf(ay, by);
+}
+
+static bool reference(QGSprite_t a, QGSprite_t b) {
+    for(u32 ay = 0; ay < a->texture->height; ay++) {
+        for(u32 ax = 0; ax < a->texture->width; ax++) {
+            if(!texel_set(a->texture, ax, ay))
+                continue;
+
+            f32 a0, a1, a2, a3;
+            texel_rect(a, ax, ay, &a0, &a1, &a2, &a3);
+
+            for(u32 by = 0; by < b->texture->height; by++) {
+                for(u32 bx = 0; bx < b->texture->width; bx++) {
+                    if(!texel_set(b->texture, bx, by))
+                        continue;
+
+                    f32 b0, b1, b2, b3;
+                    texel_rect(b, bx, by, &b0, &b1, &b2, &b3);
+                    if(a0 < b2 && b0 < a2 && a1 < b3 && b1 < a3)
+                        return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+static void place(QGSprite_t sprite, f32 x, f32 y, f32 w, f32 h) {
+    sprite->transform.position = (QGVector2){ x, y };
+    sprite->transform.scale = (QGVector2){ w, h };
+    sprite->aabb_size = (QGVector2){ fabsf(w), fabsf(h) };
+}
+
+int main() {
+    QGTexture_t ta = mask_texture(16, 16);
+    QGTexture_t tb = mask_texture(24, 20);
+    QGSprite_t a = QuickGame_Sprite_Create_Alt(0, 0, 16, 16, ta);
+    QGSprite_t b = QuickGame_Sprite_Create_Alt(0, 0, 24, 20, tb);
+    CHECK(a != NULL && b != NULL, "setup failed");
+    if(a == NULL || b == NULL)
+        return check_result("sprite");
+
+    // Random sparse masks, scales and mirroring, unrotated
+    usize hits = 0, mismatches = 0;
+    for(usize c = 0; c < CASES; c++) {
+        clear_mask(ta);
+        clear_mask(tb);
+        for(usize i = 0; i < 12; i++) {
+            set_texel(ta, rng() % ta->width, rng() % ta->height);
+            set_texel(tb, rng() % tb->width, rng() % tb->height);
+        }
+
+        f32 sign_a = rng() & 1 ? -1.0f : 1.0f, sign_b = rng() & 1 ? -1.0f : 1.0f;
+        place(a, rng_range(100, 140), rng_range(100, 140), sign_a * rng_range(6, 120), rng_range(6, 120));
+        place(b, rng_range(100, 140), rng_range(100, 140), rng_range(6, 120), sign_b * rng_range(6, 120));
+
+        bool expected = QuickGame_Sprite_Intersects(a, b) && reference(a, b);
+        bool result = QuickGame_Sprite_Intersects_Pixel(a, b);
+        hits += expected;
+        if(result != expected && mismatches++ < 5)
+            CHECK(false, "case %u: %d instead of %d", c, result, expected);
+    }
+    CHECK(mismatches == 0, "%u of %u cases differ from the reference", mismatches, CASES);
+    CHECK(hits > CASES / 10 && hits < CASES - CASES / 10, "only %u of %u cases hit, the cases test little", hits, CASES);
+
+    // One texel lines on 256 texel textures drawn at 200 pixels: each line is under a pixel wide
+    QGTexture_t wide = mask_texture(256, 256);
+    QGTexture_t tall = mask_texture(256, 256);
+    for(u32 i = 0; i < 256; i++) {
+        set_texel(wide, 101, i);
+        set_texel(tall, i, 77);
+    }
+
+    QGSprite_t v = QuickGame_Sprite_Create_Alt(240, 136, 200, 200, wide);
+    QGSprite_t h = QuickGame_Sprite_Create_Alt(250, 130, 220, 210, tall);
+    h->transform.scale.x = -220.0f;
+    CHECK(QuickGame_Sprite_Intersects_Pixel(v, h), "crossing thin lines missed");
+
+    QGSprite_t p = QuickGame_Sprite_Create_Alt(241, 136, 200, 200, wide);
+    CHECK(!QuickGame_Sprite_Intersects_Pixel(v, p), "parallel thin lines a pixel apart hit");
+
+    // Rotated about a shared center: sampled a texel apart, two texel lines are not stepped over
+    clear_mask(wide);
+    clear_mask(tall);
+    for(u32 i = 0; i < 256; i++) {
+        set_texel(wide, 128, i);
+        set_texel(wide, 129, i);
+        set_texel(tall, i, 128);
+        set_texel(tall, i, 129);
+    }
+    h->transform.position = v->transform.position;
+    for(usize r = 1; r < 90; r += 7) {
+        h->transform.rotation = r;
+        CHECK(QuickGame_Sprite_Intersects_Pixel(v, h), "crossing lines missed at %u degrees", r);
+    }
+
+    QuickGame_Sprite_Destroy(&a);
+    QuickGame_Sprite_Destroy(&b);
+    QuickGame_Sprite_Destroy(&v);
+    QuickGame_Sprite_Destroy(&h);
+    QuickGame_Sprite_Destroy(&p);
+    return check_result("sprite");
+}
@@ -0,0 +1,105 @@
+#include <QuickGame.h>
+#include <stdio.h>
+#include <pspkernel.h>
+#include "check.h"
+
+/*
+ * Headers whose chunks do not cover the map or whose chunk table overflows are rejected,
+ * and the chunks of a valid world stream in from the loader thread with the cells on disk.
+ */
+
+#define FILENAME "test-world.qgw"
+#define CHUNK 4
+#define COLUMNS 3
+#define ROWS 2
+
+static QGWorldHeader header(u32 width, u32 height, u32 columns, u32 rows) {
+    return (QGWorldHeader){
+        .magic = QG_WORLD_MAGIC,
+        .version = QG_WORLD_VERSION,
+        .chunk_size = CHUNK,
+        .width = width,
+        .height = height,
+        .tile_width = 16,
+        .tile_height = 16,
+        .chunk_columns = columns,
+        .chunk_rows = rows,
+    };
+}
+
+static u16 cell_at(u32 x, u32 y) {
+    return (u16)(x + y * COLUMNS * CHUNK);
+}
+
+// Writes the header and, unless the table is too large to write, the table and chunks
+static void write_world(QGWorldHeader h, bool complete) {
+    FILE* file = fopen(FILENAME, "wb");
+    fwrite(&h, sizeof(h), 1, file);
+
+    if(complete) {
+        u32 chunks = h.chunk_columns * h.chunk_rows;
+        u32 offset = sizeof(h) + chunks * 2 * sizeof(u32);
+        for(u32 i = 0; i < chunks; i++) {
+            u32 entry[2] = { offset + i * CHUNK * CHUNK * sizeof(u16), CHUNK * CHUNK * sizeof(u16) };
+            fwrite(entry, sizeof(entry), 1, file);
+        }
+
+        for(u32 cy = 0; cy < h.chunk_rows; cy++)
+        for(u32 cx = 0; cx < h.chunk_columns; cx++)
+        for(u32 y = 0; y < CHUNK; y++)
+        for(u32 x = 0; x < CHUNK; x++) {
+            u16 cell = cell_at(cx * CHUNK + x, cy * CHUNK + y);
+            fwrite(&cell, sizeof(cell), 1, file);
+        }
+    }
+
+    fclose(file);
+}
+
+int main() {
+    QGTexture_t texture = QuickGame_Allocate(sizeof(QGTexture));
+    texture->width = texture->pWidth = 64;
+    texture->height = texture->pHeight = 64;
+    QGAtlas_t atlas = QuickGame_Atlas_Create(texture, (QGAtlasInfo){ .columns = 4, .rows = 4 });
+    CHECK(atlas != NULL, "setup failed");
+    if(atlas == NULL)
+        return check_result("world");
+
+    // Fewer chunks than the map needs
+    write_world(header(COLUMNS * CHUNK + 1, ROWS * CHUNK, COLUMNS, ROWS), true);
+    CHECK(QuickGame_World_Load(FILENAME, atlas, 1 << 20) == NULL, "world wider than its chunks loaded");
+    write_world(header(COLUMNS * CHUNK, ROWS * CHUNK + 1, COLUMNS, ROWS), true);
+    CHECK(QuickGame_World_Load(FILENAME, atlas, 1 << 20) == NULL, "world taller than its chunks loaded");
+
+    // 0x10000 * 0x10000 entries of 8 bytes wrap to an empty table in 32 bits
+    write_world(header(0x10000 * CHUNK, 0x10000 * CHUNK, 0x10000, 0x10000), false);
+    CHECK(QuickGame_World_Load(FILENAME, atlas, 1 << 20) == NULL, "overflowing chunk table loaded");
+
+    write_world(header(COLUMNS * CHUNK, ROWS * CHUNK, COLUMNS, ROWS), true);
+    QGWorld_t world = QuickGame_World_Load(FILENAME, atlas, 1 << 20);
+    CHECK(world != NULL, "valid world failed to load");
+
+    if(world != NULL) {
+        // Every chunk is in the window around the origin, wait for the loader to bring them in
+        usize wrong = 0;
+        for(usize i = 0; i < 1000; i++) {
+            QuickGame_World_Update(world, NULL);
+
+            wrong = 0;
+            for(u32 y = 0; y < ROWS * CHUNK; y++)
+            for(u32 x = 0; x < COLUMNS * CHUNK; x++)
+                wrong += QuickGame_World_Get_Cell(world, x, y) != cell_at(x, y);
+
+            if(wrong == 0)
+                break;
+            sceKernelDelayThread(1000);
+        }
+        CHECK(wrong == 0, "%u cells differ from the file", wrong);
+
+        QuickGame_World_Destroy(&world);
+        CHECK(world == NULL, "destroy kept the pointer");
+    }
+
+    remove(FILENAME);
+    return check_result("world");
+}
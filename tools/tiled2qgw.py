@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+Converts a Tiled JSON map into a QuickGame chunked world file (.qgw).
+
+Usage:
+    tiled2qgw.py map.json map.qgw [--layer NAME] [--collision NAME] [--chunk 16]
+
+The tile layer (first tile layer by default) becomes the world cells. Collision comes from
+a second tile layer (any non-empty tile is solid) and/or tiles whose tileset property
+"collide" is true. Rows are written bottom to top to match QuickGame's y-up coordinates.
+See include/World.h for the binary layout.
+"""
+
+import argparse
+import base64
+import json
+import struct
+import sys
+
+MAGIC = 0x4D574751
+VERSION = 1
+HEADER = struct.Struct("<IHHIIHHIII")
+
+CELL_EMPTY = 0xFFFF
+CELL_COLLIDE = 0x8000
+CELL_INDEX = 0x7FFF
+
+GID_MASK = 0x1FFFFFFF
+
+
+def layer_data(layer):
+    data = layer["data"]
+    if isinstance(data, list):
+        return data
+
+    if layer.get("encoding") != "base64" or layer.get("compression"):
+        sys.exit("error: only CSV or uncompressed base64 layers are supported")
+
+    raw = base64.b64decode(data)
+    return list(struct.unpack("<%dI" % (len(raw) // 4), raw))
+
+
+def find_layer(tiled, name):
+    for layer in tiled["layers"]:
+        if layer.get("type") != "tilelayer":
+            continue
+        if name is None or layer.get("name") == name:
+            return layer
+    return None
+
+
+def collide_gids(tiled):
+    gids = set()
+    for tileset in tiled.get("tilesets", []):
+        first = tileset.get("firstgid", 1)
+        for tile in tileset.get("tiles", []):
+            for prop in tile.get("properties", []):
+                if prop.get("name") == "collide" and prop.get("value"):
+                    gids.add(first + tile["id"])
+    return gids
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a Tiled JSON map to a QuickGame world file")
+    parser.add_argument("input")
+    parser.add_argument("output")
+    parser.add_argument("--layer", default=None, help="tile layer to convert (default: first)")
+    parser.add_argument("--collision", default=None, help="tile layer marking solid cells")
+    parser.add_argument("--chunk", type=int, default=16, help="chunk size in tiles (max 128)")
+    args = parser.parse_args()
+
+    if args.chunk <= 0 or args.chunk * args.chunk * 4 > 0x10000:
+        sys.exit("error: chunk size must be between 1 and 128")
+
+    with open(args.input) as f:
+        tiled = json.load(f)
+
+    if tiled.get("infinite"):
+        sys.exit("error: infinite maps are not supported")
+
+    layer = find_layer(tiled, args.layer)
+    if layer is None:
+        sys.exit("error: tile layer not found")
+
+    width = tiled["width"]
+    height = tiled["height"]
+    tiles = layer_data(layer)
+
+    solid = None
+    if args.collision is not None:
+        collision = find_layer(tiled, args.collision)
+        if collision is None:
+            sys.exit("error: collision layer not found")
+        solid = layer_data(collision)
+
+    first_gid = min(t.get("firstgid", 1) for t in tiled.get("tilesets", [{"firstgid": 1}]))
+    collide = collide_gids(tiled)
+
+    def cell(x, y):
+        # Tiled rows go top to bottom, world rows bottom to top
+        i = x + (height - 1 - y) * width
+        gid = tiles[i] & GID_MASK
+        if gid == 0:
+            return CELL_EMPTY
+
+        index = gid - first_gid
+        if index > CELL_INDEX - 1:
+            sys.exit("error: tile index %d does not fit in a cell" % index)
+
+        if gid in collide or (solid is not None and solid[i] & GID_MASK):
+            index |= CELL_COLLIDE
+        return index
+
+    n = args.chunk
+    columns = (width + n - 1) // n
+    rows = (height + n - 1) // n
+
+    chunks = []
+    for cy in range(rows):
+        for cx in range(columns):
+            cells = []
+            for y in range(n):
+                for x in range(n):
+                    wx, wy = cx * n + x, cy * n + y
+                    cells.append(cell(wx, wy) if wx < width and wy < height else CELL_EMPTY)
+
+            if all(c == CELL_EMPTY for c in cells):
+                chunks.append(None)
+            else:
+                chunks.append(struct.pack("<%dH" % len(cells), *cells))
+
+    tile_width = tiled.get("tilewidth", 16)
+    tile_height = tiled.get("tileheight", 16)
+
+    offset = HEADER.size + len(chunks) * 8
+    table = []
+    for data in chunks:
+        if data is None:
+            table.append((0, 0))
+        else:
+            table.append((offset, len(data)))
+            offset += len(data)
+
+    with open(args.output, "wb") as f:
+        f.write(HEADER.pack(MAGIC, VERSION, n, width, height, tile_width, tile_height, columns, rows, 0))
+        for entry in table:
+            f.write(struct.pack("<II", *entry))
+        for data in chunks:
+            if data is not None:
+                f.write(data)
+
+    stored = sum(1 for c in chunks if c is not None)
+    print("%s: %dx%d tiles, %d/%d chunks stored" % (args.output, width, height, stored, len(chunks)))
+
+
+if __name__ == "__main__":
+    main()